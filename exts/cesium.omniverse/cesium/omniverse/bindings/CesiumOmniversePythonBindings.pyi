@@ -69,7 +69,6 @@ class ICesiumOmniverseInterface:
     def connect_to_ion(self) -> None: ...
     def create_token(self, arg0: str) -> None: ...
     def credits_available(self) -> bool: ...
-    def credits_start_next_frame(self) -> None: ...
     def get_asset_token_troubleshooting_details(self, *args, **kwargs) -> Any: ...
     def get_asset_troubleshooting_details(self, *args, **kwargs) -> Any: ...
     def get_credits(self) -> List[Tuple[str, bool]]: ...
@@ -113,12 +112,40 @@ class RenderStatistics:
     @property
     def geometries_rendered(self) -> int: ...
     @property
+    def geometry_bytes_loaded(self) -> int: ...
+    @property
+    def geometry_primitives_loaded(self) -> int: ...
+    @property
+    def geometry_primitives_merged(self) -> int: ...
+    @property
     def materials_capacity(self) -> int: ...
     @property
     def materials_loaded(self) -> int: ...
     @property
     def max_depth_visited(self) -> int: ...
     @property
+    def points_loaded(self) -> int: ...
+    @property
+    def points_rendered(self) -> int: ...
+    @property
+    def shared_texture_hits(self) -> int: ...
+    @property
+    def shared_textures_loaded(self) -> int: ...
+    @property
+    def texture_bytes_loaded(self) -> int: ...
+    @property
+    def texture_compression_input_bytes(self) -> int: ...
+    @property
+    def texture_compression_output_bytes(self) -> int: ...
+    @property
+    def texture_compression_time(self) -> int: ...
+    @property
+    def texture_pool_hits(self) -> int: ...
+    @property
+    def texture_pool_misses(self) -> int: ...
+    @property
+    def textures_compressed(self) -> int: ...
+    @property
     def tiles_culled(self) -> int: ...
     @property
     def tiles_loaded(self) -> int: ...
@@ -133,9 +160,13 @@ class RenderStatistics:
     @property
     def tileset_cached_bytes(self) -> int: ...
     @property
+    def tileset_update_time(self) -> int: ...
+    @property
     def triangles_loaded(self) -> int: ...
     @property
     def triangles_rendered(self) -> int: ...
+    @property
+    def visibility_writes(self) -> int: ...
 
 class SetDefaultTokenResult:
     def __init__(self, *args, **kwargs) -> None: ...
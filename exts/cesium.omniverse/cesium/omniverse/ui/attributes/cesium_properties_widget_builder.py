@@ -113,6 +113,7 @@ def build_common_raster_overlay_properties(add_overlay_render_method=False):
         CustomLayoutProperty("cesium:alpha", build_fn=build_slider(0, 1))
         if add_overlay_render_method:
             CustomLayoutProperty("cesium:overlayRenderMethod")
+        CustomLayoutProperty("cesium:textureCompression")
     CustomLayoutProperty("cesium:maximumScreenSpaceError")
     CustomLayoutProperty("cesium:maximumTextureSize")
     CustomLayoutProperty("cesium:maximumSimultaneousTileLoads")
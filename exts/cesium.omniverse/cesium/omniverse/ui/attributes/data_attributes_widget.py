@@ -26,7 +26,12 @@ class CesiumDataSchemaAttributesWidget(SchemaPropertiesWidget):
                 CustomLayoutProperty("cesium:debug:geometryPoolInitialCapacity")
                 CustomLayoutProperty("cesium:debug:materialPoolInitialCapacity")
                 CustomLayoutProperty("cesium:debug:texturePoolInitialCapacity")
+                CustomLayoutProperty("cesium:debug:poolGrowthFactor")
+                CustomLayoutProperty("cesium:debug:poolLowWaterMark")
+                CustomLayoutProperty("cesium:debug:poolMaximumIdleTime")
                 CustomLayoutProperty("cesium:debug:randomColors")
                 CustomLayoutProperty("cesium:debug:disableGeoreferencing")
+                CustomLayoutProperty("cesium:debug:verifyRenderStatistics")
+                CustomLayoutProperty("cesium:debug:pipelinedTileSelection")
 
         return frame.apply(props)
@@ -59,6 +59,9 @@ class CesiumTilesetAttributesWidget(SchemaPropertiesWidget):
             with CustomLayoutGroup("Rendering"):
                 CustomLayoutProperty("cesium:suspendUpdate")
                 CustomLayoutProperty("cesium:smoothNormals")
+                CustomLayoutProperty("cesium:renderPointsAsVoxels")
+                CustomLayoutProperty("cesium:mergePrimitives")
+                CustomLayoutProperty("cesium:textureCompression")
             with CustomLayoutGroup("Georeference"):
                 CustomLayoutProperty("cesium:georeferenceBinding")
 
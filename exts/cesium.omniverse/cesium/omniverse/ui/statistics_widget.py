@@ -14,6 +14,21 @@ GEOMETRIES_LOADED_TEXT = "Geometries loaded"
 GEOMETRIES_RENDERED_TEXT = "Geometries rendered"
 TRIANGLES_LOADED_TEXT = "Triangles loaded"
 TRIANGLES_RENDERED_TEXT = "Triangles rendered"
+POINTS_LOADED_TEXT = "Points loaded"
+POINTS_RENDERED_TEXT = "Points rendered"
+GEOMETRY_BYTES_LOADED_TEXT = "Geometry bytes loaded"
+GEOMETRY_BYTES_LOADED_HUMAN_READABLE_TEXT = "Geometry bytes loaded (Human-readable)"
+GEOMETRY_PRIMITIVES_LOADED_TEXT = "Geometry primitives loaded"
+GEOMETRY_PRIMITIVES_MERGED_TEXT = "Geometry primitives merged"
+TEXTURE_POOL_HITS_TEXT = "Texture pool hits"
+TEXTURE_POOL_MISSES_TEXT = "Texture pool misses"
+TEXTURE_BYTES_LOADED_TEXT = "Texture bytes loaded"
+TEXTURE_BYTES_LOADED_HUMAN_READABLE_TEXT = "Texture bytes loaded (Human-readable)"
+SHARED_TEXTURES_LOADED_TEXT = "Shared textures loaded"
+SHARED_TEXTURE_HITS_TEXT = "Shared texture hits"
+TEXTURES_COMPRESSED_TEXT = "Textures compressed"
+TEXTURE_COMPRESSION_BYTES_SAVED_HUMAN_READABLE_TEXT = "Texture compression bytes saved (Human-readable)"
+TEXTURE_COMPRESSION_THROUGHPUT_TEXT = "Texture compression throughput (worker threads, MB/s)"
 TILESET_CACHED_BYTES_TEXT = "Tileset cached bytes"
 TILESET_CACHED_BYTES_HUMAN_READABLE_TEXT = "Tileset cached bytes (Human-readable)"
 TILES_VISITED_TEXT = "Tiles visited"
@@ -24,6 +39,8 @@ MAX_DEPTH_VISITED_TEXT = "Max depth visited"
 TILES_LOADING_WORKER_TEXT = "Tiles loading (worker)"
 TILES_LOADING_MAIN_TEXT = "Tiles loading (main)"
 TILES_LOADED_TEXT = "Tiles loaded"
+VISIBILITY_WRITES_TEXT = "Visibility writes"
+TILESET_UPDATE_TIME_TEXT = "Tileset update time (main thread, us)"
 
 
 class CesiumOmniverseStatisticsWidget(ui.Frame):
@@ -45,6 +62,21 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._geometries_rendered_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._triangles_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._triangles_rendered_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._points_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._points_rendered_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._geometry_bytes_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._geometry_bytes_loaded_human_readable_model: HumanReadableBytesModel = HumanReadableBytesModel(0)
+        self._geometry_primitives_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._geometry_primitives_merged_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._texture_pool_hits_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._texture_pool_misses_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._texture_bytes_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._texture_bytes_loaded_human_readable_model: HumanReadableBytesModel = HumanReadableBytesModel(0)
+        self._shared_textures_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._shared_texture_hits_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._textures_compressed_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._texture_compression_saved_model: HumanReadableBytesModel = HumanReadableBytesModel(0)
+        self._texture_compression_throughput_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tileset_cached_bytes_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tileset_cached_bytes_human_readable_model: HumanReadableBytesModel = HumanReadableBytesModel(0)
         self._tiles_visited_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
@@ -55,6 +87,8 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._tiles_loading_worker_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tiles_loading_main_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tiles_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._visibility_writes_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tileset_update_time_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
 
         self._subscriptions: List[carb.events.ISubscription] = []
         self._setup_subscriptions()
@@ -87,6 +121,30 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._geometries_rendered_model.set_value(render_statistics.geometries_rendered)
         self._triangles_loaded_model.set_value(render_statistics.triangles_loaded)
         self._triangles_rendered_model.set_value(render_statistics.triangles_rendered)
+        self._points_loaded_model.set_value(render_statistics.points_loaded)
+        self._points_rendered_model.set_value(render_statistics.points_rendered)
+        self._geometry_bytes_loaded_model.set_value(render_statistics.geometry_bytes_loaded)
+        self._geometry_bytes_loaded_human_readable_model.set_value(render_statistics.geometry_bytes_loaded)
+        self._geometry_primitives_loaded_model.set_value(render_statistics.geometry_primitives_loaded)
+        self._geometry_primitives_merged_model.set_value(render_statistics.geometry_primitives_merged)
+        self._texture_pool_hits_model.set_value(render_statistics.texture_pool_hits)
+        self._texture_pool_misses_model.set_value(render_statistics.texture_pool_misses)
+        self._texture_bytes_loaded_model.set_value(render_statistics.texture_bytes_loaded)
+        self._texture_bytes_loaded_human_readable_model.set_value(render_statistics.texture_bytes_loaded)
+        self._shared_textures_loaded_model.set_value(render_statistics.shared_textures_loaded)
+        self._shared_texture_hits_model.set_value(render_statistics.shared_texture_hits)
+        self._textures_compressed_model.set_value(render_statistics.textures_compressed)
+        self._texture_compression_saved_model.set_value(
+            render_statistics.texture_compression_input_bytes - render_statistics.texture_compression_output_bytes
+        )
+
+        # Bytes per microsecond is the same as megabytes per second
+        texture_compression_time = render_statistics.texture_compression_time
+        self._texture_compression_throughput_model.set_value(
+            render_statistics.texture_compression_input_bytes // texture_compression_time
+            if texture_compression_time > 0
+            else 0
+        )
         self._tileset_cached_bytes_model.set_value(render_statistics.tileset_cached_bytes)
         self._tileset_cached_bytes_human_readable_model.set_value(render_statistics.tileset_cached_bytes)
         self._tiles_visited_model.set_value(render_statistics.tiles_visited)
@@ -97,6 +155,8 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._tiles_loading_worker_model.set_value(render_statistics.tiles_loading_worker)
         self._tiles_loading_main_model.set_value(render_statistics.tiles_loading_main)
         self._tiles_loaded_model.set_value(render_statistics.tiles_loaded)
+        self._visibility_writes_model.set_value(render_statistics.visibility_writes)
+        self._tileset_update_time_model.set_value(render_statistics.tileset_update_time)
 
     def _build_fn(self):
         """Builds all UI components."""
@@ -114,6 +174,21 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
                 (GEOMETRIES_RENDERED_TEXT, self._geometries_rendered_model),
                 (TRIANGLES_LOADED_TEXT, self._triangles_loaded_model),
                 (TRIANGLES_RENDERED_TEXT, self._triangles_rendered_model),
+                (POINTS_LOADED_TEXT, self._points_loaded_model),
+                (POINTS_RENDERED_TEXT, self._points_rendered_model),
+                (GEOMETRY_BYTES_LOADED_TEXT, self._geometry_bytes_loaded_model),
+                (GEOMETRY_BYTES_LOADED_HUMAN_READABLE_TEXT, self._geometry_bytes_loaded_human_readable_model),
+                (GEOMETRY_PRIMITIVES_LOADED_TEXT, self._geometry_primitives_loaded_model),
+                (GEOMETRY_PRIMITIVES_MERGED_TEXT, self._geometry_primitives_merged_model),
+                (TEXTURE_POOL_HITS_TEXT, self._texture_pool_hits_model),
+                (TEXTURE_POOL_MISSES_TEXT, self._texture_pool_misses_model),
+                (TEXTURE_BYTES_LOADED_TEXT, self._texture_bytes_loaded_model),
+                (TEXTURE_BYTES_LOADED_HUMAN_READABLE_TEXT, self._texture_bytes_loaded_human_readable_model),
+                (SHARED_TEXTURES_LOADED_TEXT, self._shared_textures_loaded_model),
+                (SHARED_TEXTURE_HITS_TEXT, self._shared_texture_hits_model),
+                (TEXTURES_COMPRESSED_TEXT, self._textures_compressed_model),
+                (TEXTURE_COMPRESSION_BYTES_SAVED_HUMAN_READABLE_TEXT, self._texture_compression_saved_model),
+                (TEXTURE_COMPRESSION_THROUGHPUT_TEXT, self._texture_compression_throughput_model),
                 (TILESET_CACHED_BYTES_TEXT, self._tileset_cached_bytes_model),
                 (TILESET_CACHED_BYTES_HUMAN_READABLE_TEXT, self._tileset_cached_bytes_human_readable_model),
                 (TILES_VISITED_TEXT, self._tiles_visited_model),
@@ -124,6 +199,8 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
                 (TILES_LOADING_WORKER_TEXT, self._tiles_loading_worker_model),
                 (TILES_LOADING_MAIN_TEXT, self._tiles_loading_main_model),
                 (TILES_LOADED_TEXT, self._tiles_loaded_model),
+                (VISIBILITY_WRITES_TEXT, self._visibility_writes_model),
+                (TILESET_UPDATE_TIME_TEXT, self._tileset_update_time_model),
             ]:
                 with ui.HStack(height=0):
                     ui.Label(label, height=0)
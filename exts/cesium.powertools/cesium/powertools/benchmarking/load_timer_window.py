@@ -23,6 +23,8 @@ class CesiumLoadTimerWindow(ui.Window):
         self._timer_active = False
         self._tiles_loading_worker_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._load_time_seconds_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tiles_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tiles_per_second_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._past_results_model: ui.SimpleStringModel = ui.SimpleStringModel("")
 
         self._subscriptions: List[carb.events.ISubscription] = []
@@ -70,6 +72,13 @@ class CesiumLoadTimerWindow(ui.Window):
                 time_elapsed = self._end_time - self._start_time
                 self._load_time_seconds_model.set_value(time_elapsed.total_seconds())
 
+                # Tile throughput is the number of tiles loaded so far divided by the elapsed time
+                self._tiles_loaded_model.set_value(render_statistics.tiles_loaded)
+                if time_elapsed.total_seconds() > 0:
+                    self._tiles_per_second_model.set_value(
+                        round(render_statistics.tiles_loaded / time_elapsed.total_seconds(), 1)
+                    )
+
             # If 30 sucessive frames with zero tiles loading occurs, we assume loading has finished
             if render_statistics.tiles_loading_worker == 0:
                 self._zero_counter += 1
@@ -95,12 +104,15 @@ class CesiumLoadTimerWindow(ui.Window):
 
     def _end_load_timer(self):
         self._timer_active = False
-        result_str = f"{self._load_time_seconds_model}\n" + self._past_results_model.get_value_as_string()
+        result_str = (
+            f"{self._load_time_seconds_model} s, {self._tiles_loaded_model} tiles, "
+            f"{self._tiles_per_second_model} tiles/s\n" + self._past_results_model.get_value_as_string()
+        )
         self._past_results_model.set_value(result_str)
 
     @staticmethod
     def create_window():
-        return CesiumLoadTimerWindow(width=300, height=370)
+        return CesiumLoadTimerWindow(width=300, height=420)
 
     def _build_fn(self):
         """Builds out the UI"""
@@ -108,7 +120,8 @@ class CesiumLoadTimerWindow(ui.Window):
         with ui.VStack(spacing=4):
 
             ui.Label(
-                "This tool records the amount of time taken to reload all tilesets in the stage",
+                "This tool records the amount of time taken to reload all tilesets in the stage and the resulting "
+                "tile throughput",
                 word_wrap=True,
             )
 
@@ -125,6 +138,8 @@ class CesiumLoadTimerWindow(ui.Window):
             for label, model in [
                 ("Tiles loading (worker)", self._tiles_loading_worker_model),
                 ("Load time (s)", self._load_time_seconds_model),
+                ("Tiles loaded", self._tiles_loaded_model),
+                ("Tiles per second", self._tiles_per_second_model),
             ]:
 
                 with ui.HStack(height=0):
@@ -27,10 +27,20 @@ class Data(pxr.Usd.Typed):
     @classmethod
     def CreateDebugMaterialPoolInitialCapacityAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateDebugPipelinedTileSelectionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def CreateDebugPoolGrowthFactorAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def CreateDebugPoolLowWaterMarkAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def CreateDebugPoolMaximumIdleTimeAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreateDebugRandomColorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreateDebugTexturePoolInitialCapacityAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateDebugVerifyRenderStatisticsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreateSelectedIonServerRel(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def Define(cls, *args, **kwargs) -> Any: ...
@@ -53,10 +63,20 @@ class Data(pxr.Usd.Typed):
     @classmethod
     def GetDebugMaterialPoolInitialCapacityAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetDebugPipelinedTileSelectionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def GetDebugPoolGrowthFactorAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def GetDebugPoolLowWaterMarkAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
+    def GetDebugPoolMaximumIdleTimeAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetDebugRandomColorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetDebugTexturePoolInitialCapacityAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetDebugVerifyRenderStatisticsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetSchemaAttributeNames(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetSelectedIonServerRel(cls, *args, **kwargs) -> Any: ...
@@ -261,6 +281,8 @@ class RasterOverlay(pxr.Usd.Typed):
     @classmethod
     def CreateSubTileCacheBytesAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateTextureCompressionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def Get(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetAlphaAttr(cls, *args, **kwargs) -> Any: ...
@@ -279,6 +301,8 @@ class RasterOverlay(pxr.Usd.Typed):
     @classmethod
     def GetSubTileCacheBytesAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetTextureCompressionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def _GetStaticTfType(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def __bool__(cls) -> bool: ...
@@ -372,12 +396,16 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def CreateMaximumSimultaneousTileLoadsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateMergePrimitivesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreatePreloadAncestorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreatePreloadSiblingsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreateRasterOverlayBindingRel(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateRenderPointsAsVoxelsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreateShowCreditsOnScreenAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreateSmoothNormalsAttr(cls, *args, **kwargs) -> Any: ...
@@ -386,6 +414,8 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def CreateSuspendUpdateAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateTextureCompressionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreateUrlAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def Define(cls, *args, **kwargs) -> Any: ...
@@ -420,12 +450,16 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def GetMaximumSimultaneousTileLoadsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetMergePrimitivesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetPreloadAncestorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetPreloadSiblingsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetRasterOverlayBindingRel(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetRenderPointsAsVoxelsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetSchemaAttributeNames(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetShowCreditsOnScreenAttr(cls, *args, **kwargs) -> Any: ...
@@ -436,6 +470,8 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def GetSuspendUpdateAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetTextureCompressionAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetUrlAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def _GetStaticTfType(cls, *args, **kwargs) -> Any: ...
@@ -488,10 +524,20 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumDebugMaterialPoolInitialCapacity(self) -> Any: ...
     @property
+    def cesiumDebugPipelinedTileSelection(self) -> Any: ...
+    @property
+    def cesiumDebugPoolGrowthFactor(self) -> Any: ...
+    @property
+    def cesiumDebugPoolLowWaterMark(self) -> Any: ...
+    @property
+    def cesiumDebugPoolMaximumIdleTime(self) -> Any: ...
+    @property
     def cesiumDebugRandomColors(self) -> Any: ...
     @property
     def cesiumDebugTexturePoolInitialCapacity(self) -> Any: ...
     @property
+    def cesiumDebugVerifyRenderStatistics(self) -> Any: ...
+    @property
     def cesiumDisplayName(self) -> Any: ...
     @property
     def cesiumEast(self) -> Any: ...
@@ -550,6 +596,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumMaximumZoomLevel(self) -> Any: ...
     @property
+    def cesiumMergePrimitives(self) -> Any: ...
+    @property
     def cesiumMinimumLevel(self) -> Any: ...
     @property
     def cesiumMinimumZoomLevel(self) -> Any: ...
@@ -568,6 +616,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumRasterOverlayBinding(self) -> Any: ...
     @property
+    def cesiumRenderPointsAsVoxels(self) -> Any: ...
+    @property
     def cesiumRootTilesX(self) -> Any: ...
     @property
     def cesiumRootTilesY(self) -> Any: ...
@@ -594,6 +644,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumSuspendUpdate(self) -> Any: ...
     @property
+    def cesiumTextureCompression(self) -> Any: ...
+    @property
     def cesiumTileHeight(self) -> Any: ...
     @property
     def cesiumTileMatrixSetId(self) -> Any: ...
@@ -612,10 +664,16 @@ class Tokens(Boost.Python.instance):
     @property
     def clip(self) -> Any: ...
     @property
+    def fast(self) -> Any: ...
+    @property
     def ion(self) -> Any: ...
     @property
+    def none(self) -> Any: ...
+    @property
     def overlay(self) -> Any: ...
     @property
+    def quality(self) -> Any: ...
+    @property
     def url(self) -> Any: ...
 
 class WebMapServiceRasterOverlay(RasterOverlay):
@@ -157,7 +157,6 @@ class ICesiumOmniverseInterface {
 
     virtual bool creditsAvailable() noexcept = 0;
     virtual std::vector<std::pair<std::string, bool>> getCredits() noexcept = 0;
-    virtual void creditsStartNextFrame() noexcept = 0;
 
     virtual bool isTracingEnabled() noexcept = 0;
     /**
@@ -71,7 +71,6 @@ PYBIND11_MODULE(CesiumOmniversePythonBindings, m) {
         .def("get_render_statistics", &ICesiumOmniverseInterface::getRenderStatistics)
         .def("credits_available", &ICesiumOmniverseInterface::creditsAvailable)
         .def("get_credits", &ICesiumOmniverseInterface::getCredits)
-        .def("credits_start_next_frame", &ICesiumOmniverseInterface::creditsStartNextFrame)
         .def("is_tracing_enabled", &ICesiumOmniverseInterface::isTracingEnabled)
         .def("clear_accessor_cache", &ICesiumOmniverseInterface::clearAccessorCache);
     // clang-format on
@@ -149,6 +148,20 @@ PYBIND11_MODULE(CesiumOmniversePythonBindings, m) {
         .def_readonly("geometries_rendered", &RenderStatistics::geometriesRendered)
         .def_readonly("triangles_loaded", &RenderStatistics::trianglesLoaded)
         .def_readonly("triangles_rendered", &RenderStatistics::trianglesRendered)
+        .def_readonly("points_loaded", &RenderStatistics::pointsLoaded)
+        .def_readonly("points_rendered", &RenderStatistics::pointsRendered)
+        .def_readonly("geometry_bytes_loaded", &RenderStatistics::geometryBytesLoaded)
+        .def_readonly("geometry_primitives_loaded", &RenderStatistics::geometryPrimitivesLoaded)
+        .def_readonly("geometry_primitives_merged", &RenderStatistics::geometryPrimitivesMerged)
+        .def_readonly("texture_pool_hits", &RenderStatistics::texturePoolHits)
+        .def_readonly("texture_pool_misses", &RenderStatistics::texturePoolMisses)
+        .def_readonly("texture_bytes_loaded", &RenderStatistics::textureBytesLoaded)
+        .def_readonly("shared_textures_loaded", &RenderStatistics::sharedTexturesLoaded)
+        .def_readonly("shared_texture_hits", &RenderStatistics::sharedTextureHits)
+        .def_readonly("textures_compressed", &RenderStatistics::texturesCompressed)
+        .def_readonly("texture_compression_input_bytes", &RenderStatistics::textureCompressionInputBytes)
+        .def_readonly("texture_compression_output_bytes", &RenderStatistics::textureCompressionOutputBytes)
+        .def_readonly("texture_compression_time", &RenderStatistics::textureCompressionTime)
         .def_readonly("tileset_cached_bytes", &RenderStatistics::tilesetCachedBytes)
         .def_readonly("tiles_visited", &RenderStatistics::tilesVisited)
         .def_readonly("culled_tiles_visited", &RenderStatistics::culledTilesVisited)
@@ -157,7 +170,9 @@ PYBIND11_MODULE(CesiumOmniversePythonBindings, m) {
         .def_readonly("max_depth_visited", &RenderStatistics::maxDepthVisited)
         .def_readonly("tiles_loading_worker", &RenderStatistics::tilesLoadingWorker)
         .def_readonly("tiles_loading_main", &RenderStatistics::tilesLoadingMain)
-        .def_readonly("tiles_loaded", &RenderStatistics::tilesLoaded);
+        .def_readonly("tiles_loaded", &RenderStatistics::tilesLoaded)
+        .def_readonly("visibility_writes", &RenderStatistics::visibilityWrites)
+        .def_readonly("tileset_update_time", &RenderStatistics::tilesetUpdateTime);
 
     py::class_<ViewportPythonBinding>(m, "Viewport")
         .def(py::init())
@@ -1,7 +1,13 @@
 #pragma once
 
+#include "cesium/omniverse/PathTrie.h"
+
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/common.h>
 
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include <gsl/span>
@@ -49,6 +55,33 @@ class AssetRegistry {
 
     void onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles);
 
+    /**
+     * @brief Starts selecting tiles on a worker thread for the tilesets that onUpdateFrame prepared in pipelined mode.
+     * The selection is applied by the next onUpdateFrame.
+     *
+     * Tile selection dispatches the main thread tasks of the tileset async system, so this must be called after any
+     * other main thread work that does the same. See Context::getTilesetAsyncSystem.
+     */
+    void startTileSelection();
+
+    /**
+     * @brief Waits for tile selection started by startTileSelection to finish. Must be called before the tilesets are
+     * used outside of onUpdateFrame.
+     */
+    void waitForTileSelection() const;
+
+    /**
+     * @brief Waits for tile selection started by startTileSelection to finish and records the time spent waiting in
+     * the tileset update time. Called from the main thread at the start of each frame.
+     */
+    void finishTileSelection();
+
+    /**
+     * @brief Gets the main thread time in microseconds spent updating tilesets in the last call to onUpdateFrame,
+     * including the time spent waiting for the previous frame's pipelined tile selection to finish.
+     */
+    [[nodiscard]] uint64_t getTilesetUpdateTime() const;
+
     OmniData& addData(const pxr::SdfPath& path);
     void removeData(const pxr::SdfPath& path);
     [[nodiscard]] OmniData* getData(const pxr::SdfPath& path) const;
@@ -108,10 +141,13 @@ class AssetRegistry {
 
     [[nodiscard]] AssetType getAssetType(const pxr::SdfPath& path) const;
     [[nodiscard]] bool hasAsset(const pxr::SdfPath& path) const;
+    [[nodiscard]] std::vector<pxr::SdfPath> getPrimOrDescendantAssetPaths(const pxr::SdfPath& path) const;
 
     void clear();
 
   private:
+    template <typename T> using AssetIndex = std::unordered_map<pxr::SdfPath, T*, pxr::SdfPath::Hash>;
+
     Context* _pContext;
     std::vector<std::unique_ptr<OmniData>> _datas;
     std::vector<std::unique_ptr<OmniTileset>> _tilesets;
@@ -125,7 +161,31 @@ class AssetRegistry {
     std::vector<std::unique_ptr<OmniIonServer>> _ionServers;
     std::vector<std::unique_ptr<OmniCartographicPolygon>> _cartographicPolygons;
 
+    // Path lookups are hash lookups instead of linear scans. The vectors above keep the insertion order.
+    AssetIndex<OmniData> _dataIndex;
+    AssetIndex<OmniTileset> _tilesetIndex;
+    AssetIndex<OmniIonRasterOverlay> _ionRasterOverlayIndex;
+    AssetIndex<OmniPolygonRasterOverlay> _polygonRasterOverlayIndex;
+    AssetIndex<OmniWebMapServiceRasterOverlay> _webMapServiceRasterOverlayIndex;
+    AssetIndex<OmniTileMapServiceRasterOverlay> _tileMapServiceRasterOverlayIndex;
+    AssetIndex<OmniWebMapTileServiceRasterOverlay> _webMapTileServiceRasterOverlayIndex;
+    AssetIndex<OmniRasterOverlay> _rasterOverlayIndex;
+    AssetIndex<OmniGeoreference> _georeferenceIndex;
+    AssetIndex<OmniGlobeAnchor> _globeAnchorIndex;
+    AssetIndex<OmniIonServer> _ionServerIndex;
+    AssetIndex<OmniCartographicPolygon> _cartographicPolygonIndex;
+
+    // Number of asset types registered at each path. A prim may be registered as more than one asset type, e.g. a
+    // tileset with a globe anchor.
+    PathTrie<uint64_t> _assetPaths;
+
     int64_t _tilesetId{0};
+
+    // Declared after the tilesets so that selection is finished before they're destroyed
+    std::vector<OmniTileset*> _selectingTilesets;
+    mutable pxr::WorkDispatcher _tileSelectionDispatcher;
+    uint64_t _tilesetUpdateTime{0};
+    uint64_t _tileSelectionWaitTime{0};
 };
 
 } // namespace cesium::omniverse
@@ -3,7 +3,12 @@
 #include <pxr/usd/usd/common.h>
 
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <gsl/span>
@@ -48,6 +53,15 @@ class Context {
 
     [[nodiscard]] std::shared_ptr<TaskProcessor> getTaskProcessor() const;
     [[nodiscard]] const CesiumAsync::AsyncSystem& getAsyncSystem() const;
+
+    /**
+     * @brief Gets the async system used by tilesets and their raster overlays.
+     *
+     * Tileset::updateView dispatches the main thread tasks of its async system, which may happen on a worker thread
+     * during pipelined tile selection. Tilesets therefore don't share a main thread task queue with the ion session,
+     * whose continuations write to USD and update state read by the UI.
+     */
+    [[nodiscard]] const CesiumAsync::AsyncSystem& getTilesetAsyncSystem() const;
     [[nodiscard]] std::shared_ptr<CesiumAsync::IAssetAccessor> getAssetAccessor() const;
     [[nodiscard]] std::shared_ptr<CesiumUtility::CreditSystem> getCreditSystem() const;
     [[nodiscard]] std::shared_ptr<Logger> getLogger() const;
@@ -65,6 +79,20 @@ class Context {
     void onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles);
     void onUsdStageChanged(int64_t stageId);
 
+    /**
+     * @brief Runs a task on the main thread. The task runs immediately when called from the main thread. Otherwise
+     * it's queued and run at the start of the next onUpdateFrame, so it must not capture anything that could be
+     * destroyed before then.
+     */
+    void runInMainThread(std::function<void()> task);
+
+    /**
+     * @brief Gets the credits to show, as HTML and whether they should be shown on screen. The credits are
+     * snapshotted once per frame on the main thread so that they can be read while tiles are being selected on a
+     * worker thread.
+     */
+    [[nodiscard]] const std::vector<std::pair<std::string, bool>>& getCredits() const;
+
     [[nodiscard]] const pxr::UsdStageWeakPtr& getUsdStage() const;
     [[nodiscard]] pxr::UsdStageWeakPtr& getUsdStage();
     [[nodiscard]] int64_t getUsdStageId() const;
@@ -76,12 +104,16 @@ class Context {
     [[nodiscard]] int64_t getContextId() const;
 
   private:
+    void runMainThreadTasks();
+    void updateCredits();
+
     std::filesystem::path _cesiumExtensionLocation;
     std::filesystem::path _certificatePath;
     pxr::TfToken _cesiumMdlPathToken;
 
     std::shared_ptr<TaskProcessor> _pTaskProcessor;
     std::unique_ptr<CesiumAsync::AsyncSystem> _pAsyncSystem;
+    std::unique_ptr<CesiumAsync::AsyncSystem> _pTilesetAsyncSystem;
     std::shared_ptr<Logger> _pLogger;
     std::shared_ptr<CesiumAsync::IAssetAccessor> _pAssetAccessor;
     std::shared_ptr<CesiumAsync::ICacheDatabase> _pCacheDatabase;
@@ -93,6 +125,11 @@ class Context {
 
     int64_t _contextId;
 
+    std::thread::id _mainThreadId;
+    std::mutex _mainThreadTasksMutex;
+    std::vector<std::function<void()>> _mainThreadTasks;
+    std::vector<std::pair<std::string, bool>> _credits;
+
     pxr::UsdStageWeakPtr _pUsdStage;
     std::unique_ptr<omni::fabric::StageReaderWriter> _pFabricStage;
     int64_t _usdStageId{0};
@@ -96,6 +96,17 @@ template <typename T> void append(std::vector<T>& vector, const std::vector<T>&
     vector.insert(vector.end(), append.begin(), append.end());
 }
 
+// Same mixing function as boost::hash_combine
+template <typename T> void hashCombine(uint64_t& seed, const T& value) {
+    seed ^= static_cast<uint64_t>(std::hash<T>{}(value)) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+template <typename... T> uint64_t hashValues(const T&... values) {
+    uint64_t seed = 0;
+    (hashCombine(seed, values), ...);
+    return seed;
+}
+
 template <typename T, typename F> constexpr auto hasMemberImpl(F&& f) -> decltype(f(std::declval<T>()), true) {
     return true;
 }
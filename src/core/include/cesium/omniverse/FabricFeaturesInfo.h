@@ -18,10 +18,24 @@ struct FabricFeatureId {
     std::optional<uint64_t> nullFeatureId;
     uint64_t featureCount;
     std::variant<std::monostate, uint64_t, FabricTextureInfo> featureIdStorage;
+
+    // Make sure to update this function when adding new fields to the struct
+    // In C++ 20 we can use the default equality comparison (= default)
+    // clang-format off
+    bool operator==(const FabricFeatureId& other) const {
+        return nullFeatureId == other.nullFeatureId &&
+               featureCount == other.featureCount &&
+               featureIdStorage == other.featureIdStorage;
+    }
+    // clang-format on
 };
 
 struct FabricFeaturesInfo {
     std::vector<FabricFeatureId> featureIds;
+
+    bool operator==(const FabricFeaturesInfo& other) const {
+        return featureIds == other.featureIds;
+    }
 };
 
 } // namespace cesium::omniverse
@@ -1,10 +1,15 @@
 #pragma once
 
+#include "cesium/omniverse/FabricGeometryData.h"
 #include "cesium/omniverse/FabricGeometryDescriptor.h"
+#include "cesium/omniverse/FabricStatistics.h"
 
 #include <glm/fwd.hpp>
 #include <omni/fabric/IPath.h>
 
+#include <memory>
+#include <unordered_map>
+
 namespace CesiumGltf {
 struct MeshPrimitive;
 struct Model;
@@ -25,13 +30,14 @@ class FabricGeometry {
     ~FabricGeometry();
     FabricGeometry(const FabricGeometry&) = delete;
     FabricGeometry& operator=(const FabricGeometry&) = delete;
-    FabricGeometry(FabricGeometry&&) noexcept = default;
-    FabricGeometry& operator=(FabricGeometry&&) noexcept = default;
+    FabricGeometry(FabricGeometry&&) noexcept = delete;
+    FabricGeometry& operator=(FabricGeometry&&) noexcept = delete;
 
-    void setGeometry(
-        int64_t tilesetId,
-        const glm::dmat4& ecefToPrimWorldTransform,
-        const glm::dmat4& gltfLocalToEcefTransform,
+    /**
+     * @brief Computes the Fabric-ready vertex buffers for a glTF primitive. This is safe to call from a worker thread.
+     */
+    static FabricGeometryData computeGeometryData(
+        const FabricGeometryDescriptor& geometryDescriptor,
         const CesiumGltf::Model& model,
         const CesiumGltf::MeshPrimitive& primitive,
         const FabricMaterialInfo& materialInfo,
@@ -39,8 +45,21 @@ class FabricGeometry {
         const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
         const std::unordered_map<uint64_t, uint64_t>& rasterOverlayTexcoordIndexMapping);
 
+    void setGeometry(
+        int64_t tilesetId,
+        const glm::dmat4& ecefToPrimWorldTransform,
+        const glm::dmat4& gltfLocalToEcefTransform,
+        const FabricGeometryData& geometryData);
+
+    void initialize();
     void setActive(bool active);
-    void setVisibility(bool visible);
+
+    /**
+     * @brief Records whether the geometry is rendered so that the render statistics stay up to date.
+     *
+     * The visibility itself is written to Fabric in batches by {@link FabricUtil::setVisibility}.
+     */
+    void setRendered(bool rendered);
 
     [[nodiscard]] const omni::fabric::Path& getPath() const;
     [[nodiscard]] const FabricGeometryDescriptor& getGeometryDescriptor() const;
@@ -49,8 +68,10 @@ class FabricGeometry {
     void setMaterial(const omni::fabric::Path& materialPath);
 
   private:
-    void initialize();
+    void createPrim();
     void reset();
+    void setTilesetTag(int64_t tilesetId);
+    void updateStatistics();
     bool stageDestroyed();
 
     Context* _pContext;
@@ -58,6 +79,16 @@ class FabricGeometry {
     FabricGeometryDescriptor _geometryDescriptor;
     int64_t _poolId;
     int64_t _stageId;
+    int64_t _tilesetTagId;
+    bool _initialized{false};
+
+    // This geometry's contribution to the render statistics
+    std::shared_ptr<FabricStatisticsCounter> _pStatisticsCounter;
+    FabricStatistics _statistics;
+    uint64_t _elementCount{0};
+    uint64_t _byteSize{0};
+    bool _loaded{false};
+    bool _rendered{false};
 };
 
 } // namespace cesium::omniverse
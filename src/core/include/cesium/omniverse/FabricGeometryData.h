@@ -0,0 +1,40 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace cesium::omniverse {
+
+/**
+* @brief Fabric-ready vertex buffers for a {@link FabricGeometry}.
+*
+* The buffers are computed in a worker thread so that the main thread only needs to copy them into Fabric.
+* Index conversion, normal generation, texcoord flipping, and point cloud voxel expansion have already been applied.
+* Point clouds that are rendered as native points have no face vertex counts or indices.
+*/
+struct FabricGeometryData {
+    std::vector<glm::fvec3> points;
+    std::vector<int> faceVertexCounts;
+    std::vector<int> faceVertexIndices;
+    std::vector<glm::fvec3> normals;
+    std::vector<glm::fvec4> vertexColors;
+    std::vector<float> vertexIds;
+
+    // Only used by point clouds
+    std::vector<float> widths;
+
+    // Indexed by primvar st index
+    std::vector<std::vector<glm::fvec2>> texcoords;
+
+    // Same order as FabricGeometryDescriptor::getCustomVertexAttributes. Values are stored as the Fabric primvar type.
+    std::vector<std::vector<std::byte>> customVertexAttributes;
+
+    std::optional<std::array<glm::dvec3, 2>> extent;
+    bool doubleSided{false};
+};
+
+} // namespace cesium::omniverse
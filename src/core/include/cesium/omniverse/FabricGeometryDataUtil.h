@@ -0,0 +1,27 @@
+#pragma once
+
+#include <glm/fwd.hpp>
+
+namespace cesium::omniverse {
+struct FabricGeometryData;
+} // namespace cesium::omniverse
+
+namespace cesium::omniverse::FabricGeometryDataUtil {
+
+/**
+ * @brief Appends the vertex buffers of another primitive so that both primitives are drawn as one mesh.
+ *
+ * Points are transformed by otherToLocalTransform and normals by its inverse transpose. Face vertex indices are
+ * offset by the existing vertex count. Vertex IDs are not offset so that feature IDs of type INDEX still refer to
+ * vertices of the original primitive. A vertex attribute that only one side has is padded with zeros.
+ *
+ * @param geometryData The geometry data to append to. May be empty.
+ * @param otherGeometryData The geometry data to append. Must have the same geometry descriptor.
+ * @param otherToLocalTransform The transform from the other primitive's glTF local space to this one's.
+ */
+void appendGeometryData(
+    FabricGeometryData& geometryData,
+    const FabricGeometryData& otherGeometryData,
+    const glm::dmat4& otherToLocalTransform);
+
+} // namespace cesium::omniverse::FabricGeometryDataUtil
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <set>
 
 namespace CesiumGltf {
@@ -10,7 +11,7 @@ struct Model;
 
 namespace cesium::omniverse {
 
-struct FabricFeaturesInfo;
+struct FabricPrimitiveInfo;
 struct FabricVertexAttributeDescriptor;
 
 /**
@@ -28,9 +29,11 @@ class FabricGeometryDescriptor {
     FabricGeometryDescriptor(
         const CesiumGltf::Model& model,
         const CesiumGltf::MeshPrimitive& primitive,
-        const FabricFeaturesInfo& featuresInfo,
-        bool smoothNormals);
+        const FabricPrimitiveInfo& primitiveInfo,
+        bool smoothNormals,
+        bool renderPointsAsVoxels);
 
+    [[nodiscard]] bool isPointCloud() const;
     [[nodiscard]] bool hasNormals() const;
     [[nodiscard]] bool hasVertexColors() const;
     [[nodiscard]] bool hasVertexIds() const;
@@ -40,6 +43,9 @@ class FabricGeometryDescriptor {
     bool operator==(const FabricGeometryDescriptor& other) const;
 
   private:
+    // Point clouds are rendered as native points unless renderPointsAsVoxels is true, in which case they are
+    // expanded into voxel meshes
+    bool _isPointCloud{false};
     bool _hasNormals{false};
     bool _hasVertexColors{false};
     bool _hasVertexIds{false};
@@ -51,3 +57,7 @@ class FabricGeometryDescriptor {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricGeometryDescriptor> {
+    size_t operator()(const cesium::omniverse::FabricGeometryDescriptor& geometryDescriptor) const noexcept;
+};
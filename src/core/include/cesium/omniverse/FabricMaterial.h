@@ -2,10 +2,12 @@
 
 #include "cesium/omniverse/FabricMaterialDescriptor.h"
 #include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricStatistics.h"
 
 #include <glm/glm.hpp>
 #include <omni/fabric/IPath.h>
 
+#include <memory>
 #include <unordered_map>
 
 namespace omni::fabric {
@@ -20,6 +22,7 @@ namespace cesium::omniverse {
 
 class FabricTexture;
 enum class MdlInternalPropertyType;
+struct FabricPrimitiveInfo;
 struct FabricPropertyDescriptor;
 struct FabricTextureInfo;
 
@@ -36,15 +39,14 @@ class FabricMaterial {
     ~FabricMaterial();
     FabricMaterial(const FabricMaterial&) = delete;
     FabricMaterial& operator=(const FabricMaterial&) = delete;
-    FabricMaterial(FabricMaterial&&) noexcept = default;
-    FabricMaterial& operator=(FabricMaterial&&) noexcept = default;
+    FabricMaterial(FabricMaterial&&) noexcept = delete;
+    FabricMaterial& operator=(FabricMaterial&&) noexcept = delete;
 
     void setMaterial(
         const CesiumGltf::Model& model,
         const CesiumGltf::MeshPrimitive& primitive,
         int64_t tilesetId,
-        const FabricMaterialInfo& materialInfo,
-        const FabricFeaturesInfo& featuresInfo,
+        const FabricPrimitiveInfo& primitiveInfo,
         FabricTexture* pBaseColorTexture,
         const std::vector<std::shared_ptr<FabricTexture>>& featureIdTextures,
         const std::vector<std::shared_ptr<FabricTexture>>& propertyTextures,
@@ -54,8 +56,7 @@ class FabricMaterial {
         const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
         const std::vector<uint64_t>& featureIdIndexSetIndexMapping,
         const std::vector<uint64_t>& featureIdAttributeSetIndexMapping,
-        const std::vector<uint64_t>& featureIdTextureSetIndexMapping,
-        const std::unordered_map<uint64_t, uint64_t>& propertyTextureIndexMapping);
+        const std::vector<uint64_t>& featureIdTextureSetIndexMapping);
 
     void setRasterOverlay(
         FabricTexture* pTexture,
@@ -68,6 +69,7 @@ class FabricMaterial {
     void setDisplayColorAndOpacity(const glm::dvec3& displayColor, double displayOpacity);
     void updateShaderInput(const omni::fabric::Path& shaderPath, const omni::fabric::Token& attributeName);
     void clearRasterOverlay(uint64_t rasterOverlayIndex);
+    void initialize();
     void setActive(bool active);
 
     [[nodiscard]] const omni::fabric::Path& getPath() const;
@@ -186,6 +188,7 @@ class FabricMaterial {
     void createConnectionsToProperties();
     void destroyConnectionsToProperties();
 
+    void updateStatistics();
     bool stageDestroyed();
 
     Context* _pContext;
@@ -197,6 +200,12 @@ class FabricMaterial {
     int64_t _poolId;
     int64_t _stageId;
     bool _usesDefaultMaterial;
+    bool _initialized{false};
+
+    // This material's contribution to the render statistics
+    std::shared_ptr<FabricStatisticsCounter> _pStatisticsCounter;
+    FabricStatistics _statistics;
+    bool _loaded{false};
 
     FabricAlphaMode _alphaMode{FabricAlphaMode::OPAQUE};
     glm::dvec3 _debugColor{1.0, 1.0, 1.0};
@@ -2,19 +2,14 @@
 
 #include <pxr/usd/sdf/path.h>
 
-namespace CesiumGltf {
-struct Model;
-struct MeshPrimitive;
-} // namespace CesiumGltf
+#include <functional>
 
 namespace cesium::omniverse {
 
-class Context;
 enum class FabricFeatureIdType;
 enum class FabricOverlayRenderMethod;
-struct FabricFeaturesInfo;
+struct FabricPrimitiveInfo;
 struct FabricRasterOverlaysInfo;
-struct FabricMaterialInfo;
 struct FabricPropertyDescriptor;
 
 /**
@@ -31,11 +26,7 @@ struct FabricPropertyDescriptor;
 class FabricMaterialDescriptor {
   public:
     FabricMaterialDescriptor(
-        const Context& context,
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const FabricMaterialInfo& materialInfo,
-        const FabricFeaturesInfo& featuresInfo,
+        const FabricPrimitiveInfo& primitiveInfo,
         const FabricRasterOverlaysInfo& rasterOverlaysInfo,
         const pxr::SdfPath& tilesetMaterialPath);
 
@@ -61,3 +52,7 @@ class FabricMaterialDescriptor {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricMaterialDescriptor> {
+    size_t operator()(const cesium::omniverse::FabricMaterialDescriptor& materialDescriptor) const noexcept;
+};
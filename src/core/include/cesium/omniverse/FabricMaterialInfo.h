@@ -56,3 +56,32 @@ struct FabricMaterialInfo {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricMaterialInfo> {
+    // Make sure to update this function when adding new fields to the struct
+    size_t operator()(const cesium::omniverse::FabricMaterialInfo& materialInfo) const noexcept {
+        using namespace cesium::omniverse;
+
+        auto seed = CppUtil::hashValues(
+            materialInfo.alphaCutoff,
+            materialInfo.alphaMode,
+            materialInfo.baseAlpha,
+            materialInfo.baseColorFactor.x,
+            materialInfo.baseColorFactor.y,
+            materialInfo.baseColorFactor.z,
+            materialInfo.emissiveFactor.x,
+            materialInfo.emissiveFactor.y,
+            materialInfo.emissiveFactor.z,
+            materialInfo.metallicFactor,
+            materialInfo.roughnessFactor,
+            materialInfo.doubleSided,
+            materialInfo.hasVertexColors,
+            materialInfo.baseColorTexture.has_value());
+
+        if (materialInfo.baseColorTexture.has_value()) {
+            CppUtil::hashCombine(seed, materialInfo.baseColorTexture.value());
+        }
+
+        return static_cast<size_t>(seed);
+    }
+};
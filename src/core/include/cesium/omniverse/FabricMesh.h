@@ -1,7 +1,6 @@
 #pragma once
 
-#include "cesium/omniverse/FabricFeaturesInfo.h"
-#include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 
 #include <memory>
 #include <unordered_map>
@@ -27,14 +26,15 @@ struct FabricMesh {
     std::vector<std::shared_ptr<FabricTexture>> featureIdTextures;
     std::vector<std::shared_ptr<FabricTexture>> propertyTextures;
     std::vector<std::shared_ptr<FabricTexture>> propertyTableTextures;
-    FabricMaterialInfo materialInfo;
-    FabricFeaturesInfo featuresInfo;
+    FabricPrimitiveInfo primitiveInfo;
     std::unordered_map<uint64_t, uint64_t> texcoordIndexMapping;
     std::unordered_map<uint64_t, uint64_t> rasterOverlayTexcoordIndexMapping;
     std::vector<uint64_t> featureIdIndexSetIndexMapping;
     std::vector<uint64_t> featureIdAttributeSetIndexMapping;
     std::vector<uint64_t> featureIdTextureSetIndexMapping;
-    std::unordered_map<uint64_t, uint64_t> propertyTextureIndexMapping;
+
+    // The number of glTF primitives drawn by this mesh. Greater than one if primitives were merged.
+    uint64_t primitiveCount{1};
 };
 
 } // namespace cesium::omniverse
@@ -7,20 +7,29 @@
 
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace cesium::omniverse {
 
 class Context;
 struct FabricMesh;
+struct FabricRenderResources;
 class OmniTileset;
+struct TilesetSettings;
 
 class FabricPrepareRenderResources final : public Cesium3DTilesSelection::IPrepareRendererResources {
   public:
     FabricPrepareRenderResources(Context* pContext, OmniTileset* pTileset);
-    ~FabricPrepareRenderResources() override = default;
+    ~FabricPrepareRenderResources() override;
     FabricPrepareRenderResources(const FabricPrepareRenderResources&) = delete;
     FabricPrepareRenderResources& operator=(const FabricPrepareRenderResources&) = delete;
-    FabricPrepareRenderResources(FabricPrepareRenderResources&&) noexcept = default;
-    FabricPrepareRenderResources& operator=(FabricPrepareRenderResources&&) noexcept = default;
+    FabricPrepareRenderResources(FabricPrepareRenderResources&&) noexcept = delete;
+    FabricPrepareRenderResources& operator=(FabricPrepareRenderResources&&) noexcept = delete;
 
     CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources> prepareInLoadThread(
         const CesiumAsync::AsyncSystem& asyncSystem,
@@ -56,12 +65,48 @@ class FabricPrepareRenderResources final : public Cesium3DTilesSelection::IPrepa
         const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
         void* pMainThreadRendererResources) noexcept override;
 
+    /**
+     * @brief Writes the geometry and materials of tiles prepared since the last call to Fabric.
+     *
+     * prepareInMainThread only queues Fabric writes. They are applied here in one pass so that tileset state
+     * shared by all tiles is resolved once per frame rather than once per tile. Writes deferred by callbacks that ran
+     * off the main thread are applied first.
+     *
+     * @param timeBudget The time budget in milliseconds. Tiles that don't fit in the budget are written in a
+     * later frame. A value of 0 or less writes all pending tiles.
+     */
+    void commitFabricMeshes(double timeBudget);
+
+    /**
+     * @brief Sets the tileset settings snapshot used by subsequent tile loads. Called from the main thread.
+     */
+    void setSettings(std::shared_ptr<const TilesetSettings> pSettings);
+
+    /**
+     * @brief Sets whether the tileset prim still exists. Called from the main thread once per frame.
+     */
+    void setTilesetExists(bool tilesetExists);
+
     [[nodiscard]] bool tilesetExists() const;
     void detachTileset();
 
   private:
+    struct PendingFabricMeshes;
+
+    [[nodiscard]] std::shared_ptr<const TilesetSettings> getSettings() const;
+    void flushFabricMeshes(const FabricRenderResources* pRenderResources);
+    void runFabricWrite(std::function<void()> fabricWrite);
+    void flushFabricWrites();
+
     Context* _pContext;
     OmniTileset* _pTileset;
+    mutable std::mutex _settingsMutex;
+    std::shared_ptr<const TilesetSettings> _pSettings;
+    std::atomic<bool> _tilesetExists{true};
+    std::vector<std::unique_ptr<PendingFabricMeshes>> _pendingFabricMeshes;
+    std::thread::id _mainThreadId;
+    std::mutex _fabricWritesMutex;
+    std::vector<std::function<void()>> _deferredFabricWrites;
 };
 
 } // namespace cesium::omniverse
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "cesium/omniverse/FabricFeaturesInfo.h"
+#include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricPropertyDescriptor.h"
+#include "cesium/omniverse/FabricTextureDescriptor.h"
+#include "cesium/omniverse/FabricVertexAttributeDescriptor.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CesiumGltf {
+struct ImageCesium;
+} // namespace CesiumGltf
+
+namespace cesium::omniverse {
+
+class FabricTexture;
+
+/**
+ * @brief A texture that holds the values of one or more styleable property table properties.
+ *
+ * Properties that share a texture format are packed one after another into the same texture. The content holds the
+ * type, size and raw values of each property, and the values are only encoded when no texture with the same content
+ * is shared yet. See {@link FabricResourceManager::acquireSharedTexture}.
+ */
+struct FabricPropertyTableTexture {
+    uint64_t contentHash;
+    std::vector<std::byte> content;
+    FabricTextureDescriptor textureDescriptor;
+    std::function<void(FabricTexture& texture)> setTexture;
+};
+
+/**
+ * @brief Where a styleable property table property is stored within its {@link FabricPropertyTableTexture}.
+ */
+struct FabricPropertyTableTextureRegion {
+    uint64_t textureIndex;
+    uint64_t texelOffset;
+};
+
+/**
+ * @brief Everything the tile prepare pipeline derives from a glTF primitive.
+ *
+ * The record is built once per primitive in the worker thread and is reused when constructing the geometry and
+ * material descriptors, acquiring textures, computing vertex buffers, and setting material values, so that the glTF
+ * attributes and the structural metadata schema are only walked once.
+ */
+struct FabricPrimitiveInfo {
+    FabricMaterialInfo materialInfo;
+    FabricFeaturesInfo featuresInfo;
+    std::vector<uint64_t> texcoordSetIndexes;
+    std::vector<uint64_t> rasterOverlayTexcoordSetIndexes;
+    std::set<FabricVertexAttributeDescriptor> customVertexAttributes;
+
+    // Styleable properties are only gathered when the primitive has a material and the tileset has a material
+    std::vector<FabricPropertyDescriptor> styleableProperties;
+    std::map<std::string, std::string> unsupportedPropertyWarnings;
+
+    // Unique property texture images, and the mapping from glTF texture index to the index in this list
+    std::vector<const CesiumGltf::ImageCesium*> propertyTextureImages;
+    std::unordered_map<uint64_t, uint64_t> propertyTextureIndexMapping;
+
+    // Textures are cleared once they are acquired. Regions are in the order the properties are visited.
+    std::vector<FabricPropertyTableTexture> propertyTableTextures;
+    std::vector<FabricPropertyTableTextureRegion> propertyTableTextureRegions;
+};
+
+} // namespace cesium::omniverse
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/DataType.h"
 
 #include <string>
@@ -31,3 +32,14 @@ struct FabricPropertyDescriptor {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricPropertyDescriptor> {
+    // Make sure to update this function when adding new fields to the struct
+    size_t operator()(const cesium::omniverse::FabricPropertyDescriptor& propertyDescriptor) const noexcept {
+        return static_cast<size_t>(cesium::omniverse::CppUtil::hashValues(
+            propertyDescriptor.storageType,
+            propertyDescriptor.type,
+            propertyDescriptor.propertyId,
+            propertyDescriptor.featureIdSetIndex));
+    }
+};
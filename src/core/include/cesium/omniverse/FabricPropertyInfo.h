@@ -32,6 +32,7 @@ template <DataType T> struct FabricPropertyTexturePropertyInfo {
 template <DataType T> struct FabricPropertyTablePropertyInfo {
     static constexpr auto Type = T;
     uint64_t featureIdSetIndex;
+    int32_t valuesBufferView;
     FabricPropertyInfo<T> propertyInfo;
 };
 
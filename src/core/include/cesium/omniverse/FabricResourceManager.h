@@ -1,11 +1,21 @@
 #pragma once
 
+#include "cesium/omniverse/FabricGeometryDescriptor.h"
+#include "cesium/omniverse/FabricMaterialDescriptor.h"
 #include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricStatistics.h"
+#include "cesium/omniverse/FabricTextureDescriptor.h"
 
+#include <gsl/span>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/common.h>
 
 #include <atomic>
+#include <cstddef>
+#include <functional>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace CesiumGltf {
@@ -25,13 +35,13 @@ class FabricGeometry;
 class FabricGeometryPool;
 class FabricMaterial;
 class FabricMaterialPool;
-class FabricGeometryDescriptor;
-class FabricMaterialDescriptor;
 class FabricTexture;
 class FabricTexturePool;
-struct FabricFeaturesInfo;
+struct FabricPrimitiveInfo;
 struct FabricRasterOverlaysInfo;
 
+template <typename T> class ObjectPool;
+
 class FabricResourceManager {
   public:
     FabricResourceManager(Context* pContext);
@@ -44,26 +54,38 @@ class FabricResourceManager {
     bool shouldAcquireMaterial(
         const CesiumGltf::MeshPrimitive& primitive,
         bool hasRasterOverlay,
-        const pxr::SdfPath& tilesetMaterialPath) const;
+        const pxr::SdfPath& tilesetMaterialPath);
 
     bool getDisableTextures() const;
 
     std::shared_ptr<FabricGeometry> acquireGeometry(
         const CesiumGltf::Model& model,
         const CesiumGltf::MeshPrimitive& primitive,
-        const FabricFeaturesInfo& featuresInfo,
-        bool smoothNormals);
+        const FabricPrimitiveInfo& primitiveInfo,
+        bool smoothNormals,
+        bool renderPointsAsVoxels);
 
     std::shared_ptr<FabricMaterial> acquireMaterial(
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const FabricMaterialInfo& materialInfo,
-        const FabricFeaturesInfo& featuresInfo,
+        const FabricPrimitiveInfo& primitiveInfo,
         const FabricRasterOverlaysInfo& rasterOverlaysInfo,
         int64_t tilesetId,
         const pxr::SdfPath& tilesetMaterialPath);
 
-    std::shared_ptr<FabricTexture> acquireTexture();
+    std::shared_ptr<FabricTexture> acquireTexture(const FabricTextureDescriptor& textureDescriptor);
+
+    /**
+     * @brief Acquires a texture that is shared by everything with the same content.
+     *
+     * The texture is reference counted and goes back to its pool when the last user calls {@link releaseTexture}.
+     * The content hash only selects the cache entry. The content bytes, which together with the descriptor must fully
+     * determine the texture, are compared on a hit and a private texture is returned if a different content has the
+     * same hash. setTexture is only called when no texture with the same content exists yet.
+     */
+    std::shared_ptr<FabricTexture> acquireSharedTexture(
+        uint64_t contentHash,
+        gsl::span<const std::byte> content,
+        const FabricTextureDescriptor& textureDescriptor,
+        const std::function<void(FabricTexture& texture)>& setTexture);
 
     void releaseGeometry(std::shared_ptr<FabricGeometry> pGeometry);
     void releaseMaterial(std::shared_ptr<FabricMaterial> pMaterial);
@@ -77,16 +99,62 @@ class FabricResourceManager {
     void setGeometryPoolInitialCapacity(uint64_t geometryPoolInitialCapacity);
     void setMaterialPoolInitialCapacity(uint64_t materialPoolInitialCapacity);
     void setTexturePoolInitialCapacity(uint64_t texturePoolInitialCapacity);
+    void setPoolGrowthFactor(double poolGrowthFactor);
+    void setPoolLowWaterMark(uint64_t poolLowWaterMark);
+    void setPoolMaximumIdleTime(double poolMaximumIdleTime);
     void setDebugRandomColors(bool debugRandomColors);
 
+    /**
+     * @brief Records an image that was compressed on a worker thread. See {@link TextureCompressionUtil}.
+     */
+    void addCompressedTexture(uint64_t inputByteLength, uint64_t outputByteLength, uint64_t encodeTime);
+
+    /**
+     * @brief Records the glTF primitives drawn by a mesh that was loaded or freed. primitiveCount is greater than one
+     * if primitives were merged.
+     */
+    void addGeometryPrimitives(uint64_t primitiveCount);
+    void removeGeometryPrimitives(uint64_t primitiveCount);
+
+    [[nodiscard]] uint64_t getGeometryPrimitivesLoaded() const;
+    [[nodiscard]] uint64_t getGeometryPrimitivesMerged() const;
+    [[nodiscard]] uint64_t getTexturePoolHits() const;
+    [[nodiscard]] uint64_t getTexturePoolMisses() const;
+    [[nodiscard]] uint64_t getTextureBytesLoaded() const;
+    [[nodiscard]] uint64_t getSharedTexturesLoaded() const;
+    [[nodiscard]] uint64_t getSharedTextureHits() const;
+    [[nodiscard]] uint64_t getTexturesCompressed() const;
+    [[nodiscard]] uint64_t getTextureCompressionInputBytes() const;
+    [[nodiscard]] uint64_t getTextureCompressionOutputBytes() const;
+    [[nodiscard]] uint64_t getTextureCompressionTime() const;
+    [[nodiscard]] FabricStatistics getStatistics() const;
+    [[nodiscard]] const std::shared_ptr<FabricStatisticsCounter>& getStatisticsCounter() const;
+
     void updateShaderInput(
         const pxr::SdfPath& materialPath,
         const pxr::SdfPath& shaderPath,
-        const pxr::TfToken& attributeName) const;
+        const pxr::TfToken& attributeName);
+
+    void initializePendingResources();
+
+    void onUpdateFrame();
 
     void clear();
 
   private:
+    struct SharedMaterialKey {
+        FabricMaterialInfo materialInfo;
+        int64_t tilesetId;
+
+        bool operator==(const SharedMaterialKey& other) const {
+            return materialInfo == other.materialInfo && tilesetId == other.tilesetId;
+        }
+    };
+
+    struct SharedMaterialKeyHash {
+        size_t operator()(const SharedMaterialKey& key) const noexcept;
+    };
+
     struct SharedMaterial {
         SharedMaterial() = default;
         ~SharedMaterial() = default;
@@ -96,8 +164,32 @@ class FabricResourceManager {
         SharedMaterial& operator=(SharedMaterial&&) noexcept = default;
 
         std::shared_ptr<FabricMaterial> pMaterial;
-        FabricMaterialInfo materialInfo;
-        int64_t tilesetId;
+        uint64_t referenceCount;
+    };
+
+    struct SharedTextureKey {
+        uint64_t contentHash;
+        FabricTextureDescriptor textureDescriptor;
+
+        bool operator==(const SharedTextureKey& other) const {
+            return contentHash == other.contentHash && textureDescriptor == other.textureDescriptor;
+        }
+    };
+
+    struct SharedTextureKeyHash {
+        size_t operator()(const SharedTextureKey& key) const noexcept;
+    };
+
+    struct SharedTexture {
+        SharedTexture() = default;
+        ~SharedTexture() = default;
+        SharedTexture(const SharedTexture&) = delete;
+        SharedTexture& operator=(const SharedTexture&) = delete;
+        SharedTexture(SharedTexture&&) noexcept = default;
+        SharedTexture& operator=(SharedTexture&&) noexcept = default;
+
+        std::shared_ptr<FabricTexture> pTexture;
+        std::vector<std::byte> content;
         uint64_t referenceCount;
     };
 
@@ -109,10 +201,18 @@ class FabricResourceManager {
         int64_t tilesetId);
     void releaseSharedMaterial(const FabricMaterial& material);
     bool isSharedMaterial(const FabricMaterial& material) const;
+    void releaseSharedTexture(const FabricTexture& texture);
+    bool isSharedTexture(const FabricTexture& texture) const;
+    void releaseTextureToPool(std::shared_ptr<FabricTexture> pTexture);
 
     std::shared_ptr<FabricGeometry> acquireGeometryFromPool(const FabricGeometryDescriptor& geometryDescriptor);
     std::shared_ptr<FabricMaterial> acquireMaterialFromPool(const FabricMaterialDescriptor& materialDescriptor);
-    std::shared_ptr<FabricTexture> acquireTextureFromPool();
+    std::shared_ptr<FabricTexture> acquireTextureFromPool(const FabricTextureDescriptor& textureDescriptor);
+
+    template <typename T> void initializePool(ObjectPool<T>& pool) const;
+
+    void updateTilesetMaterials();
+    void trimPools();
 
     FabricGeometryPool* getGeometryPool(const FabricGeometry& geometry) const;
     FabricMaterialPool* getMaterialPool(const FabricMaterial& material) const;
@@ -125,9 +225,13 @@ class FabricResourceManager {
     int64_t getNextMaterialPoolId();
     int64_t getNextTexturePoolId();
 
-    std::vector<std::unique_ptr<FabricGeometryPool>> _geometryPools;
-    std::vector<std::unique_ptr<FabricMaterialPool>> _materialPools;
-    std::vector<std::unique_ptr<FabricTexturePool>> _texturePools;
+    // Pools are owned by the pool id maps. The descriptor maps are lookup indices into the same pools.
+    std::unordered_map<int64_t, std::unique_ptr<FabricGeometryPool>> _geometryPools;
+    std::unordered_map<int64_t, std::unique_ptr<FabricMaterialPool>> _materialPools;
+    std::unordered_map<int64_t, std::unique_ptr<FabricTexturePool>> _texturePools;
+    std::unordered_map<FabricGeometryDescriptor, FabricGeometryPool*> _geometryPoolsByDescriptor;
+    std::unordered_map<FabricMaterialDescriptor, FabricMaterialPool*> _materialPoolsByDescriptor;
+    std::unordered_map<FabricTextureDescriptor, FabricTexturePool*> _texturePoolsByDescriptor;
 
     bool _disableMaterials{false};
     bool _disableTextures{false};
@@ -139,6 +243,10 @@ class FabricResourceManager {
     uint64_t _materialPoolInitialCapacity{0};
     uint64_t _texturePoolInitialCapacity{0};
 
+    double _poolGrowthFactor{2.0};
+    uint64_t _poolLowWaterMark{0};
+    double _poolMaximumIdleTime{0.0};
+
     bool _debugRandomColors{false};
 
     std::atomic<int64_t> _geometryId{0};
@@ -148,7 +256,40 @@ class FabricResourceManager {
     std::atomic<int64_t> _materialPoolId{0};
     std::atomic<int64_t> _texturePoolId{0};
 
-    std::mutex _poolMutex;
+    // glTF primitives that are currently loaded, counted before merging. See TilesetSettings::mergePrimitives.
+    // Not reset by clear since meshes are still freed afterwards.
+    std::atomic<uint64_t> _geometryPrimitivesLoaded{0};
+
+    // glTF primitives that are currently loaded and were merged into another primitive's mesh
+    std::atomic<uint64_t> _geometryPrimitivesMerged{0};
+
+    // A hit means the acquired texture already had the requested resolution and format
+    std::atomic<uint64_t> _texturePoolHits{0};
+    std::atomic<uint64_t> _texturePoolMisses{0};
+
+    // A hit means a texture with the same content was already shared so nothing was uploaded
+    std::atomic<uint64_t> _sharedTextureHits{0};
+
+    // Totals for every image compressed since the last clear. The encode time is in microseconds of worker thread time.
+    std::atomic<uint64_t> _texturesCompressed{0};
+    std::atomic<uint64_t> _textureCompressionInputBytes{0};
+    std::atomic<uint64_t> _textureCompressionOutputBytes{0};
+    std::atomic<uint64_t> _textureCompressionTime{0};
+
+    // Shared with every geometry and material so that they can report their statistics even while the pools are
+    // being destroyed
+    std::shared_ptr<FabricStatisticsCounter> _pStatisticsCounter{std::make_shared<FabricStatisticsCounter>()};
+
+    // Geometry and materials may be acquired from worker threads. Their Fabric prims are created later in a batch
+    // on the main thread. See initializePendingResources.
+    std::vector<std::shared_ptr<FabricGeometry>> _pendingGeometries;
+    std::vector<std::shared_ptr<FabricMaterial>> _pendingMaterials;
+
+    // Tileset materials that have Cesium MDL nodes. Refreshed on the main thread each frame so that
+    // shouldAcquireMaterial can be called from worker threads without reading Fabric.
+    std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash> _tilesetMaterialsWithCesiumNodes;
+
+    mutable std::mutex _poolMutex;
 
     Context* _pContext;
     std::unique_ptr<omni::ui::DynamicTextureProvider> _defaultWhiteTexture;
@@ -156,7 +297,10 @@ class FabricResourceManager {
     pxr::TfToken _defaultWhiteTextureAssetPathToken;
     pxr::TfToken _defaultTransparentTextureAssetPathToken;
 
-    std::vector<SharedMaterial> _sharedMaterials;
+    std::unordered_map<SharedMaterialKey, SharedMaterial, SharedMaterialKeyHash> _sharedMaterials;
+    std::unordered_map<const FabricMaterial*, SharedMaterialKey> _sharedMaterialKeys;
+    std::unordered_map<SharedTextureKey, SharedTexture, SharedTextureKeyHash> _sharedTextures;
+    std::unordered_map<const FabricTexture*, SharedTextureKey> _sharedTextureKeys;
 };
 
 } // namespace cesium::omniverse
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 
 namespace cesium::omniverse {
 
@@ -12,6 +13,29 @@ struct FabricStatistics {
     uint64_t geometriesRendered{0};
     uint64_t trianglesLoaded{0};
     uint64_t trianglesRendered{0};
+    uint64_t pointsLoaded{0};
+    uint64_t pointsRendered{0};
+    uint64_t geometryBytesLoaded{0};
+
+    bool operator==(const FabricStatistics& other) const;
+    bool operator!=(const FabricStatistics& other) const;
+};
+
+/**
+* @brief Running totals of {@link FabricStatistics}.
+*
+* Each geometry and material reports its own contribution whenever it changes, i.e. when it's created, set,
+* reset, shown, hidden, or destroyed. The totals are the sum of the live objects so reading them doesn't require
+* scanning Fabric. {@link FabricUtil::getStatistics} still computes the same values from Fabric for verification.
+*/
+class FabricStatisticsCounter {
+  public:
+    void update(const FabricStatistics& previous, const FabricStatistics& current);
+    [[nodiscard]] FabricStatistics get() const;
+
+  private:
+    mutable std::mutex _mutex;
+    FabricStatistics _statistics;
 };
 
 } // namespace cesium::omniverse
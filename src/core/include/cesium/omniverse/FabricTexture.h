@@ -1,5 +1,7 @@
 #pragma once
 
+#include "cesium/omniverse/FabricTextureDescriptor.h"
+
 #include <carb/RenderingTypes.h>
 #include <pxr/base/tf/token.h>
 
@@ -18,11 +20,6 @@ namespace cesium::omniverse {
 
 class Context;
 
-enum class TransferFunction {
-    LINEAR,
-    SRGB,
-};
-
 class FabricTexture {
   public:
     FabricTexture(Context* pContext, const std::string& name, int64_t poolId);
@@ -35,10 +32,9 @@ class FabricTexture {
     void setImage(const CesiumGltf::ImageCesium& image, TransferFunction transferFunction);
     void setBytes(const std::vector<std::byte>& bytes, uint64_t width, uint64_t height, carb::Format format);
 
-    void setActive(bool active);
-
     [[nodiscard]] const pxr::TfToken& getAssetPathToken() const;
     [[nodiscard]] int64_t getPoolId() const;
+    [[nodiscard]] const FabricTextureDescriptor& getTextureDescriptor() const;
 
   private:
     void reset();
@@ -47,5 +43,6 @@ class FabricTexture {
     std::unique_ptr<omni::ui::DynamicTextureProvider> _pTexture;
     pxr::TfToken _assetPathToken;
     int64_t _poolId;
+    FabricTextureDescriptor _textureDescriptor;
 };
 } // namespace cesium::omniverse
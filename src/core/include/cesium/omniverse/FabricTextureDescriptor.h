@@ -0,0 +1,50 @@
+#pragma once
+
+#include <carb/RenderingTypes.h>
+
+#include <cstdint>
+#include <functional>
+
+namespace CesiumGltf {
+struct ImageCesium;
+}
+
+namespace cesium::omniverse {
+
+enum class TransferFunction {
+    LINEAR,
+    SRGB,
+};
+
+/**
+* @brief A descriptor used to initialize a {@link FabricTexture} and {@link FabricTexturePool}.
+*
+* The descriptor identifies the backing storage of a {@link FabricTexture} i.e. the resolution and
+* pixel format, but not the actual pixel values.
+*
+* Textures that have the same texture descriptor will be assigned to the same texture pool so that
+* a released texture can be reused without reallocating its backing storage.
+*/
+class FabricTextureDescriptor {
+  public:
+    FabricTextureDescriptor(uint64_t width, uint64_t height, carb::Format format);
+    FabricTextureDescriptor(const CesiumGltf::ImageCesium& image, TransferFunction transferFunction);
+
+    [[nodiscard]] uint64_t getWidth() const;
+    [[nodiscard]] uint64_t getHeight() const;
+    [[nodiscard]] carb::Format getFormat() const;
+    [[nodiscard]] uint64_t getByteLength() const;
+
+    bool operator==(const FabricTextureDescriptor& other) const;
+
+  private:
+    uint64_t _width;
+    uint64_t _height;
+    carb::Format _format;
+};
+
+} // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricTextureDescriptor> {
+    size_t operator()(const cesium::omniverse::FabricTextureDescriptor& textureDescriptor) const noexcept;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "cesium/omniverse/CppUtil.h"
+
 #include <glm/glm.hpp>
 
 #include <vector>
@@ -33,3 +35,27 @@ struct FabricTextureInfo {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricTextureInfo> {
+    // Make sure to update this function when adding new fields to the struct
+    size_t operator()(const cesium::omniverse::FabricTextureInfo& textureInfo) const noexcept {
+        using namespace cesium::omniverse;
+
+        auto seed = CppUtil::hashValues(
+            textureInfo.offset.x,
+            textureInfo.offset.y,
+            textureInfo.rotation,
+            textureInfo.scale.x,
+            textureInfo.scale.y,
+            textureInfo.setIndex,
+            textureInfo.wrapS,
+            textureInfo.wrapT,
+            textureInfo.flipVertical);
+
+        for (const auto channel : textureInfo.channels) {
+            CppUtil::hashCombine(seed, channel);
+        }
+
+        return static_cast<size_t>(seed);
+    }
+};
@@ -1,19 +1,25 @@
 #pragma once
 
 #include "cesium/omniverse/FabricTexture.h"
+#include "cesium/omniverse/FabricTextureDescriptor.h"
 #include "cesium/omniverse/ObjectPool.h"
 
 namespace cesium::omniverse {
 
 class FabricTexturePool final : public ObjectPool<FabricTexture> {
   public:
-    FabricTexturePool(Context* pContext, int64_t poolId, uint64_t initialCapacity);
+    FabricTexturePool(
+        Context* pContext,
+        int64_t poolId,
+        const FabricTextureDescriptor& textureDescriptor,
+        uint64_t initialCapacity);
     ~FabricTexturePool() override = default;
     FabricTexturePool(const FabricTexturePool&) = delete;
     FabricTexturePool& operator=(const FabricTexturePool&) = delete;
     FabricTexturePool(FabricTexturePool&&) noexcept = default;
     FabricTexturePool& operator=(FabricTexturePool&&) noexcept = default;
 
+    [[nodiscard]] const FabricTextureDescriptor& getTextureDescriptor() const;
     [[nodiscard]] int64_t getPoolId() const;
 
   protected:
@@ -23,6 +29,7 @@ class FabricTexturePool final : public ObjectPool<FabricTexture> {
   private:
     Context* _pContext;
     int64_t _poolId;
+    FabricTextureDescriptor _textureDescriptor;
 };
 
 } // namespace cesium::omniverse
@@ -4,6 +4,7 @@
 #include <pxr/usd/usd/common.h>
 
 #include <string>
+#include <vector>
 
 namespace omni::fabric {
 class StageReaderWriter;
@@ -28,11 +29,17 @@ const int64_t NO_TILESET_ID{-1};
 
 std::string printFabricStage(omni::fabric::StageReaderWriter& fabricStage);
 FabricStatistics getStatistics(omni::fabric::StageReaderWriter& fabricStage);
+uint64_t getArrayAttributesByteSize(omni::fabric::StageReaderWriter& fabricStage, const omni::fabric::Path& path);
 void destroyPrim(omni::fabric::StageReaderWriter& fabricStage, const omni::fabric::Path& path);
 void setTilesetTransform(
     omni::fabric::StageReaderWriter& fabricStage,
     int64_t tilesetId,
     const glm::dmat4& ecefToPrimWorldTransform);
+void setVisibility(
+    omni::fabric::StageReaderWriter& fabricStage,
+    int64_t tilesetId,
+    const std::vector<omni::fabric::Path>& paths,
+    bool visible);
 omni::fabric::Path toFabricPath(const pxr::SdfPath& path);
 omni::fabric::Token toFabricToken(const pxr::TfToken& token);
 omni::fabric::Path joinPaths(const omni::fabric::Path& absolutePath, const omni::fabric::Token& relativePath);
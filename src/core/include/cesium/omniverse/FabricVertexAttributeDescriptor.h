@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/DataType.h"
 
 #include <omni/fabric/IToken.h>
@@ -28,3 +29,13 @@ struct FabricVertexAttributeDescriptor {
 };
 
 } // namespace cesium::omniverse
+
+template <> struct std::hash<cesium::omniverse::FabricVertexAttributeDescriptor> {
+    // Make sure to update this function when adding new fields to the struct
+    size_t operator()(const cesium::omniverse::FabricVertexAttributeDescriptor& attribute) const noexcept {
+        return static_cast<size_t>(cesium::omniverse::CppUtil::hashValues(
+            attribute.type,
+            omni::fabric::TokenC(attribute.fabricAttributeName).token,
+            attribute.gltfAttributeName));
+    }
+};
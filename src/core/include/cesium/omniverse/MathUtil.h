@@ -5,6 +5,8 @@
 
 #include <array>
 
+#include <gsl/span>
+
 namespace CesiumGeospatial {
 class Cartographic;
 }
@@ -54,4 +56,45 @@ glm::dvec3 getCorner(const std::array<glm::dvec3, 2>& extent, uint64_t index);
 
 std::array<glm::dvec3, 2> transformExtent(const std::array<glm::dvec3, 2>& extent, const glm::dmat4& transform);
 
+/**
+ * @brief Computes smooth vertex normals by averaging the normals of the triangles that share each vertex.
+ *
+ * Face normals are computed four triangles at a time with SSE when available and large primitives are split
+ * across worker threads. Degenerate triangles don't contribute and vertices that aren't referenced by any
+ * triangle get a zero normal.
+ *
+ * @param positions The vertex positions.
+ * @param indices The triangle indices. Every index must be less than the number of positions.
+ * @param normals The output normals. Must be the same size as positions.
+ */
+void computeSmoothNormals(
+    const gsl::span<const glm::fvec3>& positions,
+    const gsl::span<const int>& indices,
+    const gsl::span<glm::fvec3>& normals);
+
+/**
+ * @brief Computes the prim world transform and extent of a batch of tile prims.
+ *
+ * For each prim this is equivalent to calling {@link decompose} and {@link transformExtent} with
+ * ecefToPrimWorldTransform * gltfLocalToEcefTransform, but prims are processed in structure-of-arrays blocks
+ * so that the per-prim math is branch free and vectorizes. The transforms must be affine. Skew is discarded
+ * the same way as in {@link decompose}.
+ *
+ * @param ecefToPrimWorldTransform The transform shared by every prim in the batch.
+ * @param gltfLocalToEcefTransforms The glTF local to ECEF transform of each prim.
+ * @param gltfLocalExtents The glTF local extent of each prim.
+ * @param worldPositions The output world positions. Must be the same size as gltfLocalToEcefTransforms.
+ * @param worldOrientations The output world orientations. Must be the same size as gltfLocalToEcefTransforms.
+ * @param worldScales The output world scales. Must be the same size as gltfLocalToEcefTransforms.
+ * @param worldExtents The output world extents. Must be the same size as gltfLocalToEcefTransforms.
+ */
+void computeWorldTransforms(
+    const glm::dmat4& ecefToPrimWorldTransform,
+    const gsl::span<const glm::dmat4>& gltfLocalToEcefTransforms,
+    const gsl::span<const std::array<glm::dvec3, 2>>& gltfLocalExtents,
+    const gsl::span<glm::dvec3>& worldPositions,
+    const gsl::span<glm::fquat>& worldOrientations,
+    const gsl::span<glm::fvec3>& worldScales,
+    const gsl::span<std::array<glm::dvec3, 2>>& worldExtents);
+
 } // namespace cesium::omniverse::MathUtil
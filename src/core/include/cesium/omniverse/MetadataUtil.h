@@ -16,8 +16,7 @@
 #include <CesiumGltf/PropertyTextureView.h>
 
 namespace cesium::omniverse {
-struct FabricPropertyDescriptor;
-struct FabricTextureData;
+struct FabricPrimitiveInfo;
 } // namespace cesium::omniverse
 
 namespace cesium::omniverse::MetadataUtil {
@@ -559,6 +558,7 @@ void forEachStyleablePropertyTableProperty(
                     const auto property =
                         FabricPropertyTablePropertyInfo<static_cast<cesium::omniverse::DataType>(type)>{
                             featureIdSetIndex,
+                            propertyTableProperty.values,
                             propertyInfo,
                         };
 
@@ -569,29 +569,14 @@ void forEachStyleablePropertyTableProperty(
         unsupportedCallback);
 }
 
-std::tuple<std::vector<FabricPropertyDescriptor>, std::map<std::string, std::string>> getStyleableProperties(
+/**
+* @brief Gathers the styleable properties of a primitive, the unique property texture images, and the encoded
+* property table values into primitiveInfo, visiting each kind of property once.
+*/
+void getStyleablePropertyInfo(
     const Context& context,
     const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive);
-
-std::vector<const CesiumGltf::ImageCesium*> getPropertyTextureImages(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive);
-
-std::unordered_map<uint64_t, uint64_t> getPropertyTextureIndexMapping(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive);
-
-std::vector<FabricTextureData> encodePropertyTables(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive);
-
-uint64_t getPropertyTableTextureCount(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive);
+    const CesiumGltf::MeshPrimitive& primitive,
+    FabricPrimitiveInfo& primitiveInfo);
 
 } // namespace cesium::omniverse::MetadataUtil
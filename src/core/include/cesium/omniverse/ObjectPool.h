@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <queue>
 
@@ -8,6 +11,8 @@ namespace cesium::omniverse {
 
 template <typename T> class ObjectPool {
   public:
+    using Clock = std::chrono::steady_clock;
+
     ObjectPool() = default;
 
     virtual ~ObjectPool() = default;
@@ -16,20 +21,22 @@ template <typename T> class ObjectPool {
         const auto percentActive = computePercentActive();
 
         if (percentActive > _doublingThreshold) {
-            // Capacity is initially 0, so make sure the new capacity is at least 1
-            const auto newCapacity = std::max(_capacity * 2, uint64_t(1));
-            setCapacity(newCapacity);
+            setCapacity(computeGrowthCapacity());
         }
 
         auto pObject = _queue.front();
         _queue.pop_front();
+        _releaseTimes.pop_front();
         setActive(pObject.get(), true);
 
         return pObject;
     }
 
     void release(std::shared_ptr<T> pObject) {
-        _queue.push_back(pObject);
+        // Released objects go to the front so that recently used objects are reused first
+        // and idle objects drift to the back of the queue where they can be trimmed
+        _queue.push_front(pObject);
+        _releaseTimes.push_front(Clock::now());
         setActive(pObject.get(), false);
     }
 
@@ -64,21 +71,76 @@ template <typename T> class ObjectPool {
         const auto oldCapacity = _capacity;
         const auto newCapacity = capacity;
 
-        assert(newCapacity >= oldCapacity);
-
-        if (newCapacity <= oldCapacity) {
-            // We can't shrink capacity because it would mean destroying objects currently in use
+        if (newCapacity < oldCapacity) {
+            // We can only shrink by destroying inactive objects. Objects currently in use are left alone.
+            const auto count = std::min(oldCapacity - newCapacity, getNumberInactive());
+            destroyInactiveObjects(count);
             return;
         }
 
         const auto count = newCapacity - oldCapacity;
+        const auto now = Clock::now();
 
         for (uint64_t i = 0; i < count; ++i) {
             _queue.push_back(createObject(_objectId++));
+            _releaseTimes.push_back(now);
             ++_capacity;
         }
     }
 
+    [[nodiscard]] double getGrowthFactor() const {
+        return _growthFactor;
+    }
+
+    void setGrowthFactor(double growthFactor) {
+        // A growth factor of 1.0 or less still grows the pool by one object at a time
+        _growthFactor = std::max(growthFactor, 1.0);
+    }
+
+    [[nodiscard]] uint64_t getLowWaterMark() const {
+        return _lowWaterMark;
+    }
+
+    void setLowWaterMark(uint64_t lowWaterMark) {
+        _lowWaterMark = lowWaterMark;
+    }
+
+    [[nodiscard]] double getMaximumIdleTime() const {
+        return _maximumIdleTime;
+    }
+
+    void setMaximumIdleTime(double maximumIdleTime) {
+        _maximumIdleTime = std::max(maximumIdleTime, 0.0);
+    }
+
+    uint64_t trim() {
+        return trim(Clock::now());
+    }
+
+    uint64_t trim(Clock::time_point now) {
+        // Destroys inactive objects from the back of the queue that have been idle for longer than the maximum
+        // idle time. The pool never shrinks below the low-water mark. A maximum idle time of 0 disables trimming.
+        if (_maximumIdleTime <= 0.0) {
+            return 0;
+        }
+
+        const auto maximumIdleTime = std::chrono::duration<double>(_maximumIdleTime);
+
+        uint64_t count = 0;
+
+        while (count < _releaseTimes.size() && _capacity - count > _lowWaterMark) {
+            const auto idleTime = now - _releaseTimes[_releaseTimes.size() - 1 - count];
+            if (idleTime < maximumIdleTime) {
+                break;
+            }
+            ++count;
+        }
+
+        destroyInactiveObjects(count);
+
+        return count;
+    }
+
   protected:
     virtual std::shared_ptr<T> createObject(uint64_t objectId) const = 0;
     virtual void setActive(T* pObject, bool active) const = 0;
@@ -88,10 +150,32 @@ template <typename T> class ObjectPool {
     }
 
   private:
+    [[nodiscard]] uint64_t computeGrowthCapacity() const {
+        const auto grownCapacity =
+            static_cast<uint64_t>(std::ceil(static_cast<double>(_capacity) * _growthFactor));
+
+        // Capacity is initially 0, so make sure the new capacity is at least 1 larger
+        return std::max(grownCapacity, _capacity + 1);
+    }
+
+    void destroyInactiveObjects(uint64_t count) {
+        assert(count <= _queue.size());
+
+        for (uint64_t i = 0; i < count; ++i) {
+            _queue.pop_back();
+            _releaseTimes.pop_back();
+            --_capacity;
+        }
+    }
+
     std::deque<std::shared_ptr<T>> _queue;
+    std::deque<Clock::time_point> _releaseTimes;
     uint64_t _objectId{0};
     uint64_t _capacity{0};
     double _doublingThreshold{0.75};
+    double _growthFactor{2.0};
+    uint64_t _lowWaterMark{0};
+    double _maximumIdleTime{0.0};
 };
 
 } // namespace cesium::omniverse
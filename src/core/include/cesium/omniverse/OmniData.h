@@ -25,8 +25,13 @@ class OmniData {
     [[nodiscard]] uint64_t getDebugGeometryPoolInitialCapacity() const;
     [[nodiscard]] uint64_t getDebugMaterialPoolInitialCapacity() const;
     [[nodiscard]] uint64_t getDebugTexturePoolInitialCapacity() const;
+    [[nodiscard]] double getDebugPoolGrowthFactor() const;
+    [[nodiscard]] uint64_t getDebugPoolLowWaterMark() const;
+    [[nodiscard]] double getDebugPoolMaximumIdleTime() const;
     [[nodiscard]] bool getDebugRandomColors() const;
     [[nodiscard]] bool getDebugDisableGeoreferencing() const;
+    [[nodiscard]] bool getDebugVerifyRenderStatistics() const;
+    [[nodiscard]] bool getDebugPipelinedTileSelection() const;
 
   private:
     Context* _pContext;
@@ -14,11 +14,11 @@ namespace cesium::omniverse {
 class Context;
 class OmniTileset;
 enum class FabricOverlayRenderMethod;
+enum class TextureCompression;
 
 class OmniRasterOverlay {
     friend void OmniTileset::addRasterOverlayIfExists(const OmniRasterOverlay* pOverlay);
-    friend pxr::SdfPath
-    OmniTileset::getRasterOverlayPathIfExists(const CesiumRasterOverlays::RasterOverlay& rasterOverlay);
+    friend void OmniTileset::updateSettings();
 
   public:
     OmniRasterOverlay(Context* pContext, const pxr::SdfPath& path);
@@ -36,6 +36,7 @@ class OmniRasterOverlay {
     [[nodiscard]] int getMaximumTextureSize() const;
     [[nodiscard]] int getMaximumSimultaneousTileLoads() const;
     [[nodiscard]] int getSubTileCacheBytes() const;
+    [[nodiscard]] TextureCompression getTextureCompression() const;
 
     [[nodiscard]] CesiumRasterOverlays::RasterOverlayOptions createRasterOverlayOptions() const;
 
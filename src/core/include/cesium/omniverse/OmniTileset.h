@@ -1,22 +1,24 @@
 #pragma once
 
+#include "cesium/omniverse/TilesetStatistics.h"
+
 #include <glm/glm.hpp>
 #include <pxr/usd/sdf/path.h>
 
+#include <memory>
 #include <optional>
+#include <unordered_set>
+#include <vector>
 
 #include <gsl/span>
 
 namespace Cesium3DTilesSelection {
+class Tile;
 class Tileset;
 class ViewState;
 class ViewUpdateResult;
 } // namespace Cesium3DTilesSelection
 
-namespace CesiumRasterOverlays {
-class RasterOverlay;
-}
-
 namespace CesiumGltf {
 struct Model;
 }
@@ -25,13 +27,18 @@ namespace CesiumIonClient {
 struct Token;
 }
 
+namespace omni::fabric {
+class Path;
+}
+
 namespace cesium::omniverse {
 
 class Context;
 class FabricPrepareRenderResources;
 class OmniRasterOverlay;
-struct TilesetStatistics;
+struct TilesetSettings;
 struct Viewport;
+enum class TextureCompression;
 
 enum TilesetSourceType {
     ION,
@@ -50,6 +57,8 @@ class OmniTileset {
     [[nodiscard]] const pxr::SdfPath& getPath() const;
     [[nodiscard]] int64_t getTilesetId() const;
     [[nodiscard]] TilesetStatistics getStatistics() const;
+    [[nodiscard]] std::shared_ptr<const TilesetSettings> getSettings() const;
+    [[nodiscard]] const glm::dmat4& getEcefToPrimWorldTransform() const;
 
     [[nodiscard]] TilesetSourceType getSourceType() const;
     [[nodiscard]] std::string getUrl() const;
@@ -71,7 +80,10 @@ class OmniTileset {
     [[nodiscard]] double getCulledScreenSpaceError() const;
     [[nodiscard]] bool getSuspendUpdate() const;
     [[nodiscard]] bool getSmoothNormals() const;
+    [[nodiscard]] bool getRenderPointsAsVoxels() const;
+    [[nodiscard]] bool getMergePrimitives() const;
     [[nodiscard]] bool getShowCreditsOnScreen() const;
+    [[nodiscard]] TextureCompression getTextureCompression() const;
     [[nodiscard]] pxr::SdfPath getResolvedGeoreferencePath() const;
     [[nodiscard]] pxr::SdfPath getMaterialPath() const;
     [[nodiscard]] glm::dvec3 getDisplayColor() const;
@@ -79,9 +91,10 @@ class OmniTileset {
     [[nodiscard]] std::vector<pxr::SdfPath> getRasterOverlayPaths() const;
 
     void updateTilesetOptions();
+    void updateSettings();
+    void markTransformDirty();
 
     void reload();
-    [[nodiscard]] pxr::SdfPath getRasterOverlayPathIfExists(const CesiumRasterOverlays::RasterOverlay& rasterOverlay);
     void updateRasterOverlayAlpha(const pxr::SdfPath& rasterOverlayPath);
     void updateShaderInput(const pxr::SdfPath& shaderPath, const pxr::TfToken& attributeName);
     void updateDisplayColorAndOpacity();
@@ -89,11 +102,29 @@ class OmniTileset {
 
     void onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles);
 
+    /**
+     * @brief Pipelined alternative to onUpdateFrame. Applies the tiles selected by the previous call to selectTiles
+     * and computes the view states for this frame. Called from the main thread.
+     *
+     * @return Whether selectTiles should be called for this frame.
+     */
+    [[nodiscard]] bool onUpdateFramePipelined(const gsl::span<const Viewport>& viewports);
+
+    /**
+     * @brief Selects tiles using the view states computed by onUpdateFramePipelined. May be called from a worker
+     * thread while the main thread isn't using this tileset. Fabric writes are deferred until the next frame.
+     */
+    void selectTiles();
+
   private:
+    [[nodiscard]] bool updatePrimExists();
     void updateTransform();
-    void updateView(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles);
+    [[nodiscard]] bool updateViewStates(const gsl::span<const Viewport>& viewports, bool visible);
+    void applyTileSelection(bool visible, bool waitForLoadingTiles, double updateViewTime);
+    void updateVisibility(bool visible);
     [[nodiscard]] bool updateExtent();
     void updateLoadStatus();
+    void updateStatistics();
 
     void destroyNativeTileset();
 
@@ -105,7 +136,19 @@ class OmniTileset {
     pxr::SdfPath _path;
     int64_t _tilesetId;
     glm::dmat4 _ecefToPrimWorldTransform{};
+    glm::dmat4 _primWorldToEcefTransform{};
+    bool _transformDirty{true};
+    std::shared_ptr<const TilesetSettings> _pSettings;
+    uint64_t _settingsVersion{0};
     std::vector<Cesium3DTilesSelection::ViewState> _viewStates;
+
+    // Tiles whose geometries are currently visible in Fabric. Only changes to this set are written each frame.
+    std::unordered_set<const Cesium3DTilesSelection::Tile*> _visibleTiles;
+    std::vector<omni::fabric::Path> _shownGeometryPaths;
+    std::vector<omni::fabric::Path> _hiddenGeometryPaths;
+    uint64_t _visibilityWrites{0};
+    TilesetStatistics _statistics;
+
     bool _extentSet{false};
     bool _activeLoading{false};
 };
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace cesium::omniverse {
+
+/**
+* @brief A prefix tree of prim paths with a value stored at each inserted path.
+*
+* Each node corresponds to one path element, so finding a path costs O(path depth) and visiting everything at or
+* below a path costs O(subtree size), regardless of how many other paths are stored.
+*/
+template <typename T> class PathTrie {
+  public:
+    PathTrie() = default;
+    ~PathTrie() = default;
+    PathTrie(const PathTrie&) = delete;
+    PathTrie& operator=(const PathTrie&) = delete;
+    PathTrie(PathTrie&&) noexcept = default;
+    PathTrie& operator=(PathTrie&&) noexcept = default;
+
+    T& insert(const pxr::SdfPath& path) {
+        auto pNode = &_root;
+
+        for (const auto& prefix : path.GetPrefixes()) {
+            auto& pChild = pNode->children[prefix.GetNameToken()];
+            if (!pChild) {
+                pChild = std::make_unique<Node>();
+                pChild->path = prefix;
+            }
+            pNode = pChild.get();
+        }
+
+        if (!pNode->value.has_value()) {
+            pNode->value.emplace();
+            ++_size;
+        }
+
+        return *pNode->value;
+    }
+
+    bool erase(const pxr::SdfPath& path) {
+        std::vector<Node*> nodes{&_root};
+
+        for (const auto& prefix : path.GetPrefixes()) {
+            const auto iter = nodes.back()->children.find(prefix.GetNameToken());
+            if (iter == nodes.back()->children.end()) {
+                return false;
+            }
+            nodes.push_back(iter->second.get());
+        }
+
+        if (!nodes.back()->value.has_value()) {
+            return false;
+        }
+
+        nodes.back()->value.reset();
+        --_size;
+
+        // Prune nodes that no longer lead to a value
+        for (auto i = nodes.size() - 1; i > 0; --i) {
+            const auto pNode = nodes[i];
+            if (pNode->value.has_value() || !pNode->children.empty()) {
+                break;
+            }
+            nodes[i - 1]->children.erase(pNode->path.GetNameToken());
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] T* find(const pxr::SdfPath& path) {
+        const auto pNode = findNode(path);
+        return pNode && pNode->value.has_value() ? &*pNode->value : nullptr;
+    }
+
+    [[nodiscard]] const T* find(const pxr::SdfPath& path) const {
+        const auto pNode = findNode(path);
+        return pNode && pNode->value.has_value() ? &*pNode->value : nullptr;
+    }
+
+    template <typename F> void forEachPrimOrDescendant(const pxr::SdfPath& path, const F& callback) const {
+        // The trie must not be modified from within the callback
+        const auto pNode = findNode(path);
+        if (pNode) {
+            forEach(*pNode, callback);
+        }
+    }
+
+    [[nodiscard]] uint64_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    void clear() {
+        _root.children.clear();
+        _root.value.reset();
+        _size = 0;
+    }
+
+  private:
+    struct Node {
+        pxr::SdfPath path{pxr::SdfPath::AbsoluteRootPath()};
+        std::optional<T> value;
+        std::unordered_map<pxr::TfToken, std::unique_ptr<Node>, pxr::TfToken::HashFunctor> children;
+    };
+
+    [[nodiscard]] const Node* findNode(const pxr::SdfPath& path) const {
+        auto pNode = &_root;
+
+        for (const auto& prefix : path.GetPrefixes()) {
+            const auto iter = pNode->children.find(prefix.GetNameToken());
+            if (iter == pNode->children.end()) {
+                return nullptr;
+            }
+            pNode = iter->second.get();
+        }
+
+        return pNode;
+    }
+
+    [[nodiscard]] Node* findNode(const pxr::SdfPath& path) {
+        return const_cast<Node*>(static_cast<const PathTrie*>(this)->findNode(path));
+    }
+
+    template <typename F> static void forEach(const Node& node, const F& callback) {
+        if (node.value.has_value()) {
+            callback(node.path, *node.value);
+        }
+
+        for (const auto& child : node.children) {
+            forEach(*child.second, callback);
+        }
+    }
+
+    Node _root;
+    uint64_t _size{0};
+};
+
+} // namespace cesium::omniverse
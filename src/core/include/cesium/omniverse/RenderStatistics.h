@@ -12,6 +12,20 @@ struct RenderStatistics {
     uint64_t geometriesRendered{0};
     uint64_t trianglesLoaded{0};
     uint64_t trianglesRendered{0};
+    uint64_t pointsLoaded{0};
+    uint64_t pointsRendered{0};
+    uint64_t geometryBytesLoaded{0};
+    uint64_t geometryPrimitivesLoaded{0};
+    uint64_t geometryPrimitivesMerged{0};
+    uint64_t texturePoolHits{0};
+    uint64_t texturePoolMisses{0};
+    uint64_t textureBytesLoaded{0};
+    uint64_t sharedTexturesLoaded{0};
+    uint64_t sharedTextureHits{0};
+    uint64_t texturesCompressed{0};
+    uint64_t textureCompressionInputBytes{0};
+    uint64_t textureCompressionOutputBytes{0};
+    uint64_t textureCompressionTime{0};
     uint64_t tilesetCachedBytes{0};
     uint64_t tilesVisited{0};
     uint64_t culledTilesVisited{0};
@@ -21,6 +35,8 @@ struct RenderStatistics {
     uint64_t tilesLoadingWorker{0};
     uint64_t tilesLoadingMain{0};
     uint64_t tilesLoaded{0};
+    uint64_t visibilityWrites{0};
+    uint64_t tilesetUpdateTime{0};
 };
 
 } // namespace cesium::omniverse
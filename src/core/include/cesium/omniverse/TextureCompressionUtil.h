@@ -0,0 +1,47 @@
+#pragma once
+
+#include <CesiumGltf/ImageCesium.h>
+
+#include <cstdint>
+
+namespace cesium::omniverse {
+
+enum class TextureCompression {
+    NONE,
+    FAST,
+    QUALITY,
+};
+
+} // namespace cesium::omniverse
+
+namespace cesium::omniverse::TextureCompressionUtil {
+
+/**
+ * @brief Returns whether {@link compressImage} can encode the image.
+ *
+ * Only uncompressed 8-bit RGBA images without mip levels whose width and height are multiples of 4 can be encoded.
+ */
+bool canCompressImage(const CesiumGltf::ImageCesium& image);
+
+/**
+ * @brief Returns the format {@link compressImage} encodes the image as without encoding it.
+ *
+ * @param image The image. {@link canCompressImage} must be true.
+ * @returns BC1_RGB if every pixel is fully opaque, otherwise BC3_RGBA.
+ */
+CesiumGltf::GpuCompressedPixelFormat getCompressedPixelFormat(const CesiumGltf::ImageCesium& image);
+
+/**
+ * @brief Encodes an image as BC1, or as BC3 if any pixel is not fully opaque.
+ *
+ * The fast preset fits each block's endpoints to the bounding box of its colors. The quality preset fits them to the
+ * principal axis of its colors and refines them with a least squares fit, which is slower but has less error.
+ * Blocks are encoded in parallel. The transfer function is not changed so sRGB images are encoded in sRGB space.
+ *
+ * @param image The image. {@link canCompressImage} must be true.
+ * @param textureCompression The compression preset. Must not be {@link TextureCompression::NONE}.
+ * @returns The compressed image.
+ */
+CesiumGltf::ImageCesium compressImage(const CesiumGltf::ImageCesium& image, TextureCompression textureCompression);
+
+} // namespace cesium::omniverse::TextureCompressionUtil
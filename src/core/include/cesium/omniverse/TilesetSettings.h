@@ -0,0 +1,46 @@
+#pragma once
+
+#include "cesium/omniverse/FabricRasterOverlaysInfo.h"
+#include "cesium/omniverse/TextureCompressionUtil.h"
+
+#include <glm/glm.hpp>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumRasterOverlays {
+class RasterOverlay;
+}
+
+namespace cesium::omniverse {
+
+struct TilesetRasterOverlaySettings {
+    pxr::SdfPath path;
+    const CesiumRasterOverlays::RasterOverlay* pNativeRasterOverlay{nullptr};
+    FabricOverlayRenderMethod overlayRenderMethod{FabricOverlayRenderMethod::OVERLAY};
+    double alpha{1.0};
+};
+
+/**
+* @brief An immutable snapshot of the tileset settings that are read while loading tiles.
+*
+* The snapshot is rebuilt on the main thread when a relevant USD property changes. Tile loading, including work
+* done in worker threads, only reads the snapshot and never reads USD.
+*/
+struct TilesetSettings {
+    uint64_t version{0};
+    int64_t tilesetId{0};
+    pxr::SdfPath materialPath;
+    glm::dvec3 displayColor{1.0, 1.0, 1.0};
+    double displayOpacity{1.0};
+    bool smoothNormals{false};
+    bool renderPointsAsVoxels{false};
+    bool mergePrimitives{false};
+    TextureCompression textureCompression{TextureCompression::NONE};
+
+    // In the same order as the tileset's raster overlay binding
+    std::vector<TilesetRasterOverlaySettings> rasterOverlays;
+};
+
+} // namespace cesium::omniverse
@@ -14,6 +14,7 @@ struct TilesetStatistics {
     uint64_t tilesLoadingWorker{0};
     uint64_t tilesLoadingMain{0};
     uint64_t tilesLoaded{0};
+    uint64_t visibilityWrites{0};
 };
 
 } // namespace cesium::omniverse
@@ -36,6 +36,8 @@ SOFTWARE.
 #include <vector>
 
 namespace cesium::omniverse {
+class CurlMultiLoop;
+
 // A cache that permits reuse of CURL handles. This is extremely important for performance
 // because libcurl will keep existing connections open if a curl handle is not destroyed
 // ("cleaned up").
@@ -78,9 +80,14 @@ struct CurlCache {
 };
 
 // Simple implementation of AssetAcessor that can make network and local requests
+//
+// By default requests are driven by a curl multi handle on a dedicated I/O thread so that worker threads
+// aren't blocked for the lifetime of a request. Transfers on the multi handle share a connection cache and
+// are multiplexed over HTTP/2 connections where the server supports it. When useMultiHandle is false each
+// request blocks a worker thread in curl_easy_perform instead.
 class UrlAssetAccessor final : public CesiumAsync::IAssetAccessor {
   public:
-    UrlAssetAccessor(const std::filesystem::path& certificatePath = {});
+    UrlAssetAccessor(const std::filesystem::path& certificatePath = {}, bool useMultiHandle = true);
     ~UrlAssetAccessor() override;
 
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
@@ -97,11 +104,13 @@ class UrlAssetAccessor final : public CesiumAsync::IAssetAccessor {
 
     void tick() noexcept override;
     friend class CurlHandle;
+    friend class CurlMultiLoop;
 
   private:
     CurlCache curlCache;
     std::string userAgent;
     curl_slist* setCommonOptions(CURL* curl, const std::string& url, const CesiumAsync::HttpHeaders& headers);
     std::string _certificatePath;
+    std::unique_ptr<CurlMultiLoop> _pMultiLoop;
 };
 } // namespace cesium::omniverse
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "cesium/omniverse/PathTrie.h"
+
 #include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
 
 namespace cesium::omniverse {
 
@@ -50,14 +53,17 @@ class UsdNotificationHandler final : public pxr::TfWeakBase {
     };
 
     bool processChangedPrims();
+    void processTransformChangedPaths();
     [[nodiscard]] bool processChangedPrim(const ChangedPrim& changedPrim) const;
 
     bool alreadyRegistered(const pxr::SdfPath& path);
 
     void onObjectsChanged(const pxr::UsdNotice::ObjectsChanged& objectsChanged);
     void onPrimAdded(const pxr::SdfPath& path);
+    void onPrimAdded(const pxr::UsdPrim& prim);
     void onPrimRemoved(const pxr::SdfPath& path);
     void onPropertyChanged(const pxr::SdfPath& path);
+    void onTransformChanged(const pxr::SdfPath& path);
 
     void insertAddedPrim(const pxr::SdfPath& primPath, ChangedPrimType primType);
     void insertRemovedPrim(const pxr::SdfPath& primPath, ChangedPrimType primType);
@@ -65,11 +71,16 @@ class UsdNotificationHandler final : public pxr::TfWeakBase {
     insertPropertyChanged(const pxr::SdfPath& primPath, ChangedPrimType primType, const pxr::TfToken& propertyName);
 
     ChangedPrimType getTypeFromStage(const pxr::SdfPath& path) const;
+    ChangedPrimType getTypeFromPrim(const pxr::UsdPrim& prim) const;
     ChangedPrimType getTypeFromAssetRegistry(const pxr::SdfPath& path) const;
 
     Context* _pContext;
     pxr::TfNotice::Key _noticeListenerKey;
     std::vector<ChangedPrim> _changedPrims;
+
+    // Prims in _changedPrims that were added but haven't been added to the asset registry yet
+    PathTrie<ChangedPrimType> _addedPrimPaths;
+    std::vector<pxr::SdfPath> _transformChangedPaths;
 };
 
 } // namespace cesium::omniverse
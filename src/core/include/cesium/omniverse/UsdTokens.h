@@ -75,6 +75,7 @@ __pragma(warning(push)) __pragma(warning(disable : 4003))
     (Mesh) \
     (none) \
     (points) \
+    (Points) \
     (primvarInterpolations) \
     (primvars) \
     (Shader) \
@@ -82,6 +83,7 @@ __pragma(warning(push)) __pragma(warning(disable : 4003))
     (subdivisionScheme) \
     (vertex) \
     (vertexId) \
+    (widths) \
     (_cesium_gltfLocalToEcefTransform) \
     (_cesium_tilesetId) \
     (_deletedPrims) \
@@ -121,6 +123,7 @@ __pragma(warning(push)) __pragma(warning(disable : 4003))
     ((inputs_offset, "inputs:offset")) \
     ((inputs_primvar_name, "inputs:primvar_name")) \
     ((inputs_property_id, "inputs:property_id")) \
+    ((inputs_property_table_texel_offset, "inputs:property_table_texel_offset")) \
     ((inputs_property_table_texture, "inputs:property_table_texture")) \
     ((inputs_property_value, "inputs:property_value")) \
     ((inputs_roughness_factor, "inputs:roughness_factor")) \
@@ -197,6 +200,7 @@ const omni::fabric::TokenC raster_overlay_n(uint64_t index);
 const omni::fabric::TokenC inputs_raster_overlay_n(uint64_t index);
 const omni::fabric::TokenC primvars_st_n(uint64_t index);
 const omni::fabric::TokenC property_n(uint64_t index);
+const omni::fabric::TokenC _cesium_tileset_n(uint64_t index);
 
 }
 
@@ -247,6 +251,7 @@ const omni::fabric::Type inputs_offset_float2(omni::fabric::BaseDataType::eFloat
 const omni::fabric::Type inputs_offset_float3(omni::fabric::BaseDataType::eFloat, 3, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type inputs_offset_float4(omni::fabric::BaseDataType::eFloat, 4, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type inputs_primvar_name(omni::fabric::BaseDataType::eUChar, 1, 1, omni::fabric::AttributeRole::eText);
+const omni::fabric::Type inputs_property_table_texel_offset(omni::fabric::BaseDataType::eInt, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type inputs_property_table_texture(omni::fabric::BaseDataType::eAsset, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type inputs_roughness_factor(omni::fabric::BaseDataType::eFloat, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type inputs_scale_float(omni::fabric::BaseDataType::eFloat, 1, 0, omni::fabric::AttributeRole::eNone);
@@ -266,6 +271,7 @@ const omni::fabric::Type material_binding(omni::fabric::BaseDataType::eRelations
 const omni::fabric::Type Mesh(omni::fabric::BaseDataType::eTag, 1, 0, omni::fabric::AttributeRole::ePrimTypeName);
 const omni::fabric::Type outputs_out(omni::fabric::BaseDataType::eToken, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type points(omni::fabric::BaseDataType::eFloat, 3, 1, omni::fabric::AttributeRole::ePosition);
+const omni::fabric::Type Points(omni::fabric::BaseDataType::eTag, 1, 0, omni::fabric::AttributeRole::ePrimTypeName);
 const omni::fabric::Type primvarInterpolations(omni::fabric::BaseDataType::eToken, 1, 1, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type primvars(omni::fabric::BaseDataType::eToken, 1, 1, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type primvars_COLOR_0(omni::fabric::BaseDataType::eFloat, 4, 1, omni::fabric::AttributeRole::eNone);
@@ -274,8 +280,10 @@ const omni::fabric::Type primvars_st(omni::fabric::BaseDataType::eFloat, 2, 1, o
 const omni::fabric::Type primvars_vertexId(omni::fabric::BaseDataType::eFloat, 1, 1, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type Shader(omni::fabric::BaseDataType::eTag, 1, 0, omni::fabric::AttributeRole::ePrimTypeName);
 const omni::fabric::Type subdivisionScheme(omni::fabric::BaseDataType::eToken, 1, 0, omni::fabric::AttributeRole::eNone);
+const omni::fabric::Type widths(omni::fabric::BaseDataType::eFloat, 1, 1, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type _cesium_gltfLocalToEcefTransform(omni::fabric::BaseDataType::eDouble, 16, 0, omni::fabric::AttributeRole::eMatrix);
 const omni::fabric::Type _cesium_tilesetId(omni::fabric::BaseDataType::eInt64, 1, 0, omni::fabric::AttributeRole::eNone);
+const omni::fabric::Type _cesium_tileset(omni::fabric::BaseDataType::eTag, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type _materialSource(omni::fabric::BaseDataType::eRelationship, 1, 0, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type _paramColorSpace(omni::fabric::BaseDataType::eToken, 1, 1, omni::fabric::AttributeRole::eNone);
 const omni::fabric::Type _sdrMetadata(omni::fabric::BaseDataType::eToken, 1, 1, omni::fabric::AttributeRole::eNone);
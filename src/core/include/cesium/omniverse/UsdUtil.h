@@ -88,11 +88,8 @@ CesiumGeospatial::LocalHorizontalCoordinateSystem computeLocalCoordinateSystem(
     const CesiumGeospatial::Cartographic& origin,
     const CesiumGeospatial::Ellipsoid& ellipsoid);
 
-Cesium3DTilesSelection::ViewState computeViewState(
-    const Context& context,
-    const pxr::SdfPath& georeferencePath,
-    const pxr::SdfPath& primPath,
-    const Viewport& viewport);
+Cesium3DTilesSelection::ViewState
+computeViewState(const glm::dmat4& primWorldToEcefTransform, const Viewport& viewport);
 
 bool primExists(const pxr::UsdStageWeakPtr& pStage, const pxr::SdfPath& path);
 bool isSchemaValid(const pxr::UsdSchemaBase& schema);
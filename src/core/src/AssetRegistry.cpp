@@ -16,35 +16,132 @@
 #include "cesium/omniverse/UsdUtil.h"
 #include "cesium/omniverse/Viewport.h"
 
+#include <chrono>
+
 namespace cesium::omniverse {
 
+namespace {
+
+template <typename T, typename Index>
+T& addAsset(
+    std::vector<std::unique_ptr<T>>& assets,
+    Index& index,
+    PathTrie<uint64_t>& assetPaths,
+    std::unique_ptr<T> pAsset) {
+    auto& asset = *assets.insert(assets.end(), std::move(pAsset))->get();
+
+    // If an asset with the same path was already added, lookups keep returning the first one
+    if (index.emplace(asset.getPath(), &asset).second) {
+        ++assetPaths.insert(asset.getPath());
+    }
+
+    return asset;
+}
+
+template <typename T, typename Index>
+void removeAsset(
+    std::vector<std::unique_ptr<T>>& assets,
+    Index& index,
+    PathTrie<uint64_t>& assetPaths,
+    const pxr::SdfPath& path) {
+    if (index.erase(path) == 0) {
+        return;
+    }
+
+    const auto pCount = assetPaths.find(path);
+    if (pCount && --(*pCount) == 0) {
+        assetPaths.erase(path);
+    }
+
+    CppUtil::eraseIf(assets, [&path](const auto& pAsset) { return pAsset->getPath() == path; });
+}
+
+template <typename Index> typename Index::mapped_type getAsset(const Index& index, const pxr::SdfPath& path) {
+    const auto iter = index.find(path);
+    if (iter == index.end()) {
+        return nullptr;
+    }
+
+    return iter->second;
+}
+
+} // namespace
+
 AssetRegistry::AssetRegistry(Context* pContext)
     : _pContext(pContext) {}
 
 AssetRegistry::~AssetRegistry() = default;
 
 void AssetRegistry::onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles) {
+    const auto start = std::chrono::steady_clock::now();
+
+    finishTileSelection();
+
+    // Pipelining doesn't apply when waiting for tiles to load since the tiles need to be rendered this frame
+    const auto pData = getFirstData();
+    const auto pipelined = !waitForLoadingTiles && pData && pData->getDebugPipelinedTileSelection();
+
     for (const auto& pTileset : _tilesets) {
-        pTileset->onUpdateFrame(viewports, waitForLoadingTiles);
+        if (!pipelined) {
+            pTileset->onUpdateFrame(viewports, waitForLoadingTiles);
+        } else if (pTileset->onUpdateFramePipelined(viewports)) {
+            _selectingTilesets.push_back(pTileset.get());
+        }
     }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    _tilesetUpdateTime = _tileSelectionWaitTime +
+                         static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    _tileSelectionWaitTime = 0;
+}
+
+void AssetRegistry::startTileSelection() {
+    if (_selectingTilesets.empty()) {
+        return;
+    }
+
+    // Tilesets are selected one after another rather than in parallel. Tileset::updateView dispatches the main thread
+    // tasks of every tileset, so two tilesets can't safely update at the same time.
+    _tileSelectionDispatcher.Run([this]() {
+        for (const auto pTileset : _selectingTilesets) {
+            pTileset->selectTiles();
+        }
+    });
+}
+
+void AssetRegistry::waitForTileSelection() const {
+    _tileSelectionDispatcher.Wait();
+}
+
+void AssetRegistry::finishTileSelection() {
+    if (_selectingTilesets.empty()) {
+        return;
+    }
+
+    // Time spent blocked on the worker is main thread time too, so it counts towards the tileset update time
+    const auto start = std::chrono::steady_clock::now();
+    waitForTileSelection();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    _tileSelectionWaitTime +=
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    _selectingTilesets.clear();
+}
+
+uint64_t AssetRegistry::getTilesetUpdateTime() const {
+    return _tilesetUpdateTime;
 }
 
 OmniData& AssetRegistry::addData(const pxr::SdfPath& path) {
-    return *_datas.insert(_datas.end(), std::make_unique<OmniData>(_pContext, path))->get();
+    return addAsset(_datas, _dataIndex, _assetPaths, std::make_unique<OmniData>(_pContext, path));
 }
 
 void AssetRegistry::removeData(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_datas, [&path](const auto& pData) { return pData->getPath() == path; });
+    removeAsset(_datas, _dataIndex, _assetPaths, path);
 }
 
 OmniData* AssetRegistry::getData(const pxr::SdfPath& path) const {
-    for (const auto& pData : _datas) {
-        if (pData->getPath() == path) {
-            return pData.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_dataIndex, path);
 }
 
 OmniData* AssetRegistry::getFirstData() const {
@@ -56,21 +153,18 @@ OmniData* AssetRegistry::getFirstData() const {
 }
 
 OmniTileset& AssetRegistry::addTileset(const pxr::SdfPath& path) {
-    return *_tilesets.insert(_tilesets.end(), std::make_unique<OmniTileset>(_pContext, path, _tilesetId++))->get();
+    return addAsset(
+        _tilesets, _tilesetIndex, _assetPaths, std::make_unique<OmniTileset>(_pContext, path, _tilesetId++));
 }
 
 void AssetRegistry::removeTileset(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_tilesets, [&path](const auto& pTileset) { return pTileset->getPath() == path; });
+    waitForTileSelection();
+    _selectingTilesets.clear();
+    removeAsset(_tilesets, _tilesetIndex, _assetPaths, path);
 }
 
 OmniTileset* AssetRegistry::getTileset(const pxr::SdfPath& path) const {
-    for (const auto& pTileset : _tilesets) {
-        if (pTileset->getPath() == path) {
-            return pTileset.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_tilesetIndex, path);
 }
 
 const std::vector<std::unique_ptr<OmniTileset>>& AssetRegistry::getTilesets() const {
@@ -78,24 +172,22 @@ const std::vector<std::unique_ptr<OmniTileset>>& AssetRegistry::getTilesets() co
 }
 
 OmniIonRasterOverlay& AssetRegistry::addIonRasterOverlay(const pxr::SdfPath& path) {
-    return *_ionRasterOverlays
-                .insert(_ionRasterOverlays.end(), std::make_unique<OmniIonRasterOverlay>(_pContext, path))
-                ->get();
+    auto& ionRasterOverlay = addAsset(
+        _ionRasterOverlays,
+        _ionRasterOverlayIndex,
+        _assetPaths,
+        std::make_unique<OmniIonRasterOverlay>(_pContext, path));
+    _rasterOverlayIndex.emplace(path, &ionRasterOverlay);
+    return ionRasterOverlay;
 }
 
 void AssetRegistry::removeIonRasterOverlay(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(
-        _ionRasterOverlays, [&path](const auto& pIonRasterOverlay) { return pIonRasterOverlay->getPath() == path; });
+    _rasterOverlayIndex.erase(path);
+    removeAsset(_ionRasterOverlays, _ionRasterOverlayIndex, _assetPaths, path);
 }
 
 OmniIonRasterOverlay* AssetRegistry::getIonRasterOverlay(const pxr::SdfPath& path) const {
-    for (const auto& pIonRasterOverlay : _ionRasterOverlays) {
-        if (pIonRasterOverlay->getPath() == path) {
-            return pIonRasterOverlay.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_ionRasterOverlayIndex, path);
 }
 
 OmniIonRasterOverlay* AssetRegistry::getIonRasterOverlayByIonAssetId(int64_t ionAssetId) const {
@@ -113,97 +205,79 @@ const std::vector<std::unique_ptr<OmniIonRasterOverlay>>& AssetRegistry::getIonR
 }
 
 OmniPolygonRasterOverlay& AssetRegistry::addPolygonRasterOverlay(const pxr::SdfPath& path) {
-    return *_polygonRasterOverlays
-                .insert(_polygonRasterOverlays.end(), std::make_unique<OmniPolygonRasterOverlay>(_pContext, path))
-                ->get();
+    auto& polygonRasterOverlay = addAsset(
+        _polygonRasterOverlays,
+        _polygonRasterOverlayIndex,
+        _assetPaths,
+        std::make_unique<OmniPolygonRasterOverlay>(_pContext, path));
+    _rasterOverlayIndex.emplace(path, &polygonRasterOverlay);
+    return polygonRasterOverlay;
 }
 
 void AssetRegistry::removePolygonRasterOverlay(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_polygonRasterOverlays, [&path](const auto& pPolygonRasterOverlay) {
-        return pPolygonRasterOverlay->getPath() == path;
-    });
+    _rasterOverlayIndex.erase(path);
+    removeAsset(_polygonRasterOverlays, _polygonRasterOverlayIndex, _assetPaths, path);
 }
 
 OmniPolygonRasterOverlay* AssetRegistry::getPolygonRasterOverlay(const pxr::SdfPath& path) const {
-    for (const auto& pPolygonRasterOverlay : _polygonRasterOverlays) {
-        if (pPolygonRasterOverlay->getPath() == path) {
-            return pPolygonRasterOverlay.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_polygonRasterOverlayIndex, path);
 }
 
 OmniWebMapServiceRasterOverlay& AssetRegistry::addWebMapServiceRasterOverlay(const pxr::SdfPath& path) {
-    return *_webMapServiceRasterOverlays
-                .insert(
-                    _webMapServiceRasterOverlays.end(),
-                    std::make_unique<OmniWebMapServiceRasterOverlay>(_pContext, path))
-                ->get();
+    auto& webMapServiceRasterOverlay = addAsset(
+        _webMapServiceRasterOverlays,
+        _webMapServiceRasterOverlayIndex,
+        _assetPaths,
+        std::make_unique<OmniWebMapServiceRasterOverlay>(_pContext, path));
+    _rasterOverlayIndex.emplace(path, &webMapServiceRasterOverlay);
+    return webMapServiceRasterOverlay;
 }
 
 void AssetRegistry::removeWebMapServiceRasterOverlay(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_webMapServiceRasterOverlays, [&path](const auto& pWebMapServiceRasterOverlay) {
-        return pWebMapServiceRasterOverlay->getPath() == path;
-    });
+    _rasterOverlayIndex.erase(path);
+    removeAsset(_webMapServiceRasterOverlays, _webMapServiceRasterOverlayIndex, _assetPaths, path);
 }
 
 OmniWebMapServiceRasterOverlay* AssetRegistry::getWebMapServiceRasterOverlay(const pxr::SdfPath& path) const {
-    for (const auto& pWebMapServiceRasterOverlay : _webMapServiceRasterOverlays) {
-        if (pWebMapServiceRasterOverlay->getPath() == path) {
-            return pWebMapServiceRasterOverlay.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_webMapServiceRasterOverlayIndex, path);
 }
 
 OmniTileMapServiceRasterOverlay& AssetRegistry::addTileMapServiceRasterOverlay(const pxr::SdfPath& path) {
-    return *_tileMapServiceRasterOverlays
-                .insert(
-                    _tileMapServiceRasterOverlays.end(),
-                    std::make_unique<OmniTileMapServiceRasterOverlay>(_pContext, path))
-                ->get();
+    auto& tileMapServiceRasterOverlay = addAsset(
+        _tileMapServiceRasterOverlays,
+        _tileMapServiceRasterOverlayIndex,
+        _assetPaths,
+        std::make_unique<OmniTileMapServiceRasterOverlay>(_pContext, path));
+    _rasterOverlayIndex.emplace(path, &tileMapServiceRasterOverlay);
+    return tileMapServiceRasterOverlay;
 }
 
 void AssetRegistry::removeTileMapServiceRasterOverlay(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_tileMapServiceRasterOverlays, [&path](const auto& pTileMapServiceRasterOverlay) {
-        return pTileMapServiceRasterOverlay->getPath() == path;
-    });
+    _rasterOverlayIndex.erase(path);
+    removeAsset(_tileMapServiceRasterOverlays, _tileMapServiceRasterOverlayIndex, _assetPaths, path);
 }
 
 OmniTileMapServiceRasterOverlay* AssetRegistry::getTileMapServiceRasterOverlay(const pxr::SdfPath& path) const {
-    for (const auto& pTileMapServiceRasterOverlay : _tileMapServiceRasterOverlays) {
-        if (pTileMapServiceRasterOverlay->getPath() == path) {
-            return pTileMapServiceRasterOverlay.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_tileMapServiceRasterOverlayIndex, path);
 }
 
 OmniWebMapTileServiceRasterOverlay& AssetRegistry::addWebMapTileServiceRasterOverlay(const pxr::SdfPath& path) {
-    return *_webMapTileServiceRasterOverlays
-                .insert(
-                    _webMapTileServiceRasterOverlays.end(),
-                    std::make_unique<OmniWebMapTileServiceRasterOverlay>(_pContext, path))
-                ->get();
+    auto& webMapTileServiceRasterOverlay = addAsset(
+        _webMapTileServiceRasterOverlays,
+        _webMapTileServiceRasterOverlayIndex,
+        _assetPaths,
+        std::make_unique<OmniWebMapTileServiceRasterOverlay>(_pContext, path));
+    _rasterOverlayIndex.emplace(path, &webMapTileServiceRasterOverlay);
+    return webMapTileServiceRasterOverlay;
 }
 
 void AssetRegistry::removeWebMapTileServiceRasterOverlay(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_webMapTileServiceRasterOverlays, [&path](const auto& pWebMapTileServiceRasterOverlay) {
-        return pWebMapTileServiceRasterOverlay->getPath() == path;
-    });
+    _rasterOverlayIndex.erase(path);
+    removeAsset(_webMapTileServiceRasterOverlays, _webMapTileServiceRasterOverlayIndex, _assetPaths, path);
 }
 
 OmniWebMapTileServiceRasterOverlay* AssetRegistry::getWebMapTileServiceRasterOverlay(const pxr::SdfPath& path) const {
-    for (const auto& pWebMapTileServiceRasterOverlay : _webMapTileServiceRasterOverlays) {
-        if (pWebMapTileServiceRasterOverlay->getPath() == path) {
-            return pWebMapTileServiceRasterOverlay.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_webMapTileServiceRasterOverlayIndex, path);
 }
 
 const std::vector<std::unique_ptr<OmniPolygonRasterOverlay>>& AssetRegistry::getPolygonRasterOverlays() const {
@@ -211,50 +285,20 @@ const std::vector<std::unique_ptr<OmniPolygonRasterOverlay>>& AssetRegistry::get
 }
 
 OmniRasterOverlay* AssetRegistry::getRasterOverlay(const pxr::SdfPath& path) const {
-    const auto pIonRasterOverlay = getIonRasterOverlay(path);
-    if (pIonRasterOverlay) {
-        return pIonRasterOverlay;
-    }
-
-    const auto pPolygonRasterOverlay = getPolygonRasterOverlay(path);
-    if (pPolygonRasterOverlay) {
-        return pPolygonRasterOverlay;
-    }
-
-    const auto pWebMapServiceRasterOverlay = getWebMapServiceRasterOverlay(path);
-    if (pWebMapServiceRasterOverlay) {
-        return pWebMapServiceRasterOverlay;
-    }
-
-    const auto pTileMapServiceRasterOverlay = getTileMapServiceRasterOverlay(path);
-    if (pTileMapServiceRasterOverlay) {
-        return pTileMapServiceRasterOverlay;
-    }
-
-    const auto pWebMapTileServiceRasterOverlay = getWebMapTileServiceRasterOverlay(path);
-    if (pWebMapTileServiceRasterOverlay) {
-        return pWebMapTileServiceRasterOverlay;
-    }
-
-    return nullptr;
+    return getAsset(_rasterOverlayIndex, path);
 }
 
 OmniGeoreference& AssetRegistry::addGeoreference(const pxr::SdfPath& path) {
-    return *_georeferences.insert(_georeferences.end(), std::make_unique<OmniGeoreference>(_pContext, path))->get();
+    return addAsset(
+        _georeferences, _georeferenceIndex, _assetPaths, std::make_unique<OmniGeoreference>(_pContext, path));
 }
 
 void AssetRegistry::removeGeoreference(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_georeferences, [&path](const auto& pGeoreference) { return pGeoreference->getPath() == path; });
+    removeAsset(_georeferences, _georeferenceIndex, _assetPaths, path);
 }
 
 OmniGeoreference* AssetRegistry::getGeoreference(const pxr::SdfPath& path) const {
-    for (const auto& pGeoreference : _georeferences) {
-        if (pGeoreference->getPath() == path) {
-            return pGeoreference.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_georeferenceIndex, path);
 }
 
 const std::vector<std::unique_ptr<OmniGeoreference>>& AssetRegistry::getGeoreferences() const {
@@ -270,42 +314,30 @@ OmniGeoreference* AssetRegistry::getFirstGeoreference() const {
 }
 
 OmniGlobeAnchor& AssetRegistry::addGlobeAnchor(const pxr::SdfPath& path) {
-    return *_globeAnchors.insert(_globeAnchors.end(), std::make_unique<OmniGlobeAnchor>(_pContext, path))->get();
+    return addAsset(_globeAnchors, _globeAnchorIndex, _assetPaths, std::make_unique<OmniGlobeAnchor>(_pContext, path));
 }
 
 void AssetRegistry::removeGlobeAnchor(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_globeAnchors, [&path](const auto& pGlobeAnchor) { return pGlobeAnchor->getPath() == path; });
+    removeAsset(_globeAnchors, _globeAnchorIndex, _assetPaths, path);
 }
 
 OmniGlobeAnchor* AssetRegistry::getGlobeAnchor(const pxr::SdfPath& path) const {
-    for (const auto& pGlobeAnchor : _globeAnchors) {
-        if (pGlobeAnchor->getPath() == path) {
-            return pGlobeAnchor.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_globeAnchorIndex, path);
 }
 const std::vector<std::unique_ptr<OmniGlobeAnchor>>& AssetRegistry::getGlobeAnchors() const {
     return _globeAnchors;
 }
 
 OmniIonServer& AssetRegistry::addIonServer(const pxr::SdfPath& path) {
-    return *_ionServers.insert(_ionServers.end(), std::make_unique<OmniIonServer>(_pContext, path))->get();
+    return addAsset(_ionServers, _ionServerIndex, _assetPaths, std::make_unique<OmniIonServer>(_pContext, path));
 }
 
 void AssetRegistry::removeIonServer(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_ionServers, [&path](const auto& pIonServer) { return pIonServer->getPath() == path; });
+    removeAsset(_ionServers, _ionServerIndex, _assetPaths, path);
 }
 
 OmniIonServer* AssetRegistry::getIonServer(const pxr::SdfPath& path) const {
-    for (const auto& pIonServer : _ionServers) {
-        if (pIonServer->getPath() == path) {
-            return pIonServer.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_ionServerIndex, path);
 }
 
 const std::vector<std::unique_ptr<OmniIonServer>>& AssetRegistry::getIonServers() const {
@@ -321,25 +353,19 @@ OmniIonServer* AssetRegistry::getFirstIonServer() const {
 }
 
 OmniCartographicPolygon& AssetRegistry::addCartographicPolygon(const pxr::SdfPath& path) {
-    return *_cartographicPolygons
-                .insert(_cartographicPolygons.end(), std::make_unique<OmniCartographicPolygon>(_pContext, path))
-                ->get();
+    return addAsset(
+        _cartographicPolygons,
+        _cartographicPolygonIndex,
+        _assetPaths,
+        std::make_unique<OmniCartographicPolygon>(_pContext, path));
 }
 
 void AssetRegistry::removeCartographicPolygon(const pxr::SdfPath& path) {
-    CppUtil::eraseIf(_cartographicPolygons, [&path](const auto& pCartographicPolygon) {
-        return pCartographicPolygon->getPath() == path;
-    });
+    removeAsset(_cartographicPolygons, _cartographicPolygonIndex, _assetPaths, path);
 }
 
 OmniCartographicPolygon* AssetRegistry::getCartographicPolygon(const pxr::SdfPath& path) const {
-    for (const auto& pCartographicPolygon : _cartographicPolygons) {
-        if (pCartographicPolygon->getPath() == path) {
-            return pCartographicPolygon.get();
-        }
-    }
-
-    return nullptr;
+    return getAsset(_cartographicPolygonIndex, path);
 }
 
 const std::vector<std::unique_ptr<OmniCartographicPolygon>>& AssetRegistry::getCartographicPolygons() const {
@@ -355,6 +381,12 @@ AssetType AssetRegistry::getAssetType(const pxr::SdfPath& path) const {
         return AssetType::ION_RASTER_OVERLAY;
     } else if (getPolygonRasterOverlay(path)) {
         return AssetType::POLYGON_RASTER_OVERLAY;
+    } else if (getWebMapServiceRasterOverlay(path)) {
+        return AssetType::WEB_MAP_SERVICE_RASTER_OVERLAY;
+    } else if (getTileMapServiceRasterOverlay(path)) {
+        return AssetType::TILE_MAP_SERVICE_RASTER_OVERLAY;
+    } else if (getWebMapTileServiceRasterOverlay(path)) {
+        return AssetType::WEB_MAP_TILE_SERVICE_RASTER_OVERLAY;
     } else if (getGeoreference(path)) {
         return AssetType::GEOREFERENCE;
     } else if (getIonServer(path)) {
@@ -373,15 +405,42 @@ bool AssetRegistry::hasAsset(const pxr::SdfPath& path) const {
     return getAssetType(path) != AssetType::OTHER;
 }
 
+std::vector<pxr::SdfPath> AssetRegistry::getPrimOrDescendantAssetPaths(const pxr::SdfPath& path) const {
+    std::vector<pxr::SdfPath> paths;
+    _assetPaths.forEachPrimOrDescendant(
+        path, [&paths](const pxr::SdfPath& assetPath, [[maybe_unused]] uint64_t count) { paths.push_back(assetPath); });
+    return paths;
+}
+
 void AssetRegistry::clear() {
+    waitForTileSelection();
+    _selectingTilesets.clear();
+
     _datas.clear();
     _tilesets.clear();
     _ionRasterOverlays.clear();
     _polygonRasterOverlays.clear();
+    _webMapServiceRasterOverlays.clear();
+    _tileMapServiceRasterOverlays.clear();
+    _webMapTileServiceRasterOverlays.clear();
     _georeferences.clear();
     _globeAnchors.clear();
     _ionServers.clear();
     _cartographicPolygons.clear();
+
+    _dataIndex.clear();
+    _tilesetIndex.clear();
+    _ionRasterOverlayIndex.clear();
+    _polygonRasterOverlayIndex.clear();
+    _webMapServiceRasterOverlayIndex.clear();
+    _tileMapServiceRasterOverlayIndex.clear();
+    _webMapTileServiceRasterOverlayIndex.clear();
+    _rasterOverlayIndex.clear();
+    _georeferenceIndex.clear();
+    _globeAnchorIndex.clear();
+    _ionServerIndex.clear();
+    _cartographicPolygonIndex.clear();
+    _assetPaths.clear();
 }
 
 } // namespace cesium::omniverse
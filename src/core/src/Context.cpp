@@ -73,6 +73,7 @@ Context::Context(const std::filesystem::path& cesiumExtensionLocation)
     , _cesiumMdlPathToken(pxr::TfToken((_cesiumExtensionLocation / "mdl" / "cesium.mdl").generic_string()))
     , _pTaskProcessor(std::make_shared<TaskProcessor>())
     , _pAsyncSystem(std::make_unique<CesiumAsync::AsyncSystem>(_pTaskProcessor))
+    , _pTilesetAsyncSystem(std::make_unique<CesiumAsync::AsyncSystem>(_pTaskProcessor))
     , _pLogger(std::make_shared<Logger>())
     , _pCacheDatabase(makeCacheDatabase(_pLogger))
     , _pCreditSystem(std::make_shared<CesiumUtility::CreditSystem>())
@@ -80,7 +81,8 @@ Context::Context(const std::filesystem::path& cesiumExtensionLocation)
     , _pFabricResourceManager(std::make_unique<FabricResourceManager>(this))
     , _pCesiumIonServerManager(std::make_unique<CesiumIonServerManager>(this))
     , _pUsdNotificationHandler(std::make_unique<UsdNotificationHandler>(this))
-    , _contextId(static_cast<int64_t>(getSecondsSinceEpoch())) {
+    , _contextId(static_cast<int64_t>(getSecondsSinceEpoch()))
+    , _mainThreadId(std::this_thread::get_id()) {
     if (_pCacheDatabase) {
         _pAssetAccessor = std::make_shared<CesiumAsync::CachingAssetAccessor>(
             _pLogger, std::make_shared<UrlAssetAccessor>(_certificatePath), _pCacheDatabase);
@@ -124,6 +126,10 @@ const CesiumAsync::AsyncSystem& Context::getAsyncSystem() const {
     return *_pAsyncSystem.get();
 }
 
+const CesiumAsync::AsyncSystem& Context::getTilesetAsyncSystem() const {
+    return *_pTilesetAsyncSystem.get();
+}
+
 std::shared_ptr<CesiumAsync::IAssetAccessor> Context::getAssetAccessor() const {
     return _pAssetAccessor;
 }
@@ -185,6 +191,9 @@ void Context::reloadStage() {
         _pFabricResourceManager->setGeometryPoolInitialCapacity(pData->getDebugGeometryPoolInitialCapacity());
         _pFabricResourceManager->setMaterialPoolInitialCapacity(pData->getDebugMaterialPoolInitialCapacity());
         _pFabricResourceManager->setTexturePoolInitialCapacity(pData->getDebugTexturePoolInitialCapacity());
+        _pFabricResourceManager->setPoolGrowthFactor(pData->getDebugPoolGrowthFactor());
+        _pFabricResourceManager->setPoolLowWaterMark(pData->getDebugPoolLowWaterMark());
+        _pFabricResourceManager->setPoolMaximumIdleTime(pData->getDebugPoolMaximumIdleTime());
         _pFabricResourceManager->setDebugRandomColors(pData->getDebugRandomColors());
     }
 }
@@ -196,9 +205,21 @@ void Context::clearAccessorCache() {
 }
 
 void Context::onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles) {
+    // Tile selection started last frame must finish before USD changes are processed
+    _pAssetRegistry->finishTileSelection();
+    runMainThreadTasks();
+
+    // Tilesets that don't update their view this frame still make loading progress
+    _pTilesetAsyncSystem->dispatchMainThreadTasks();
+
     _pUsdNotificationHandler->onUpdateFrame();
+    _pFabricResourceManager->onUpdateFrame();
     _pAssetRegistry->onUpdateFrame(viewports, waitForLoadingTiles);
     _pCesiumIonServerManager->onUpdateFrame();
+
+    // Credits added by the tile selection below are shown next frame, when the selection is applied
+    updateCredits();
+    _pAssetRegistry->startTileSelection();
 }
 
 void Context::onUsdStageChanged(int64_t usdStageId) {
@@ -228,6 +249,46 @@ void Context::onUsdStageChanged(int64_t usdStageId) {
     }
 }
 
+void Context::runInMainThread(std::function<void()> task) {
+    if (std::this_thread::get_id() != _mainThreadId) {
+        std::scoped_lock<std::mutex> lock(_mainThreadTasksMutex);
+        _mainThreadTasks.push_back(std::move(task));
+        return;
+    }
+
+    task();
+}
+
+const std::vector<std::pair<std::string, bool>>& Context::getCredits() const {
+    return _credits;
+}
+
+void Context::runMainThreadTasks() {
+    std::vector<std::function<void()>> tasks;
+
+    {
+        std::scoped_lock<std::mutex> lock(_mainThreadTasksMutex);
+        tasks.swap(_mainThreadTasks);
+    }
+
+    for (const auto& task : tasks) {
+        task();
+    }
+}
+
+void Context::updateCredits() {
+    const auto& credits = _pCreditSystem->getCreditsToShowThisFrame();
+
+    _credits.clear();
+    _credits.reserve(credits.size());
+
+    for (const auto& credit : credits) {
+        _credits.emplace_back(_pCreditSystem->getHtml(credit), _pCreditSystem->shouldBeShownOnScreen(credit));
+    }
+
+    _pCreditSystem->startNextFrame();
+}
+
 const pxr::UsdStageWeakPtr& Context::getUsdStage() const {
     return _pUsdStage;
 }
@@ -255,7 +316,30 @@ RenderStatistics Context::getRenderStatistics() const {
         return renderStatistics;
     }
 
-    const auto fabricStatistics = FabricUtil::getStatistics(getFabricStage());
+    auto fabricStatistics = _pFabricResourceManager->getStatistics();
+
+    const auto pData = _pAssetRegistry->getFirstData();
+    if (pData && pData->getDebugVerifyRenderStatistics()) {
+        const auto scannedStatistics = FabricUtil::getStatistics(getFabricStage());
+        if (scannedStatistics != fabricStatistics) {
+            _pLogger->warn(
+                "Render statistics don't match Fabric. Materials loaded: {} (expected {}). Geometries loaded: {} "
+                "(expected {}). Geometries rendered: {} (expected {}). Triangles rendered: {} (expected {}). "
+                "Geometry bytes loaded: {} (expected {}).",
+                fabricStatistics.materialsLoaded,
+                scannedStatistics.materialsLoaded,
+                fabricStatistics.geometriesLoaded,
+                scannedStatistics.geometriesLoaded,
+                fabricStatistics.geometriesRendered,
+                scannedStatistics.geometriesRendered,
+                fabricStatistics.trianglesRendered,
+                scannedStatistics.trianglesRendered,
+                fabricStatistics.geometryBytesLoaded,
+                scannedStatistics.geometryBytesLoaded);
+            fabricStatistics = scannedStatistics;
+        }
+    }
+
     renderStatistics.materialsCapacity = fabricStatistics.materialsCapacity;
     renderStatistics.materialsLoaded = fabricStatistics.materialsLoaded;
     renderStatistics.geometriesCapacity = fabricStatistics.geometriesCapacity;
@@ -263,6 +347,21 @@ RenderStatistics Context::getRenderStatistics() const {
     renderStatistics.geometriesRendered = fabricStatistics.geometriesRendered;
     renderStatistics.trianglesLoaded = fabricStatistics.trianglesLoaded;
     renderStatistics.trianglesRendered = fabricStatistics.trianglesRendered;
+    renderStatistics.pointsLoaded = fabricStatistics.pointsLoaded;
+    renderStatistics.pointsRendered = fabricStatistics.pointsRendered;
+    renderStatistics.geometryBytesLoaded = fabricStatistics.geometryBytesLoaded;
+    renderStatistics.geometryPrimitivesLoaded = _pFabricResourceManager->getGeometryPrimitivesLoaded();
+    renderStatistics.geometryPrimitivesMerged = _pFabricResourceManager->getGeometryPrimitivesMerged();
+    renderStatistics.texturePoolHits = _pFabricResourceManager->getTexturePoolHits();
+    renderStatistics.texturePoolMisses = _pFabricResourceManager->getTexturePoolMisses();
+    renderStatistics.textureBytesLoaded = _pFabricResourceManager->getTextureBytesLoaded();
+    renderStatistics.sharedTexturesLoaded = _pFabricResourceManager->getSharedTexturesLoaded();
+    renderStatistics.sharedTextureHits = _pFabricResourceManager->getSharedTextureHits();
+    renderStatistics.texturesCompressed = _pFabricResourceManager->getTexturesCompressed();
+    renderStatistics.textureCompressionInputBytes = _pFabricResourceManager->getTextureCompressionInputBytes();
+    renderStatistics.textureCompressionOutputBytes = _pFabricResourceManager->getTextureCompressionOutputBytes();
+    renderStatistics.textureCompressionTime = _pFabricResourceManager->getTextureCompressionTime();
+    renderStatistics.tilesetUpdateTime = _pAssetRegistry->getTilesetUpdateTime();
 
     const auto& tilesets = _pAssetRegistry->getTilesets();
     for (const auto& pTileset : tilesets) {
@@ -276,6 +375,7 @@ RenderStatistics Context::getRenderStatistics() const {
         renderStatistics.tilesLoadingWorker += tilesetStatistics.tilesLoadingWorker;
         renderStatistics.tilesLoadingMain += tilesetStatistics.tilesLoadingMain;
         renderStatistics.tilesLoaded += tilesetStatistics.tilesLoaded;
+        renderStatistics.visibilityWrites += tilesetStatistics.visibilityWrites;
     }
 
     return renderStatistics;
@@ -20,10 +20,14 @@
 #endif
 
 #include <CesiumGltf/Model.h>
+#include <CesiumUtility/Tracing.h>
 #include <omni/fabric/FabricUSD.h>
 #include <omni/fabric/SimStageWithHistory.h>
 #include <pxr/base/gf/range3d.h>
 
+#include <array>
+#include <cstring>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -36,21 +40,69 @@ const auto DEFAULT_SCALE = glm::dvec3(1.0, 1.0, 1.0);
 const auto DEFAULT_MATRIX = glm::dmat4(1.0);
 const auto DEFAULT_VISIBILITY = false;
 
-template <DataType T>
-void setVertexAttributeValues(
+// Matches the size of the voxels that points are expanded into when rendered as voxels
+const auto POINT_WIDTH = 3.0f;
+
+// Two triangles per voxel face. Front, left, right, top, bottom, back.
+// clang-format off
+const auto VOXEL_FACE_VERTEX_INDICES = std::array<int, 36>{{
+    0, 1, 2, 0, 2, 3,
+    4, 5, 1, 4, 1, 0,
+    3, 2, 6, 3, 6, 7,
+    1, 5, 6, 1, 5, 2,
+    3, 7, 4, 3, 4, 0,
+    7, 6, 5, 7, 5, 4,
+}};
+// clang-format on
+
+template <typename T>
+void copyArrayAttribute(
     omni::fabric::StageReaderWriter& fabricStage,
     const omni::fabric::Path& path,
+    const omni::fabric::TokenC& attributeName,
+    const std::vector<T>& values) {
+    fabricStage.setArrayAttributeSize(path, attributeName, values.size());
+
+    if (values.empty()) {
+        return;
+    }
+
+    const auto fabricValues = fabricStage.getArrayAttributeWr<T>(path, attributeName);
+    std::memcpy(fabricValues.data(), values.data(), values.size() * sizeof(T));
+}
+
+template <DataType T>
+void getVertexAttributeValues(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
     const FabricVertexAttributeDescriptor& attribute,
-    uint64_t repeat) {
+    uint64_t repeat,
+    std::vector<std::byte>& bytes) {
+    using PrimvarType = DataTypeUtil::GetNativeType<DataTypeUtil::getPrimvarType<T>()>;
 
     const auto accessor = GltfUtil::getVertexAttributeValues<T>(model, primitive, attribute.gltfAttributeName);
-    fabricStage.setArrayAttributeSize(path, attribute.fabricAttributeName, accessor.size() * repeat);
-    const auto fabricValues =
-        fabricStage.getArrayAttributeWr<DataTypeUtil::GetNativeType<DataTypeUtil::getPrimvarType<T>()>>(
-            path, attribute.fabricAttributeName);
-    accessor.fill(fabricValues, repeat);
+    const auto size = accessor.size() * repeat;
+    bytes.resize(size * sizeof(PrimvarType));
+    accessor.fill(gsl::span<PrimvarType>(reinterpret_cast<PrimvarType*>(bytes.data()), size), repeat);
+}
+
+template <DataType T>
+void setVertexAttributeValues(
+    omni::fabric::StageReaderWriter& fabricStage,
+    const omni::fabric::Path& path,
+    const FabricVertexAttributeDescriptor& attribute,
+    const std::vector<std::byte>& bytes) {
+    using PrimvarType = DataTypeUtil::GetNativeType<DataTypeUtil::getPrimvarType<T>()>;
+
+    const auto size = bytes.size() / sizeof(PrimvarType);
+    fabricStage.setArrayAttributeSize(path, attribute.fabricAttributeName, size);
+
+    if (size == 0) {
+        return;
+    }
+
+    const auto fabricValues = fabricStage.getArrayAttributeWr<PrimvarType>(path, attribute.fabricAttributeName);
+    std::memcpy(fabricValues.data(), bytes.data(), bytes.size());
 }
 
 } // namespace
@@ -64,42 +116,54 @@ FabricGeometry::FabricGeometry(
     , _path(path)
     , _geometryDescriptor(geometryDescriptor)
     , _poolId(poolId)
-    , _stageId(pContext->getUsdStageId()) {
-    if (stageDestroyed()) {
+    , _stageId(pContext->getUsdStageId())
+    , _tilesetTagId(FabricUtil::NO_TILESET_ID)
+    , _pStatisticsCounter(pContext->getFabricResourceManager().getStatisticsCounter()) {
+    // The Fabric prim isn't created until initialize is called from the main thread. This allows geometry to be
+    // constructed and handed out from worker threads.
+}
+
+FabricGeometry::~FabricGeometry() {
+    _pStatisticsCounter->update(_statistics, {});
+
+    if (!_initialized || stageDestroyed()) {
         return;
     }
 
-    initialize();
-    reset();
+    FabricUtil::destroyPrim(_pContext->getFabricStage(), _path);
 }
 
-FabricGeometry::~FabricGeometry() {
-    if (stageDestroyed()) {
+void FabricGeometry::initialize() {
+    if (_initialized || stageDestroyed()) {
         return;
     }
 
-    FabricUtil::destroyPrim(_pContext->getFabricStage(), _path);
+    createPrim();
+    reset();
+
+    _initialized = true;
 }
 
 void FabricGeometry::setActive(bool active) {
-    if (stageDestroyed()) {
+    if (active) {
+        // Nothing to do when acquired. This may be called from a worker thread.
         return;
     }
 
-    if (!active) {
-        reset();
+    if (!_initialized || stageDestroyed()) {
+        return;
     }
+
+    reset();
 }
 
-void FabricGeometry::setVisibility(bool visible) {
-    if (stageDestroyed()) {
+void FabricGeometry::setRendered(bool rendered) {
+    if (!_initialized) {
         return;
     }
 
-    auto& fabricStage = _pContext->getFabricStage();
-
-    const auto worldVisibilityFabric = fabricStage.getAttributeWr<bool>(_path, FabricTokens::_worldVisibility);
-    *worldVisibilityFabric = visible;
+    _rendered = rendered;
+    updateStatistics();
 }
 
 const omni::fabric::Path& FabricGeometry::getPath() const {
@@ -126,7 +190,8 @@ void FabricGeometry::setMaterial(const omni::fabric::Path& materialPath) {
     materialBindingFabric[0] = materialPath;
 }
 
-void FabricGeometry::initialize() {
+void FabricGeometry::createPrim() {
+    const auto isPointCloud = _geometryDescriptor.isPointCloud();
     const auto hasNormals = _geometryDescriptor.hasNormals();
     const auto hasVertexColors = _geometryDescriptor.hasVertexColors();
     const auto texcoordSetCount = _geometryDescriptor.getTexcoordSetCount();
@@ -140,25 +205,31 @@ void FabricGeometry::initialize() {
 
     // clang-format off
     FabricAttributesBuilder attributes(_pContext);
-    attributes.addAttribute(FabricTypes::faceVertexCounts, FabricTokens::faceVertexCounts);
-    attributes.addAttribute(FabricTypes::faceVertexIndices, FabricTokens::faceVertexIndices);
     attributes.addAttribute(FabricTypes::points, FabricTokens::points);
     attributes.addAttribute(FabricTypes::extent, FabricTokens::extent);
     attributes.addAttribute(FabricTypes::_worldExtent, FabricTokens::_worldExtent);
     attributes.addAttribute(FabricTypes::_worldVisibility, FabricTokens::_worldVisibility);
     attributes.addAttribute(FabricTypes::primvars, FabricTokens::primvars);
     attributes.addAttribute(FabricTypes::primvarInterpolations, FabricTokens::primvarInterpolations);
-    attributes.addAttribute(FabricTypes::Mesh, FabricTokens::Mesh);
     attributes.addAttribute(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId);
     attributes.addAttribute(FabricTypes::_cesium_gltfLocalToEcefTransform, FabricTokens::_cesium_gltfLocalToEcefTransform);
     attributes.addAttribute(FabricTypes::_worldPosition, FabricTokens::_worldPosition);
     attributes.addAttribute(FabricTypes::_worldOrientation, FabricTokens::_worldOrientation);
     attributes.addAttribute(FabricTypes::_worldScale, FabricTokens::_worldScale);
     attributes.addAttribute(FabricTypes::doubleSided, FabricTokens::doubleSided);
-    attributes.addAttribute(FabricTypes::subdivisionScheme, FabricTokens::subdivisionScheme);
     attributes.addAttribute(FabricTypes::material_binding, FabricTokens::material_binding);
     // clang-format on
 
+    if (isPointCloud) {
+        attributes.addAttribute(FabricTypes::Points, FabricTokens::Points);
+        attributes.addAttribute(FabricTypes::widths, FabricTokens::widths);
+    } else {
+        attributes.addAttribute(FabricTypes::Mesh, FabricTokens::Mesh);
+        attributes.addAttribute(FabricTypes::faceVertexCounts, FabricTokens::faceVertexCounts);
+        attributes.addAttribute(FabricTypes::faceVertexIndices, FabricTokens::faceVertexIndices);
+        attributes.addAttribute(FabricTypes::subdivisionScheme, FabricTokens::subdivisionScheme);
+    }
+
     for (uint64_t i = 0; i < texcoordSetCount; ++i) {
         attributes.addAttribute(FabricTypes::primvars_st, FabricTokens::primvars_st_n(i));
     }
@@ -182,9 +253,11 @@ void FabricGeometry::initialize() {
 
     attributes.createAttributes(_path);
 
-    const auto subdivisionSchemeFabric =
-        fabricStage.getAttributeWr<omni::fabric::TokenC>(_path, FabricTokens::subdivisionScheme);
-    *subdivisionSchemeFabric = FabricTokens::none;
+    if (!isPointCloud) {
+        const auto subdivisionSchemeFabric =
+            fabricStage.getAttributeWr<omni::fabric::TokenC>(_path, FabricTokens::subdivisionScheme);
+        *subdivisionSchemeFabric = FabricTokens::none;
+    }
 
     // Initialize primvars
     uint64_t primvarsCount = 0;
@@ -254,6 +327,7 @@ void FabricGeometry::initialize() {
 }
 
 void FabricGeometry::reset() {
+    const auto isPointCloud = _geometryDescriptor.isPointCloud();
     const auto hasNormals = _geometryDescriptor.hasNormals();
     const auto hasVertexColors = _geometryDescriptor.hasVertexColors();
     const auto texcoordSetCount = _geometryDescriptor.getTexcoordSetCount();
@@ -262,6 +336,9 @@ void FabricGeometry::reset() {
 
     auto& fabricStage = _pContext->getFabricStage();
 
+    // Moves the prim to another bucket so it must happen before any attribute pointers are acquired
+    setTilesetTag(FabricUtil::NO_TILESET_ID);
+
     // clang-format off
     const auto doubleSidedFabric = fabricStage.getAttributeWr<bool>(_path, FabricTokens::doubleSided);
     const auto extentFabric = fabricStage.getAttributeWr<pxr::GfRange3d>(_path, FabricTokens::extent);
@@ -285,10 +362,15 @@ void FabricGeometry::reset() {
     *tilesetIdFabric = FabricUtil::NO_TILESET_ID;
 
     fabricStage.setArrayAttributeSize(_path, FabricTokens::material_binding, 0);
-    fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, 0);
-    fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, 0);
     fabricStage.setArrayAttributeSize(_path, FabricTokens::points, 0);
 
+    if (isPointCloud) {
+        fabricStage.setArrayAttributeSize(_path, FabricTokens::widths, 0);
+    } else {
+        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, 0);
+        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, 0);
+    }
+
     for (uint64_t i = 0; i < texcoordSetCount; ++i) {
         fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_st_n(i), 0);
     }
@@ -308,83 +390,78 @@ void FabricGeometry::reset() {
     if (hasVertexIds) {
         fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_vertexId, 0);
     }
+
+    _loaded = false;
+    _rendered = false;
+    _elementCount = 0;
+    _byteSize = 0;
+    updateStatistics();
 }
 
-void FabricGeometry::setGeometry(
-    int64_t tilesetId,
-    const glm::dmat4& ecefToPrimWorldTransform,
-    const glm::dmat4& gltfLocalToEcefTransform,
+FabricGeometryData FabricGeometry::computeGeometryData(
+    const FabricGeometryDescriptor& geometryDescriptor,
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
     const FabricMaterialInfo& materialInfo,
     bool smoothNormals,
     const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
     const std::unordered_map<uint64_t, uint64_t>& rasterOverlayTexcoordIndexMapping) {
+    CESIUM_TRACE("FabricGeometry::computeGeometryData");
 
-    if (stageDestroyed()) {
-        return;
-    }
-
-    const auto hasNormals = _geometryDescriptor.hasNormals();
-    const auto hasVertexColors = _geometryDescriptor.hasVertexColors();
-    const auto& customVertexAttributes = _geometryDescriptor.getCustomVertexAttributes();
-    const auto hasVertexIds = _geometryDescriptor.hasVertexIds();
-
-    auto& fabricStage = _pContext->getFabricStage();
+    const auto hasNormals = geometryDescriptor.hasNormals();
+    const auto hasVertexColors = geometryDescriptor.hasVertexColors();
+    const auto texcoordSetCount = geometryDescriptor.getTexcoordSetCount();
+    const auto& customVertexAttributes = geometryDescriptor.getCustomVertexAttributes();
+    const auto hasVertexIds = geometryDescriptor.hasVertexIds();
 
     const auto positions = GltfUtil::getPositions(model, primitive);
     const auto indices = GltfUtil::getIndices(model, primitive, positions);
-    const auto normals = GltfUtil::getNormals(model, primitive, positions, indices, smoothNormals);
-    const auto vertexColors = GltfUtil::getVertexColors(model, primitive, 0);
-    const auto vertexIds = GltfUtil::getVertexIds(positions);
     const auto gltfLocalExtent = GltfUtil::getExtent(model, primitive);
-    const auto faceVertexCounts = GltfUtil::getFaceVertexCounts(indices);
+
+    FabricGeometryData geometryData;
 
     if (positions.size() == 0 || indices.size() == 0 || !gltfLocalExtent.has_value()) {
-        return;
+        return geometryData;
     }
 
-    const auto doubleSided = materialInfo.doubleSided;
-    const auto gltfLocalToPrimWorldTransform = ecefToPrimWorldTransform * gltfLocalToEcefTransform;
-    const auto [primWorldPosition, primWorldOrientation, primWorldScale] =
-        MathUtil::decompose(gltfLocalToPrimWorldTransform);
-    const auto primWorldExtent = MathUtil::transformExtent(gltfLocalExtent.value(), gltfLocalToPrimWorldTransform);
+    geometryData.extent = gltfLocalExtent;
+    geometryData.doubleSided = materialInfo.doubleSided;
 
-    if (primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS) {
+    const auto vertexColors = GltfUtil::getVertexColors(model, primitive, 0);
+    const auto vertexIds = GltfUtil::getVertexIds(positions);
+
+    if (primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS && !geometryDescriptor.isPointCloud()) {
         const auto numVoxels = positions.size();
         const auto shapeHalfSize = 1.5f;
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::points, numVoxels * 8);
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, numVoxels * 2 * 6);
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, numVoxels * 6 * 2 * 3);
 
-        const auto pointsFabric = fabricStage.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::points);
-        const auto faceVertexCountsFabric = fabricStage.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexCounts);
-        const auto faceVertexIndicesFabric =
-            fabricStage.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexIndices);
+        auto& points = geometryData.points;
+        auto& faceVertexCounts = geometryData.faceVertexCounts;
+        auto& faceVertexIndices = geometryData.faceVertexIndices;
+
+        points.resize(numVoxels * 8);
+        faceVertexCounts.resize(numVoxels * 2 * 6);
+        faceVertexIndices.resize(numVoxels * 6 * 2 * 3);
 
         if (hasVertexColors) {
-            fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_COLOR_0, numVoxels * 8);
-            const auto vertexColorsFabric =
-                fabricStage.getArrayAttributeWr<glm::fvec4>(_path, FabricTokens::primvars_COLOR_0);
-            vertexColors.fill(vertexColorsFabric, 8);
+            geometryData.vertexColors.resize(numVoxels * 8);
+            vertexColors.fill(geometryData.vertexColors, 8);
         }
 
         if (hasVertexIds) {
-            fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_vertexId, numVoxels * 8);
-            const auto vertexIdsFabric = fabricStage.getArrayAttributeWr<float>(_path, FabricTokens::primvars_vertexId);
-            vertexIds.fill(vertexIdsFabric, 8);
+            geometryData.vertexIds.resize(numVoxels * 8);
+            vertexIds.fill(geometryData.vertexIds, 8);
         }
 
+        geometryData.customVertexAttributes.reserve(customVertexAttributes.size());
         for (const auto& customVertexAttribute : customVertexAttributes) {
             CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
-                setVertexAttributeValues,
+                getVertexAttributeValues,
                 customVertexAttribute.type,
-                fabricStage,
-                _path,
                 model,
                 primitive,
                 customVertexAttribute,
-                uint64_t(8));
+                uint64_t(8),
+                geometryData.customVertexAttributes.emplace_back());
         }
 
         uint64_t vertIndex = 0;
@@ -393,83 +470,53 @@ void FabricGeometry::setGeometry(
         for (uint64_t voxelIndex = 0; voxelIndex < numVoxels; ++voxelIndex) {
             const auto& center = positions.get(voxelIndex);
 
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
+            points[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
 
             for (int i = 0; i < 6; ++i) {
-                faceVertexCountsFabric[vertexCountsIndex++] = 3;
-                faceVertexCountsFabric[vertexCountsIndex++] = 3;
+                faceVertexCounts[vertexCountsIndex++] = 3;
+                faceVertexCounts[vertexCountsIndex++] = 3;
             }
 
-            // front
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            // left
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            // right
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            // top
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            // bottom
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            // back
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
+            const auto offset = static_cast<int>(voxelIndex * 8);
+
+            for (const auto index : VOXEL_FACE_VERTEX_INDICES) {
+                faceVertexIndices[faceVertexIndex++] = index + offset;
+            }
         }
     } else {
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, faceVertexCounts.size());
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, indices.size());
-        fabricStage.setArrayAttributeSize(_path, FabricTokens::points, positions.size());
-
-        const auto faceVertexCountsFabric = fabricStage.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexCounts);
-        const auto faceVertexIndicesFabric =
-            fabricStage.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexIndices);
-        const auto pointsFabric = fabricStage.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::points);
-
-        faceVertexCounts.fill(faceVertexCountsFabric);
-        indices.fill(faceVertexIndicesFabric);
-        positions.fill(pointsFabric);
-
-        const auto fillTexcoords = [this, &fabricStage](uint64_t texcoordIndex, const TexcoordsAccessor& texcoords) {
-            assert(texcoordIndex < _geometryDescriptor.getTexcoordSetCount());
-            const auto& primvarStToken = FabricTokens::primvars_st_n(texcoordIndex);
-            fabricStage.setArrayAttributeSize(_path, primvarStToken, texcoords.size());
-            const auto stFabric = fabricStage.getArrayAttributeWr<glm::fvec2>(_path, primvarStToken);
-            texcoords.fill(stFabric);
+        // Smooth normals are generated below from the already filled points and indices
+        const auto normals = GltfUtil::getNormals(model, primitive, positions, indices, false);
+
+        geometryData.points.resize(positions.size());
+        positions.fill(geometryData.points);
+
+        if (geometryDescriptor.isPointCloud()) {
+            // Native points don't have faces. Every per-vertex attribute maps directly to a per-point primvar.
+            geometryData.widths.assign(positions.size(), POINT_WIDTH);
+        } else {
+            const auto faceVertexCounts = GltfUtil::getFaceVertexCounts(indices);
+
+            geometryData.faceVertexCounts.resize(faceVertexCounts.size());
+            geometryData.faceVertexIndices.resize(indices.size());
+
+            faceVertexCounts.fill(geometryData.faceVertexCounts);
+            indices.fill(geometryData.faceVertexIndices);
+        }
+
+        geometryData.texcoords.resize(texcoordSetCount);
+
+        const auto fillTexcoords = [&geometryData](uint64_t texcoordIndex, const TexcoordsAccessor& texcoords) {
+            assert(texcoordIndex < geometryData.texcoords.size());
+            auto& st = geometryData.texcoords[texcoordIndex];
+            st.resize(texcoords.size());
+            texcoords.fill(st);
         };
 
         for (const auto& [gltfSetIndex, primvarStIndex] : texcoordIndexMapping) {
@@ -483,44 +530,108 @@ void FabricGeometry::setGeometry(
         }
 
         if (hasNormals) {
-            fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_normals, normals.size());
-
-            const auto normalsFabric =
-                fabricStage.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::primvars_normals);
-
-            normals.fill(normalsFabric);
+            if (normals.size() > 0) {
+                geometryData.normals.resize(normals.size());
+                normals.fill(geometryData.normals);
+            } else if (smoothNormals) {
+                geometryData.normals.resize(geometryData.points.size());
+                MathUtil::computeSmoothNormals(
+                    geometryData.points, geometryData.faceVertexIndices, geometryData.normals);
+            }
         }
 
         if (hasVertexColors) {
-            fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_COLOR_0, vertexColors.size());
-
-            const auto vertexColorsFabric =
-                fabricStage.getArrayAttributeWr<glm::fvec4>(_path, FabricTokens::primvars_COLOR_0);
-
-            vertexColors.fill(vertexColorsFabric);
+            geometryData.vertexColors.resize(vertexColors.size());
+            vertexColors.fill(geometryData.vertexColors);
         }
 
         if (hasVertexIds) {
-            fabricStage.setArrayAttributeSize(_path, FabricTokens::primvars_vertexId, vertexIds.size());
-
-            const auto vertexIdsFabric = fabricStage.getArrayAttributeWr<float>(_path, FabricTokens::primvars_vertexId);
-
-            vertexIds.fill(vertexIdsFabric);
+            geometryData.vertexIds.resize(vertexIds.size());
+            vertexIds.fill(geometryData.vertexIds);
         }
 
+        geometryData.customVertexAttributes.reserve(customVertexAttributes.size());
         for (const auto& customVertexAttribute : customVertexAttributes) {
             CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
-                setVertexAttributeValues,
+                getVertexAttributeValues,
                 customVertexAttribute.type,
-                fabricStage,
-                _path,
                 model,
                 primitive,
                 customVertexAttribute,
-                uint64_t(1));
+                uint64_t(1),
+                geometryData.customVertexAttributes.emplace_back());
         }
     }
 
+    return geometryData;
+}
+
+void FabricGeometry::setGeometry(
+    int64_t tilesetId,
+    const glm::dmat4& ecefToPrimWorldTransform,
+    const glm::dmat4& gltfLocalToEcefTransform,
+    const FabricGeometryData& geometryData) {
+
+    if (stageDestroyed()) {
+        return;
+    }
+
+    if (geometryData.points.empty() || !geometryData.extent.has_value()) {
+        return;
+    }
+
+    const auto hasNormals = _geometryDescriptor.hasNormals();
+    const auto hasVertexColors = _geometryDescriptor.hasVertexColors();
+    const auto& customVertexAttributes = _geometryDescriptor.getCustomVertexAttributes();
+    const auto hasVertexIds = _geometryDescriptor.hasVertexIds();
+
+    auto& fabricStage = _pContext->getFabricStage();
+
+    // Moves the prim to another bucket so it must happen before any attribute pointers are acquired
+    setTilesetTag(tilesetId);
+
+    const auto& gltfLocalExtent = geometryData.extent.value();
+    const auto gltfLocalToPrimWorldTransform = ecefToPrimWorldTransform * gltfLocalToEcefTransform;
+    const auto [primWorldPosition, primWorldOrientation, primWorldScale] =
+        MathUtil::decompose(gltfLocalToPrimWorldTransform);
+    const auto primWorldExtent = MathUtil::transformExtent(gltfLocalExtent, gltfLocalToPrimWorldTransform);
+
+    copyArrayAttribute(fabricStage, _path, FabricTokens::points, geometryData.points);
+
+    if (_geometryDescriptor.isPointCloud()) {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::widths, geometryData.widths);
+    } else {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::faceVertexCounts, geometryData.faceVertexCounts);
+        copyArrayAttribute(fabricStage, _path, FabricTokens::faceVertexIndices, geometryData.faceVertexIndices);
+    }
+
+    for (uint64_t i = 0; i < geometryData.texcoords.size(); ++i) {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::primvars_st_n(i), geometryData.texcoords[i]);
+    }
+
+    if (hasNormals) {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::primvars_normals, geometryData.normals);
+    }
+
+    if (hasVertexColors) {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::primvars_COLOR_0, geometryData.vertexColors);
+    }
+
+    if (hasVertexIds) {
+        copyArrayAttribute(fabricStage, _path, FabricTokens::primvars_vertexId, geometryData.vertexIds);
+    }
+
+    for (uint64_t i = 0; i < geometryData.customVertexAttributes.size(); ++i) {
+        const auto& customVertexAttribute = CppUtil::getElementByIndex(customVertexAttributes, i);
+        CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
+            setVertexAttributeValues,
+            customVertexAttribute.type,
+            fabricStage,
+            _path,
+            customVertexAttribute,
+            geometryData.customVertexAttributes[i]);
+    }
+
     // clang-format off
     const auto doubleSidedFabric = fabricStage.getAttributeWr<bool>(_path, FabricTokens::doubleSided);
     const auto extentFabric = fabricStage.getAttributeWr<pxr::GfRange3d>(_path, FabricTokens::extent);
@@ -532,14 +643,66 @@ void FabricGeometry::setGeometry(
     const auto tilesetIdFabric = fabricStage.getAttributeWr<int64_t>(_path, FabricTokens::_cesium_tilesetId);
     // clang-format on
 
-    *doubleSidedFabric = doubleSided;
-    *extentFabric = UsdUtil::glmToUsdExtent(gltfLocalExtent.value());
+    *doubleSidedFabric = geometryData.doubleSided;
+    *extentFabric = UsdUtil::glmToUsdExtent(gltfLocalExtent);
     *worldExtentFabric = UsdUtil::glmToUsdExtent(primWorldExtent);
     *gltfLocalToEcefTransformFabric = UsdUtil::glmToUsdMatrix(gltfLocalToEcefTransform);
     *worldPositionFabric = UsdUtil::glmToUsdVector(primWorldPosition);
     *worldOrientationFabric = UsdUtil::glmToUsdQuat(glm::fquat(primWorldOrientation));
     *worldScaleFabric = UsdUtil::glmToUsdVector(glm::fvec3(primWorldScale));
     *tilesetIdFabric = tilesetId;
+
+    _loaded = true;
+    _elementCount =
+        _geometryDescriptor.isPointCloud() ? geometryData.points.size() : geometryData.faceVertexCounts.size();
+    _byteSize = FabricUtil::getArrayAttributesByteSize(fabricStage, _path);
+    updateStatistics();
+}
+
+void FabricGeometry::setTilesetTag(int64_t tilesetId) {
+    // Each tileset's prims share a tag so that FabricUtil::setTilesetTransform only visits the buckets that hold
+    // prims of that tileset
+    if (tilesetId == _tilesetTagId) {
+        return;
+    }
+
+    auto& fabricStage = _pContext->getFabricStage();
+
+    if (_tilesetTagId != FabricUtil::NO_TILESET_ID) {
+        fabricStage.destroyAttribute(_path, FabricTokens::_cesium_tileset_n(static_cast<uint64_t>(_tilesetTagId)));
+    }
+
+    if (tilesetId != FabricUtil::NO_TILESET_ID) {
+        fabricStage.createAttribute(
+            _path, FabricTokens::_cesium_tileset_n(static_cast<uint64_t>(tilesetId)), FabricTypes::_cesium_tileset);
+    }
+
+    _tilesetTagId = tilesetId;
+}
+
+void FabricGeometry::updateStatistics() {
+    // Matches what FabricUtil::getStatistics counts when it scans Fabric. Geometry that isn't loaded isn't counted as
+    // rendered even if it's visible.
+    FabricStatistics statistics;
+    statistics.geometriesCapacity = 1;
+
+    if (_loaded) {
+        const auto isPointCloud = _geometryDescriptor.isPointCloud();
+        auto& elementsLoaded = isPointCloud ? statistics.pointsLoaded : statistics.trianglesLoaded;
+        auto& elementsRendered = isPointCloud ? statistics.pointsRendered : statistics.trianglesRendered;
+
+        statistics.geometriesLoaded = 1;
+        statistics.geometryBytesLoaded = _byteSize;
+        elementsLoaded = _elementCount;
+
+        if (_rendered) {
+            statistics.geometriesRendered = 1;
+            elementsRendered = _elementCount;
+        }
+    }
+
+    _pStatisticsCounter->update(_statistics, statistics);
+    _statistics = statistics;
 }
 
 bool FabricGeometry::stageDestroyed() {
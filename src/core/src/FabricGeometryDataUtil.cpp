@@ -0,0 +1,135 @@
+#include "cesium/omniverse/FabricGeometryDataUtil.h"
+
+#include "cesium/omniverse/FabricGeometryData.h"
+#include "cesium/omniverse/MathUtil.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace cesium::omniverse::FabricGeometryDataUtil {
+
+namespace {
+
+template <typename T>
+void appendVertexValues(
+    std::vector<T>& values,
+    uint64_t vertexCount,
+    const std::vector<T>& otherValues,
+    uint64_t otherVertexCount) {
+    if (values.empty() && otherValues.empty()) {
+        return;
+    }
+
+    values.resize(vertexCount);
+    values.insert(values.end(), otherValues.begin(), otherValues.end());
+    values.resize(vertexCount + otherVertexCount);
+}
+
+void appendVertexBytes(
+    std::vector<std::byte>& bytes,
+    uint64_t vertexCount,
+    const std::vector<std::byte>& otherBytes,
+    uint64_t otherVertexCount) {
+    if (bytes.empty() && otherBytes.empty()) {
+        return;
+    }
+
+    const auto elementByteLength =
+        (vertexCount > 0 && !bytes.empty()) ? bytes.size() / vertexCount : otherBytes.size() / otherVertexCount;
+
+    bytes.resize(vertexCount * elementByteLength);
+    bytes.insert(bytes.end(), otherBytes.begin(), otherBytes.end());
+    bytes.resize((vertexCount + otherVertexCount) * elementByteLength);
+}
+
+} // namespace
+
+void appendGeometryData(
+    FabricGeometryData& geometryData,
+    const FabricGeometryData& otherGeometryData,
+    const glm::dmat4& otherToLocalTransform) {
+    if (otherGeometryData.points.empty() || !otherGeometryData.extent.has_value()) {
+        return;
+    }
+
+    const auto vertexCount = geometryData.points.size();
+    const auto otherVertexCount = otherGeometryData.points.size();
+
+    if (vertexCount == 0) {
+        geometryData.doubleSided = otherGeometryData.doubleSided;
+    }
+
+    appendVertexValues(geometryData.points, vertexCount, otherGeometryData.points, otherVertexCount);
+    for (uint64_t i = vertexCount; i < geometryData.points.size(); ++i) {
+        auto& point = geometryData.points[i];
+        point = glm::fvec3(otherToLocalTransform * glm::dvec4(glm::dvec3(point), 1.0));
+    }
+
+    if (geometryData.extent.has_value()) {
+        const auto otherExtent = MathUtil::transformExtent(otherGeometryData.extent.value(), otherToLocalTransform);
+        auto& extent = geometryData.extent.value();
+        extent[0] = glm::min(extent[0], otherExtent[0]);
+        extent[1] = glm::max(extent[1], otherExtent[1]);
+    } else {
+        // The existing points aren't covered by any extent so compute it from all the points
+        const auto firstPoint = glm::dvec3(geometryData.points[0]);
+        auto extent = std::array<glm::dvec3, 2>{{firstPoint, firstPoint}};
+        for (const auto& point : geometryData.points) {
+            extent[0] = glm::min(extent[0], glm::dvec3(point));
+            extent[1] = glm::max(extent[1], glm::dvec3(point));
+        }
+        geometryData.extent = extent;
+    }
+
+    appendVertexValues(geometryData.normals, vertexCount, otherGeometryData.normals, otherVertexCount);
+    if (!geometryData.normals.empty()) {
+        const auto normalTransform = glm::transpose(glm::inverse(glm::dmat3(otherToLocalTransform)));
+        for (uint64_t i = vertexCount; i < geometryData.normals.size(); ++i) {
+            const auto normal = normalTransform * glm::dvec3(geometryData.normals[i]);
+            const auto length = glm::length(normal);
+            geometryData.normals[i] = length > 0.0 ? glm::fvec3(normal / length) : glm::fvec3(0.0f);
+        }
+    }
+
+    const auto indexOffset = static_cast<int>(vertexCount);
+
+    geometryData.faceVertexCounts.insert(
+        geometryData.faceVertexCounts.end(),
+        otherGeometryData.faceVertexCounts.begin(),
+        otherGeometryData.faceVertexCounts.end());
+
+    geometryData.faceVertexIndices.reserve(
+        geometryData.faceVertexIndices.size() + otherGeometryData.faceVertexIndices.size());
+    for (const auto index : otherGeometryData.faceVertexIndices) {
+        geometryData.faceVertexIndices.push_back(index + indexOffset);
+    }
+
+    appendVertexValues(geometryData.vertexColors, vertexCount, otherGeometryData.vertexColors, otherVertexCount);
+    appendVertexValues(geometryData.vertexIds, vertexCount, otherGeometryData.vertexIds, otherVertexCount);
+    appendVertexValues(geometryData.widths, vertexCount, otherGeometryData.widths, otherVertexCount);
+
+    const std::vector<glm::fvec2> noTexcoords;
+    const auto texcoordSetCount = std::max(geometryData.texcoords.size(), otherGeometryData.texcoords.size());
+    geometryData.texcoords.resize(texcoordSetCount);
+    for (uint64_t i = 0; i < texcoordSetCount; ++i) {
+        const auto& otherTexcoords =
+            i < otherGeometryData.texcoords.size() ? otherGeometryData.texcoords[i] : noTexcoords;
+        appendVertexValues(geometryData.texcoords[i], vertexCount, otherTexcoords, otherVertexCount);
+    }
+
+    const std::vector<std::byte> noBytes;
+    const auto customVertexAttributeCount =
+        std::max(geometryData.customVertexAttributes.size(), otherGeometryData.customVertexAttributes.size());
+    geometryData.customVertexAttributes.resize(customVertexAttributeCount);
+    for (uint64_t i = 0; i < customVertexAttributeCount; ++i) {
+        const auto& otherBytes =
+            i < otherGeometryData.customVertexAttributes.size() ? otherGeometryData.customVertexAttributes[i] : noBytes;
+        appendVertexBytes(geometryData.customVertexAttributes[i], vertexCount, otherBytes, otherVertexCount);
+    }
+}
+
+} // namespace cesium::omniverse::FabricGeometryDataUtil
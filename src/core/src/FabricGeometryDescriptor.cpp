@@ -1,7 +1,8 @@
 #include "cesium/omniverse/FabricGeometryDescriptor.h"
 
-#include "cesium/omniverse/FabricFeaturesInfo.h"
+#include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/FabricFeaturesUtil.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricVertexAttributeDescriptor.h"
 #include "cesium/omniverse/GltfUtil.h"
 
@@ -17,15 +18,20 @@ namespace cesium::omniverse {
 FabricGeometryDescriptor::FabricGeometryDescriptor(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
-    const FabricFeaturesInfo& featuresInfo,
-    bool smoothNormals)
-    : _hasNormals(GltfUtil::hasNormals(model, primitive, smoothNormals))
+    const FabricPrimitiveInfo& primitiveInfo,
+    bool smoothNormals,
+    bool renderPointsAsVoxels)
+    : _isPointCloud(primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS && !renderPointsAsVoxels)
+    // Smooth normals can't be generated for native points since they have no triangles
+    , _hasNormals(GltfUtil::hasNormals(model, primitive, smoothNormals && !_isPointCloud))
     , _hasVertexColors(GltfUtil::hasVertexColors(model, primitive, 0))
-    , _hasVertexIds(FabricFeaturesUtil::hasFeatureIdType(featuresInfo, FabricFeatureIdType::INDEX))
-    , _texcoordSetCount(
-          GltfUtil::getTexcoordSetIndexes(model, primitive).size() +
-          GltfUtil::getRasterOverlayTexcoordSetIndexes(model, primitive).size())
-    , _customVertexAttributes(GltfUtil::getCustomVertexAttributes(model, primitive)) {}
+    , _hasVertexIds(FabricFeaturesUtil::hasFeatureIdType(primitiveInfo.featuresInfo, FabricFeatureIdType::INDEX))
+    , _texcoordSetCount(primitiveInfo.texcoordSetIndexes.size() + primitiveInfo.rasterOverlayTexcoordSetIndexes.size())
+    , _customVertexAttributes(primitiveInfo.customVertexAttributes) {}
+
+bool FabricGeometryDescriptor::isPointCloud() const {
+    return _isPointCloud;
+}
 
 bool FabricGeometryDescriptor::hasNormals() const {
     return _hasNormals;
@@ -48,9 +54,29 @@ const std::set<FabricVertexAttributeDescriptor>& FabricGeometryDescriptor::getCu
 }
 
 bool FabricGeometryDescriptor::operator==(const FabricGeometryDescriptor& other) const {
-    return _hasNormals == other._hasNormals && _hasVertexColors == other._hasVertexColors &&
+    return _isPointCloud == other._isPointCloud && _hasNormals == other._hasNormals &&
+           _hasVertexColors == other._hasVertexColors &&
            _hasVertexIds == other._hasVertexIds && _texcoordSetCount == other._texcoordSetCount &&
            _customVertexAttributes == other._customVertexAttributes;
 }
 
 } // namespace cesium::omniverse
+
+// Make sure to update this function when adding new fields to the class
+size_t std::hash<cesium::omniverse::FabricGeometryDescriptor>::operator()(
+    const cesium::omniverse::FabricGeometryDescriptor& geometryDescriptor) const noexcept {
+    using namespace cesium::omniverse;
+
+    auto seed = CppUtil::hashValues(
+        geometryDescriptor.isPointCloud(),
+        geometryDescriptor.hasNormals(),
+        geometryDescriptor.hasVertexColors(),
+        geometryDescriptor.hasVertexIds(),
+        geometryDescriptor.getTexcoordSetCount());
+
+    for (const auto& customVertexAttribute : geometryDescriptor.getCustomVertexAttributes()) {
+        CppUtil::hashCombine(seed, customVertexAttribute);
+    }
+
+    return static_cast<size_t>(seed);
+}
@@ -7,6 +7,7 @@
 #include "cesium/omniverse/FabricFeaturesInfo.h"
 #include "cesium/omniverse/FabricMaterialDescriptor.h"
 #include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricPropertyDescriptor.h"
 #include "cesium/omniverse/FabricRasterOverlaysInfo.h"
 #include "cesium/omniverse/FabricResourceManager.h"
@@ -420,6 +421,7 @@ void setPropertyTablePropertyValues(
     omni::fabric::StageReaderWriter& fabricStage,
     const omni::fabric::Path& path,
     const pxr::TfToken& propertyTableTextureAssetPathToken,
+    uint64_t propertyTableTexelOffset,
     const DataTypeUtil::GetMdlInternalPropertyTransformedType<T>& offset,
     const DataTypeUtil::GetMdlInternalPropertyTransformedType<T>& scale,
     const DataTypeUtil::GetMdlInternalPropertyRawType<T>& maximumValue,
@@ -432,6 +434,10 @@ void setPropertyTablePropertyValues(
     textureFabric->assetPath = propertyTableTextureAssetPathToken;
     textureFabric->resolvedPath = pxr::TfToken();
 
+    const auto texelOffsetFabric =
+        fabricStage.getAttributeWr<int>(path, FabricTokens::inputs_property_table_texel_offset);
+    *texelOffsetFabric = static_cast<int>(propertyTableTexelOffset);
+
     setPropertyValues<T>(fabricStage, path, offset, scale, maximumValue, hasNoData, noData, defaultValue);
 }
 
@@ -486,6 +492,7 @@ void clearPropertyTableProperty(
         fabricStage,
         path,
         defaultTransparentTextureAssetPathToken,
+        0,
         MdlTransformedType{0},
         MdlTransformedType{0},
         MdlRawType{0},
@@ -512,24 +519,15 @@ FabricMaterial::FabricMaterial(
     , _debugRandomColors(debugRandomColors)
     , _poolId(poolId)
     , _stageId(pContext->getUsdStageId())
-    , _usesDefaultMaterial(!materialDescriptor.hasTilesetMaterial()) {
-
-    if (stageDestroyed()) {
-        return;
-    }
-
-    initializeNodes();
-
-    if (_usesDefaultMaterial) {
-        initializeDefaultMaterial();
-    } else {
-        initializeExistingMaterial(FabricUtil::toFabricPath(materialDescriptor.getTilesetMaterialPath()));
-    }
-
-    reset();
+    , _usesDefaultMaterial(!materialDescriptor.hasTilesetMaterial())
+    , _pStatisticsCounter(pContext->getFabricResourceManager().getStatisticsCounter()) {
+    // The Fabric prims aren't created until initialize is called from the main thread. This allows materials to be
+    // constructed and handed out from worker threads.
 }
 
 FabricMaterial::~FabricMaterial() {
+    _pStatisticsCounter->update(_statistics, {});
+
     // The code below is temporarily commented out to avoid a crash.
     // It will cause a leak, but since this only happens when materials
     // pools are destroyed (which doesn't happen during normal usage) it
@@ -546,14 +544,35 @@ FabricMaterial::~FabricMaterial() {
     // }
 }
 
+void FabricMaterial::initialize() {
+    if (_initialized || stageDestroyed()) {
+        return;
+    }
+
+    initializeNodes();
+
+    if (_usesDefaultMaterial) {
+        initializeDefaultMaterial();
+    } else {
+        initializeExistingMaterial(FabricUtil::toFabricPath(_materialDescriptor.getTilesetMaterialPath()));
+    }
+
+    reset();
+
+    _initialized = true;
+}
+
 void FabricMaterial::setActive(bool active) {
-    if (stageDestroyed()) {
+    if (active) {
+        // Nothing to do when acquired. This may be called from a worker thread.
         return;
     }
 
-    if (!active) {
-        reset();
+    if (!_initialized || stageDestroyed()) {
+        return;
     }
+
+    reset();
 }
 
 const omni::fabric::Path& FabricMaterial::getPath() const {
@@ -1203,6 +1222,8 @@ void FabricMaterial::createPropertyTablePropertyInt(
     fabricStage.createPrim(path);
     FabricAttributesBuilder attributes(_pContext);
     attributes.addAttribute(FabricTypes::inputs_property_table_texture, FabricTokens::inputs_property_table_texture);
+    attributes.addAttribute(
+        FabricTypes::inputs_property_table_texel_offset, FabricTokens::inputs_property_table_texel_offset);
     attributes.addAttribute(FabricTypes::inputs_has_no_data, FabricTokens::inputs_has_no_data);
     attributes.addAttribute(noDataType, FabricTokens::inputs_no_data);
     attributes.addAttribute(defaultValueType, FabricTokens::inputs_default_value);
@@ -1221,6 +1242,8 @@ void FabricMaterial::createPropertyTablePropertyNormalizedInt(
     fabricStage.createPrim(path);
     FabricAttributesBuilder attributes(_pContext);
     attributes.addAttribute(FabricTypes::inputs_property_table_texture, FabricTokens::inputs_property_table_texture);
+    attributes.addAttribute(
+        FabricTypes::inputs_property_table_texel_offset, FabricTokens::inputs_property_table_texel_offset);
     attributes.addAttribute(FabricTypes::inputs_has_no_data, FabricTokens::inputs_has_no_data);
     attributes.addAttribute(noDataType, FabricTokens::inputs_no_data);
     attributes.addAttribute(defaultValueType, FabricTokens::inputs_default_value);
@@ -1241,6 +1264,8 @@ void FabricMaterial::createPropertyTablePropertyFloat(
     fabricStage.createPrim(path);
     FabricAttributesBuilder attributes(_pContext);
     attributes.addAttribute(FabricTypes::inputs_property_table_texture, FabricTokens::inputs_property_table_texture);
+    attributes.addAttribute(
+        FabricTypes::inputs_property_table_texel_offset, FabricTokens::inputs_property_table_texel_offset);
     attributes.addAttribute(FabricTypes::inputs_has_no_data, FabricTokens::inputs_has_no_data);
     attributes.addAttribute(noDataType, FabricTokens::inputs_no_data);
     attributes.addAttribute(defaultValueType, FabricTokens::inputs_default_value);
@@ -1442,14 +1467,16 @@ void FabricMaterial::reset() {
         const auto tilesetIdFabric = fabricStage.getAttributeWr<int64_t>(path, FabricTokens::_cesium_tilesetId);
         *tilesetIdFabric = FabricUtil::NO_TILESET_ID;
     }
+
+    _loaded = false;
+    updateStatistics();
 }
 
 void FabricMaterial::setMaterial(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
     int64_t tilesetId,
-    const FabricMaterialInfo& materialInfo,
-    const FabricFeaturesInfo& featuresInfo,
+    const FabricPrimitiveInfo& primitiveInfo,
     FabricTexture* pBaseColorTexture,
     const std::vector<std::shared_ptr<FabricTexture>>& featureIdTextures,
     const std::vector<std::shared_ptr<FabricTexture>>& propertyTextures,
@@ -1459,13 +1486,16 @@ void FabricMaterial::setMaterial(
     const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
     const std::vector<uint64_t>& featureIdIndexSetIndexMapping,
     const std::vector<uint64_t>& featureIdAttributeSetIndexMapping,
-    const std::vector<uint64_t>& featureIdTextureSetIndexMapping,
-    const std::unordered_map<uint64_t, uint64_t>& propertyTextureIndexMapping) {
+    const std::vector<uint64_t>& featureIdTextureSetIndexMapping) {
 
     if (stageDestroyed()) {
         return;
     }
 
+    const auto& materialInfo = primitiveInfo.materialInfo;
+    const auto& featuresInfo = primitiveInfo.featuresInfo;
+    const auto& propertyTextureIndexMapping = primitiveInfo.propertyTextureIndexMapping;
+
     if (_usesDefaultMaterial) {
         _alphaMode = getInitialAlphaMode(_materialDescriptor, materialInfo);
 
@@ -1613,15 +1643,15 @@ void FabricMaterial::setMaterial(
             *_pContext,
             model,
             primitive,
-            [this, &propertyTableTextures, &propertyTablePropertyCounter, &getPropertyPath](
+            [this, &primitiveInfo, &propertyTableTextures, &propertyTablePropertyCounter, &getPropertyPath](
                 const std::string& propertyId,
                 [[maybe_unused]] const auto& propertyTablePropertyView,
                 const auto& property) {
                 constexpr auto type = std::decay_t<decltype(property)>::Type;
                 constexpr auto mdlType = DataTypeUtil::getMdlInternalPropertyType<type>();
                 const auto& propertyPath = getPropertyPath(propertyId);
-                const auto textureIndex = propertyTablePropertyCounter++;
-                const auto& textureAssetPath = propertyTableTextures[textureIndex]->getAssetPathToken();
+                const auto& textureRegion = primitiveInfo.propertyTableTextureRegions[propertyTablePropertyCounter++];
+                const auto& textureAssetPath = propertyTableTextures[textureRegion.textureIndex]->getAssetPathToken();
                 const auto& propertyInfo = property.propertyInfo;
                 const auto hasNoData = propertyInfo.noData.has_value();
                 const auto offset = getOffset(propertyInfo);
@@ -1634,6 +1664,7 @@ void FabricMaterial::setMaterial(
                     _pContext->getFabricStage(),
                     propertyPath,
                     textureAssetPath,
+                    textureRegion.texelOffset,
                     offset,
                     scale,
                     maximumValue,
@@ -1649,6 +1680,9 @@ void FabricMaterial::setMaterial(
         const auto tilesetIdFabric = fabricStage.getAttributeWr<int64_t>(path, FabricTokens::_cesium_tilesetId);
         *tilesetIdFabric = tilesetId;
     }
+
+    _loaded = true;
+    updateStatistics();
 }
 
 void FabricMaterial::createConnectionsToCopiedPaths() {
@@ -1800,7 +1834,7 @@ void FabricMaterial::setDisplayColorAndOpacity(const glm::dvec3& displayColor, d
 }
 
 void FabricMaterial::updateShaderInput(const omni::fabric::Path& path, const omni::fabric::Token& attributeName) {
-    if (stageDestroyed()) {
+    if (!_initialized || stageDestroyed()) {
         return;
     }
 
@@ -1933,6 +1967,15 @@ void FabricMaterial::setFeatureIdTextureValues(
     *nullFeatureIdFabric = nullFeatureId;
 }
 
+void FabricMaterial::updateStatistics() {
+    FabricStatistics statistics;
+    statistics.materialsCapacity = 1;
+    statistics.materialsLoaded = _loaded ? 1 : 0;
+
+    _pStatisticsCounter->update(_statistics, statistics);
+    _statistics = statistics;
+}
+
 bool FabricMaterial::stageDestroyed() {
     // Tile render resources may be processed asynchronously even after the tileset and stage have been destroyed.
     // Add this check to all public member functions, including constructors and destructors, to prevent them from
@@ -1,12 +1,10 @@
 #include "cesium/omniverse/FabricMaterialDescriptor.h"
 
-#include "cesium/omniverse/FabricFeaturesInfo.h"
+#include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/FabricFeaturesUtil.h"
-#include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricPropertyDescriptor.h"
 #include "cesium/omniverse/FabricRasterOverlaysInfo.h"
-#include "cesium/omniverse/GltfUtil.h"
-#include "cesium/omniverse/MetadataUtil.h"
 
 #ifdef CESIUM_OMNI_MSVC
 #pragma push_macro("OPAQUE")
@@ -18,22 +16,18 @@
 namespace cesium::omniverse {
 
 FabricMaterialDescriptor::FabricMaterialDescriptor(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const FabricMaterialInfo& materialInfo,
-    const FabricFeaturesInfo& featuresInfo,
+    const FabricPrimitiveInfo& primitiveInfo,
     const FabricRasterOverlaysInfo& rasterOverlaysInfo,
     const pxr::SdfPath& tilesetMaterialPath)
-    : _hasVertexColors(materialInfo.hasVertexColors)
-    , _hasBaseColorTexture(materialInfo.baseColorTexture.has_value())
-    , _featureIdTypes(FabricFeaturesUtil::getFeatureIdTypes(featuresInfo))
+    : _hasVertexColors(primitiveInfo.materialInfo.hasVertexColors)
+    , _hasBaseColorTexture(primitiveInfo.materialInfo.baseColorTexture.has_value())
+    , _featureIdTypes(FabricFeaturesUtil::getFeatureIdTypes(primitiveInfo.featuresInfo))
     , _rasterOverlayRenderMethods(rasterOverlaysInfo.overlayRenderMethods)
     , _tilesetMaterialPath(tilesetMaterialPath) {
     // Ignore styleable properties unless the tileset has a material
     if (!_tilesetMaterialPath.IsEmpty()) {
-        std::tie(_styleableProperties, _unsupportedPropertyWarnings) =
-            MetadataUtil::getStyleableProperties(context, model, primitive);
+        _styleableProperties = primitiveInfo.styleableProperties;
+        _unsupportedPropertyWarnings = primitiveInfo.unsupportedPropertyWarnings;
     }
 }
 
@@ -84,3 +78,30 @@ bool FabricMaterialDescriptor::operator==(const FabricMaterialDescriptor& other)
 }
 
 } // namespace cesium::omniverse
+
+// Make sure to update this function when adding new fields to the class
+size_t std::hash<cesium::omniverse::FabricMaterialDescriptor>::operator()(
+    const cesium::omniverse::FabricMaterialDescriptor& materialDescriptor) const noexcept {
+    using namespace cesium::omniverse;
+
+    auto seed = CppUtil::hashValues(
+        materialDescriptor.hasVertexColors(),
+        materialDescriptor.hasBaseColorTexture(),
+        pxr::SdfPath::Hash()(materialDescriptor.getTilesetMaterialPath()));
+
+    for (const auto featureIdType : materialDescriptor.getFeatureIdTypes()) {
+        CppUtil::hashCombine(seed, featureIdType);
+    }
+
+    for (const auto overlayRenderMethod : materialDescriptor.getRasterOverlayRenderMethods()) {
+        CppUtil::hashCombine(seed, overlayRenderMethod);
+    }
+
+    for (const auto& styleableProperty : materialDescriptor.getStyleableProperties()) {
+        CppUtil::hashCombine(seed, styleableProperty);
+    }
+
+    // _unsupportedPropertyWarnings is intentionally not hashed because it's not checked for equality
+
+    return static_cast<size_t>(seed);
+}
@@ -1,24 +1,25 @@
 #include "cesium/omniverse/FabricPrepareRenderResources.h"
 
-#include "cesium/omniverse/AssetRegistry.h"
 #include "cesium/omniverse/Context.h"
 #include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/FabricFeaturesInfo.h"
 #include "cesium/omniverse/FabricFeaturesUtil.h"
 #include "cesium/omniverse/FabricGeometry.h"
+#include "cesium/omniverse/FabricGeometryData.h"
+#include "cesium/omniverse/FabricGeometryDataUtil.h"
 #include "cesium/omniverse/FabricMaterial.h"
 #include "cesium/omniverse/FabricMesh.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricRasterOverlaysInfo.h"
 #include "cesium/omniverse/FabricRenderResources.h"
 #include "cesium/omniverse/FabricResourceManager.h"
 #include "cesium/omniverse/FabricTexture.h"
-#include "cesium/omniverse/FabricTextureData.h"
 #include "cesium/omniverse/FabricUtil.h"
 #include "cesium/omniverse/GltfUtil.h"
 #include "cesium/omniverse/MetadataUtil.h"
-#include "cesium/omniverse/OmniRasterOverlay.h"
 #include "cesium/omniverse/OmniTileset.h"
-#include "cesium/omniverse/UsdUtil.h"
+#include "cesium/omniverse/TextureCompressionUtil.h"
+#include "cesium/omniverse/TilesetSettings.h"
 
 #ifdef CESIUM_OMNI_MSVC
 #pragma push_macro("OPAQUE")
@@ -32,6 +33,14 @@
 #include <omni/fabric/FabricUSD.h>
 #include <omni/ui/ImageProvider/DynamicTextureProvider.h>
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -44,15 +53,53 @@ struct RasterOverlayRenderResources {
     std::shared_ptr<FabricTexture> pTexture;
 };
 
+struct MergedPrimitive {
+    const glm::dmat4 gltfLocalToEcefTransform;
+    const uint64_t gltfMeshIndex;
+    const uint64_t gltfPrimitiveIndex;
+};
+
 struct LoadingMesh {
     const glm::dmat4 gltfLocalToEcefTransform;
     const uint64_t gltfMeshIndex;
     const uint64_t gltfPrimitiveIndex;
+
+    // Other primitives in the same tile whose vertex buffers are appended to this mesh's. See mergeLoadingMeshes.
+    const std::vector<MergedPrimitive> mergedPrimitives;
+};
+
+// What a primitive is compared by when deciding whether it can be merged into another primitive
+struct MergeCandidate {
+    uint64_t loadingMeshIndex;
+    FabricGeometryDescriptor geometryDescriptor;
+    bool hasMaterial;
+    bool flipsWinding;
+    uint64_t vertexCount;
+    const CesiumGltf::ImageCesium* pBaseColorTextureImage;
+    std::vector<const CesiumGltf::ImageCesium*> featureIdTextureImages;
 };
 
+struct MergeGroup {
+    MergeCandidate leader;
+    std::vector<uint64_t> memberIndexes;
+    uint64_t vertexCount;
+};
+
+// Face vertex indices are stored as int
+const auto MAXIMUM_MERGED_VERTEX_COUNT = static_cast<uint64_t>(std::numeric_limits<int>::max());
+
 struct TileLoadThreadResult {
     std::vector<LoadingMesh> loadingMeshes;
     std::vector<FabricMesh> fabricMeshes;
+    std::vector<FabricGeometryData> geometryData;
+};
+
+struct TilesetRenderInfo {
+    int64_t tilesetId;
+    glm::dmat4 ecefToPrimWorldTransform;
+    pxr::SdfPath tilesetMaterialPath;
+    glm::dvec3 displayColor;
+    double displayOpacity;
 };
 
 uint64_t getFeatureIdTextureCount(const FabricFeaturesInfo& fabricFeaturesInfo) {
@@ -88,168 +135,546 @@ std::vector<LoadingMesh> getLoadingMeshes(const glm::dmat4& tileToEcefTransform,
                 gltfLocalToEcefTransform,
                 gltfMeshIndex,
                 gltfPrimitiveIndex,
+                {},
             });
         });
 
     return loadingMeshes;
 }
 
-std::vector<FabricMesh> acquireFabricMeshes(
+FabricPrimitiveInfo getPrimitiveInfo(
+    const Context& context,
+    const CesiumGltf::Model& model,
+    const CesiumGltf::MeshPrimitive& primitive,
+    bool hasStyleableProperties) {
+    FabricPrimitiveInfo primitiveInfo;
+    primitiveInfo.materialInfo = GltfUtil::getMaterialInfo(model, primitive);
+    primitiveInfo.featuresInfo = GltfUtil::getFeaturesInfo(model, primitive);
+    primitiveInfo.texcoordSetIndexes = GltfUtil::getTexcoordSetIndexes(model, primitive);
+    primitiveInfo.rasterOverlayTexcoordSetIndexes = GltfUtil::getRasterOverlayTexcoordSetIndexes(model, primitive);
+    primitiveInfo.customVertexAttributes = GltfUtil::getCustomVertexAttributes(model, primitive);
+
+    // Property values are only read by the material, and only when the tileset has a material
+    if (hasStyleableProperties) {
+        MetadataUtil::getStyleablePropertyInfo(context, model, primitive, primitiveInfo);
+    }
+
+    return primitiveInfo;
+}
+
+std::vector<FabricMesh> getFabricMeshes(
     Context& context,
     const CesiumGltf::Model& model,
     const std::vector<LoadingMesh>& loadingMeshes,
     const FabricRasterOverlaysInfo& rasterOverlaysInfo,
-    const OmniTileset& tileset) {
-    CESIUM_TRACE("FabricPrepareRenderResources::acquireFabricMeshes");
+    const TilesetSettings& tilesetSettings) {
+    CESIUM_TRACE("FabricPrepareRenderResources::getFabricMeshes");
     std::vector<FabricMesh> fabricMeshes;
     fabricMeshes.reserve(loadingMeshes.size());
 
     auto& fabricResourceManager = context.getFabricResourceManager();
-    const auto tilesetMaterialPath = tileset.getMaterialPath();
+    const auto& tilesetMaterialPath = tilesetSettings.materialPath;
 
     for (const auto& loadingMesh : loadingMeshes) {
         auto& fabricMesh = fabricMeshes.emplace_back();
 
         const auto& primitive = model.meshes[loadingMesh.gltfMeshIndex].primitives[loadingMesh.gltfPrimitiveIndex];
 
-        const auto materialInfo = GltfUtil::getMaterialInfo(model, primitive);
-        const auto featuresInfo = GltfUtil::getFeaturesInfo(model, primitive);
-
         const auto shouldAcquireMaterial = fabricResourceManager.shouldAcquireMaterial(
             primitive, rasterOverlaysInfo.overlayRenderMethods.size() > 0, tilesetMaterialPath);
 
-        fabricMesh.materialInfo = materialInfo;
-        fabricMesh.featuresInfo = featuresInfo;
+        // Everything after this reads from the primitive info rather than walking the glTF again
+        fabricMesh.primitiveInfo =
+            getPrimitiveInfo(context, model, primitive, shouldAcquireMaterial && !tilesetMaterialPath.IsEmpty());
+        const auto& primitiveInfo = fabricMesh.primitiveInfo;
 
-        fabricMesh.pGeometry =
-            fabricResourceManager.acquireGeometry(model, primitive, featuresInfo, tileset.getSmoothNormals());
+        // Map glTF texcoord set index to primvar st index
+        uint64_t primvarStIndex = 0;
+        for (const auto gltfSetIndex : primitiveInfo.texcoordSetIndexes) {
+            fabricMesh.texcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
+        }
+        for (const auto gltfSetIndex : primitiveInfo.rasterOverlayTexcoordSetIndexes) {
+            fabricMesh.rasterOverlayTexcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
+        }
 
-        if (shouldAcquireMaterial) {
-            fabricMesh.pMaterial = fabricResourceManager.acquireMaterial(
-                model,
-                primitive,
-                materialInfo,
-                featuresInfo,
-                rasterOverlaysInfo,
-                tileset.getTilesetId(),
-                tilesetMaterialPath);
+        // Map feature id types to set indexes
+        fabricMesh.featureIdIndexSetIndexMapping =
+            FabricFeaturesUtil::getSetIndexMapping(primitiveInfo.featuresInfo, FabricFeatureIdType::INDEX);
+        fabricMesh.featureIdAttributeSetIndexMapping =
+            FabricFeaturesUtil::getSetIndexMapping(primitiveInfo.featuresInfo, FabricFeatureIdType::ATTRIBUTE);
+        fabricMesh.featureIdTextureSetIndexMapping =
+            FabricFeaturesUtil::getSetIndexMapping(primitiveInfo.featuresInfo, FabricFeatureIdType::TEXTURE);
+    }
+
+    return fabricMeshes;
+}
+
+MergeCandidate getMergeCandidate(
+    FabricResourceManager& fabricResourceManager,
+    const CesiumGltf::Model& model,
+    const std::vector<LoadingMesh>& loadingMeshes,
+    const std::vector<FabricMesh>& fabricMeshes,
+    uint64_t loadingMeshIndex,
+    const FabricRasterOverlaysInfo& rasterOverlaysInfo,
+    const TilesetSettings& tilesetSettings) {
+    const auto& loadingMesh = loadingMeshes[loadingMeshIndex];
+    const auto& fabricMesh = fabricMeshes[loadingMeshIndex];
+    const auto& primitive = model.meshes[loadingMesh.gltfMeshIndex].primitives[loadingMesh.gltfPrimitiveIndex];
+    const auto& primitiveInfo = fabricMesh.primitiveInfo;
+
+    const auto geometryDescriptor = FabricGeometryDescriptor(
+        model, primitive, primitiveInfo, tilesetSettings.smoothNormals, tilesetSettings.renderPointsAsVoxels);
+
+    const auto hasMaterial = fabricResourceManager.shouldAcquireMaterial(
+        primitive, rasterOverlaysInfo.overlayRenderMethods.size() > 0, tilesetSettings.materialPath);
+
+    // Merged triangles are not rewound, so a primitive can only be merged into one with the same handedness
+    const auto flipsWinding = glm::determinant(glm::dmat3(loadingMesh.gltfLocalToEcefTransform)) < 0.0;
+
+    // Points that are rendered as voxels are expanded into 8 vertices each
+    const auto isVoxels =
+        primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS && !geometryDescriptor.isPointCloud();
+    const auto vertexCount = GltfUtil::getPositions(model, primitive).size() * (isVoxels ? 8 : 1);
+
+    const auto pBaseColorTextureImage = primitiveInfo.materialInfo.baseColorTexture.has_value()
+                                            ? GltfUtil::getBaseColorTextureImage(model, primitive)
+                                            : nullptr;
+
+    std::vector<const CesiumGltf::ImageCesium*> featureIdTextureImages;
+    featureIdTextureImages.reserve(fabricMesh.featureIdTextureSetIndexMapping.size());
+    for (const auto featureIdSetIndex : fabricMesh.featureIdTextureSetIndexMapping) {
+        featureIdTextureImages.push_back(GltfUtil::getFeatureIdTextureImage(model, primitive, featureIdSetIndex));
+    }
+
+    return MergeCandidate{
+        loadingMeshIndex,
+        geometryDescriptor,
+        hasMaterial,
+        flipsWinding,
+        vertexCount,
+        pBaseColorTextureImage,
+        std::move(featureIdTextureImages),
+    };
+}
+
+bool canMerge(const MergeGroup& group, const MergeCandidate& candidate, const std::vector<FabricMesh>& fabricMeshes) {
+    const auto& leader = group.leader;
+    const auto& leaderPrimitiveInfo = fabricMeshes[leader.loadingMeshIndex].primitiveInfo;
+    const auto& candidatePrimitiveInfo = fabricMeshes[candidate.loadingMeshIndex].primitiveInfo;
+
+    // The material values of the merged mesh are read from the leader, so everything they're derived from must match
+    return group.vertexCount + candidate.vertexCount <= MAXIMUM_MERGED_VERTEX_COUNT &&
+           leader.geometryDescriptor == candidate.geometryDescriptor && leader.hasMaterial == candidate.hasMaterial &&
+           leader.flipsWinding == candidate.flipsWinding &&
+           leader.pBaseColorTextureImage == candidate.pBaseColorTextureImage &&
+           leader.featureIdTextureImages == candidate.featureIdTextureImages &&
+           leaderPrimitiveInfo.materialInfo == candidatePrimitiveInfo.materialInfo &&
+           leaderPrimitiveInfo.featuresInfo == candidatePrimitiveInfo.featuresInfo &&
+           leaderPrimitiveInfo.texcoordSetIndexes == candidatePrimitiveInfo.texcoordSetIndexes &&
+           leaderPrimitiveInfo.rasterOverlayTexcoordSetIndexes ==
+               candidatePrimitiveInfo.rasterOverlayTexcoordSetIndexes;
+}
+
+void mergeLoadingMeshes(
+    Context& context,
+    const CesiumGltf::Model& model,
+    std::vector<LoadingMesh>& loadingMeshes,
+    std::vector<FabricMesh>& fabricMeshes,
+    const FabricRasterOverlaysInfo& rasterOverlaysInfo,
+    const TilesetSettings& tilesetSettings) {
+    CESIUM_TRACE("FabricPrepareRenderResources::mergeLoadingMeshes");
+
+    auto& fabricResourceManager = context.getFabricResourceManager();
+
+    std::vector<MergeGroup> groups;
+    std::vector<bool> merged(loadingMeshes.size(), false);
+
+    for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
+        // Styleable property values are read from the primitive itself so primitives with styleable properties are
+        // not merged
+        if (!fabricMeshes[i].primitiveInfo.styleableProperties.empty()) {
+            continue;
         }
 
-        if (materialInfo.baseColorTexture.has_value()) {
-            fabricMesh.pBaseColorTexture = fabricResourceManager.acquireTexture();
+        auto candidate = getMergeCandidate(
+            fabricResourceManager, model, loadingMeshes, fabricMeshes, i, rasterOverlaysInfo, tilesetSettings);
+
+        if (candidate.vertexCount == 0) {
+            continue;
         }
 
-        const auto featureIdTextureCount = getFeatureIdTextureCount(featuresInfo);
-        fabricMesh.featureIdTextures.reserve(featureIdTextureCount);
-        for (uint64_t i = 0; i < featureIdTextureCount; ++i) {
-            fabricMesh.featureIdTextures.push_back(fabricResourceManager.acquireTexture());
+        const auto iter = std::find_if(groups.begin(), groups.end(), [&candidate, &fabricMeshes](const auto& group) {
+            return canMerge(group, candidate, fabricMeshes);
+        });
+
+        if (iter != groups.end()) {
+            iter->memberIndexes.push_back(i);
+            iter->vertexCount += candidate.vertexCount;
+            merged[i] = true;
+        } else {
+            const auto vertexCount = candidate.vertexCount;
+            // In C++ 20 this can be emplace_back without the {}
+            groups.push_back({std::move(candidate), {}, vertexCount});
         }
+    }
 
-        const auto propertyTextureCount = MetadataUtil::getPropertyTextureImages(context, model, primitive).size();
-        fabricMesh.propertyTextures.reserve(propertyTextureCount);
-        for (uint64_t i = 0; i < propertyTextureCount; ++i) {
-            fabricMesh.propertyTextures.push_back(fabricResourceManager.acquireTexture());
+    std::unordered_map<uint64_t, const MergeGroup*> groupsByLeader;
+    for (const auto& group : groups) {
+        if (!group.memberIndexes.empty()) {
+            groupsByLeader.emplace(group.leader.loadingMeshIndex, &group);
         }
+    }
 
-        const auto propertyTableTextureCount = MetadataUtil::getPropertyTableTextureCount(context, model, primitive);
-        fabricMesh.propertyTableTextures.reserve(propertyTableTextureCount);
-        for (uint64_t i = 0; i < propertyTableTextureCount; ++i) {
-            fabricMesh.propertyTableTextures.push_back(fabricResourceManager.acquireTexture());
+    if (groupsByLeader.empty()) {
+        return;
+    }
+
+    std::vector<LoadingMesh> mergedLoadingMeshes;
+    std::vector<FabricMesh> mergedFabricMeshes;
+
+    for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
+        if (merged[i]) {
+            continue;
         }
 
-        // Map glTF texcoord set index to primvar st index
-        const auto texcoordSetIndexes = GltfUtil::getTexcoordSetIndexes(model, primitive);
-        const auto rasterOverlayTexcoordSetIndexes = GltfUtil::getRasterOverlayTexcoordSetIndexes(model, primitive);
+        const auto& loadingMesh = loadingMeshes[i];
 
-        uint64_t primvarStIndex = 0;
-        for (const auto gltfSetIndex : texcoordSetIndexes) {
-            fabricMesh.texcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
+        std::vector<MergedPrimitive> mergedPrimitives;
+
+        const auto groupIter = groupsByLeader.find(i);
+        if (groupIter != groupsByLeader.end()) {
+            const auto& memberIndexes = groupIter->second->memberIndexes;
+            mergedPrimitives.reserve(memberIndexes.size());
+            for (const auto memberIndex : memberIndexes) {
+                const auto& member = loadingMeshes[memberIndex];
+                // In C++ 20 this can be emplace_back without the {}
+                mergedPrimitives.push_back(
+                    {member.gltfLocalToEcefTransform, member.gltfMeshIndex, member.gltfPrimitiveIndex});
+            }
         }
-        for (const auto gltfSetIndex : rasterOverlayTexcoordSetIndexes) {
-            fabricMesh.rasterOverlayTexcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
+
+        // In C++ 20 this can be emplace_back without the {}
+        mergedLoadingMeshes.push_back({
+            loadingMesh.gltfLocalToEcefTransform,
+            loadingMesh.gltfMeshIndex,
+            loadingMesh.gltfPrimitiveIndex,
+            std::move(mergedPrimitives),
+        });
+
+        mergedFabricMeshes.push_back(std::move(fabricMeshes[i]));
+    }
+
+    loadingMeshes = std::move(mergedLoadingMeshes);
+    fabricMeshes = std::move(mergedFabricMeshes);
+}
+
+void acquireFabricMeshes(
+    Context& context,
+    const CesiumGltf::Model& model,
+    const std::vector<LoadingMesh>& loadingMeshes,
+    std::vector<FabricMesh>& fabricMeshes,
+    const FabricRasterOverlaysInfo& rasterOverlaysInfo,
+    const TilesetSettings& tilesetSettings) {
+    CESIUM_TRACE("FabricPrepareRenderResources::acquireFabricMeshes");
+
+    auto& fabricResourceManager = context.getFabricResourceManager();
+    const auto& tilesetMaterialPath = tilesetSettings.materialPath;
+    const auto smoothNormals = tilesetSettings.smoothNormals;
+    const auto renderPointsAsVoxels = tilesetSettings.renderPointsAsVoxels;
+
+    for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
+        const auto& loadingMesh = loadingMeshes[i];
+        const auto& primitive = model.meshes[loadingMesh.gltfMeshIndex].primitives[loadingMesh.gltfPrimitiveIndex];
+        auto& fabricMesh = fabricMeshes[i];
+
+        const auto& primitiveInfo = fabricMesh.primitiveInfo;
+
+        const auto shouldAcquireMaterial = fabricResourceManager.shouldAcquireMaterial(
+            primitive, rasterOverlaysInfo.overlayRenderMethods.size() > 0, tilesetMaterialPath);
+
+        fabricMesh.pGeometry = fabricResourceManager.acquireGeometry(
+            model, primitive, primitiveInfo, smoothNormals, renderPointsAsVoxels);
+        fabricMesh.primitiveCount = loadingMesh.mergedPrimitives.size() + 1;
+        fabricResourceManager.addGeometryPrimitives(fabricMesh.primitiveCount);
+
+        if (shouldAcquireMaterial) {
+            fabricMesh.pMaterial = fabricResourceManager.acquireMaterial(
+                primitiveInfo, rasterOverlaysInfo, tilesetSettings.tilesetId, tilesetMaterialPath);
         }
+    }
+}
 
-        // Map feature id types to set indexes
-        fabricMesh.featureIdIndexSetIndexMapping =
-            FabricFeaturesUtil::getSetIndexMapping(featuresInfo, FabricFeatureIdType::INDEX);
-        fabricMesh.featureIdAttributeSetIndexMapping =
-            FabricFeaturesUtil::getSetIndexMapping(featuresInfo, FabricFeatureIdType::ATTRIBUTE);
-        fabricMesh.featureIdTextureSetIndexMapping =
-            FabricFeaturesUtil::getSetIndexMapping(featuresInfo, FabricFeatureIdType::TEXTURE);
+std::shared_ptr<FabricTexture> acquireFabricTexture(
+    FabricResourceManager& fabricResourceManager,
+    const CesiumGltf::ImageCesium& image,
+    TransferFunction transferFunction) {
+    auto pTexture = fabricResourceManager.acquireTexture(FabricTextureDescriptor(image, transferFunction));
+    pTexture->setImage(image, transferFunction);
+    return pTexture;
+}
+
+std::shared_ptr<FabricTexture> acquireSharedFabricTexture(
+    FabricResourceManager& fabricResourceManager,
+    const std::vector<std::byte>& bytes,
+    uint64_t width,
+    uint64_t height,
+    carb::Format format) {
+    const auto contentHash =
+        CppUtil::hashValues(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+
+    const auto setTexture = [&bytes, width, height, format](FabricTexture& texture) {
+        texture.setBytes(bytes, width, height, format);
+    };
+
+    return fabricResourceManager.acquireSharedTexture(
+        contentHash, bytes, FabricTextureDescriptor(width, height, format), setTexture);
+}
 
-        // Map glTF texture index to property texture (FabricTexture) index
-        fabricMesh.propertyTextureIndexMapping =
-            MetadataUtil::getPropertyTextureIndexMapping(context, model, primitive);
+CesiumGltf::ImageCesium compressImage(
+    FabricResourceManager& fabricResourceManager,
+    const CesiumGltf::ImageCesium& image,
+    TextureCompression textureCompression) {
+    CESIUM_TRACE("FabricPrepareRenderResources::compressImage");
+
+    const auto start = std::chrono::steady_clock::now();
+    auto compressedImage = TextureCompressionUtil::compressImage(image, textureCompression);
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto encodeTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    fabricResourceManager.addCompressedTexture(
+        image.pixelData.size(), compressedImage.pixelData.size(), static_cast<uint64_t>(encodeTime));
+
+    return compressedImage;
+}
+
+bool shouldCompressImage(const CesiumGltf::ImageCesium& image, TextureCompression textureCompression) {
+    return textureCompression != TextureCompression::NONE && TextureCompressionUtil::canCompressImage(image);
+}
+
+uint64_t getImageHash(const CesiumGltf::ImageCesium& image) {
+    const auto pixelData =
+        std::string_view(reinterpret_cast<const char*>(image.pixelData.data()), image.pixelData.size());
+
+    return CppUtil::hashValues(
+        pixelData,
+        image.width,
+        image.height,
+        image.channels,
+        image.bytesPerChannel,
+        image.compressedPixelFormat,
+        image.mipPositions.size());
+}
+
+std::shared_ptr<FabricTexture> acquireSharedFabricTexture(
+    FabricResourceManager& fabricResourceManager,
+    const CesiumGltf::ImageCesium& image,
+    uint64_t imageHash,
+    TransferFunction transferFunction,
+    TextureCompression textureCompression) {
+    if (!shouldCompressImage(image, textureCompression)) {
+        const auto setTexture = [&image, transferFunction](FabricTexture& texture) {
+            texture.setImage(image, transferFunction);
+        };
+
+        // The descriptor holds the resolution and pixel format, so the pixel data is all that's left to compare
+        return fabricResourceManager.acquireSharedTexture(
+            imageHash, image.pixelData, FabricTextureDescriptor(image, transferFunction), setTexture);
     }
 
-    return fabricMeshes;
+    // The descriptor of the compressed image is known up front, so the image is only compressed when no texture
+    // with the same content is shared yet
+    CesiumGltf::ImageCesium compressedImageHeader;
+    compressedImageHeader.width = image.width;
+    compressedImageHeader.height = image.height;
+    compressedImageHeader.channels = image.channels;
+    compressedImageHeader.bytesPerChannel = image.bytesPerChannel;
+    compressedImageHeader.compressedPixelFormat = TextureCompressionUtil::getCompressedPixelFormat(image);
+
+    const auto setTexture = [&fabricResourceManager, &image, transferFunction, textureCompression](
+                                FabricTexture& texture) {
+        texture.setImage(compressImage(fabricResourceManager, image, textureCompression), transferFunction);
+    };
+
+    // The compressed texels depend on the compression mode as well as the source pixels
+    std::vector<std::byte> content;
+    content.reserve(image.pixelData.size() + sizeof(textureCompression));
+    content.insert(content.end(), image.pixelData.begin(), image.pixelData.end());
+    const auto pTextureCompression = reinterpret_cast<const std::byte*>(&textureCompression);
+    content.insert(content.end(), pTextureCompression, pTextureCompression + sizeof(textureCompression));
+
+    return fabricResourceManager.acquireSharedTexture(
+        CppUtil::hashValues(imageHash, textureCompression),
+        content,
+        FabricTextureDescriptor(compressedImageHeader, transferFunction),
+        setTexture);
 }
 
-void setFabricTextures(
-    const Context& context,
+void acquireFabricTextures(
+    Context& context,
     const CesiumGltf::Model& model,
     const std::vector<LoadingMesh>& loadingMeshes,
-    std::vector<FabricMesh>& fabricMeshes) {
-    CESIUM_TRACE("FabricPrepareRenderResources::setFabricTextures");
+    std::vector<FabricMesh>& fabricMeshes,
+    TextureCompression textureCompression) {
+    CESIUM_TRACE("FabricPrepareRenderResources::acquireFabricTextures");
+
+    // Textures are acquired once the image is known so that they come from the pool that matches the
+    // image's resolution and format
+    auto& fabricResourceManager = context.getFabricResourceManager();
+
+    // Primitives and tiles that reference the same image share one texture. The pixel data is compared when a texture
+    // with the same hash is found, and an image is only hashed once per tile. Sampler state is part of the material,
+    // not the texture.
+    std::unordered_map<const CesiumGltf::ImageCesium*, uint64_t> imageHashes;
+
+    const auto acquireImageTexture = [&fabricResourceManager, &imageHashes](
+                                         const CesiumGltf::ImageCesium& image,
+                                         TransferFunction transferFunction,
+                                         TextureCompression imageTextureCompression) {
+        auto iter = imageHashes.find(&image);
+        if (iter == imageHashes.end()) {
+            iter = imageHashes.emplace(&image, getImageHash(image)).first;
+        }
+
+        return acquireSharedFabricTexture(
+            fabricResourceManager, image, iter->second, transferFunction, imageTextureCompression);
+    };
+
     for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
         const auto& loadingMesh = loadingMeshes[i];
         const auto& primitive = model.meshes[loadingMesh.gltfMeshIndex].primitives[loadingMesh.gltfPrimitiveIndex];
         auto& fabricMesh = fabricMeshes[i];
 
-        if (fabricMesh.pBaseColorTexture) {
+        auto& primitiveInfo = fabricMesh.primitiveInfo;
+
+        if (primitiveInfo.materialInfo.baseColorTexture.has_value()) {
             const auto pBaseColorTextureImage = GltfUtil::getBaseColorTextureImage(model, primitive);
-            if (!pBaseColorTextureImage || context.getFabricResourceManager().getDisableTextures()) {
-                fabricMesh.pBaseColorTexture->setBytes(
-                    {std::byte(255), std::byte(255), std::byte(255), std::byte(255)}, 1, 1, carb::Format::eRGBA8_SRGB);
+            if (!pBaseColorTextureImage || fabricResourceManager.getDisableTextures()) {
+                fabricMesh.pBaseColorTexture = acquireSharedFabricTexture(
+                    fabricResourceManager,
+                    {std::byte(255), std::byte(255), std::byte(255), std::byte(255)},
+                    1,
+                    1,
+                    carb::Format::eRGBA8_SRGB);
             } else {
-                fabricMesh.pBaseColorTexture->setImage(*pBaseColorTextureImage, TransferFunction::SRGB);
+                // Only base color images are compressed. Feature ID and property textures hold exact values.
+                fabricMesh.pBaseColorTexture =
+                    acquireImageTexture(*pBaseColorTextureImage, TransferFunction::SRGB, textureCompression);
             }
         }
 
-        const auto featureIdTextureCount = fabricMesh.featureIdTextures.size();
+        const auto featureIdTextureCount = getFeatureIdTextureCount(primitiveInfo.featuresInfo);
+        fabricMesh.featureIdTextures.reserve(featureIdTextureCount);
         for (uint64_t j = 0; j < featureIdTextureCount; ++j) {
             const auto featureIdSetIndex = fabricMesh.featureIdTextureSetIndexMapping[j];
             const auto pFeatureIdTextureImage = GltfUtil::getFeatureIdTextureImage(model, primitive, featureIdSetIndex);
             if (!pFeatureIdTextureImage) {
-                fabricMesh.featureIdTextures[j]->setBytes(
-                    {std::byte(0), std::byte(0), std::byte(0), std::byte(0)}, 1, 1, carb::Format::eRGBA8_SRGB);
+                fabricMesh.featureIdTextures.push_back(acquireSharedFabricTexture(
+                    fabricResourceManager,
+                    {std::byte(0), std::byte(0), std::byte(0), std::byte(0)},
+                    1,
+                    1,
+                    carb::Format::eRGBA8_SRGB));
             } else {
-                fabricMesh.featureIdTextures[j]->setImage(*pFeatureIdTextureImage, TransferFunction::LINEAR);
+                fabricMesh.featureIdTextures.push_back(
+                    acquireImageTexture(*pFeatureIdTextureImage, TransferFunction::LINEAR, TextureCompression::NONE));
             }
         }
 
-        const auto propertyTextureImages = MetadataUtil::getPropertyTextureImages(context, model, primitive);
-        const auto propertyTextureCount = fabricMesh.propertyTextures.size();
-        for (uint64_t j = 0; j < propertyTextureCount; ++j) {
-            fabricMesh.propertyTextures[j]->setImage(*propertyTextureImages[j], TransferFunction::LINEAR);
+        fabricMesh.propertyTextures.reserve(primitiveInfo.propertyTextureImages.size());
+        for (const auto pPropertyTextureImage : primitiveInfo.propertyTextureImages) {
+            fabricMesh.propertyTextures.push_back(
+                acquireImageTexture(*pPropertyTextureImage, TransferFunction::LINEAR, TextureCompression::NONE));
         }
 
-        const auto propertyTableTextures = MetadataUtil::encodePropertyTables(context, model, primitive);
-        const auto propertyTableTextureCount = fabricMesh.propertyTableTextures.size();
-        for (uint64_t j = 0; j < propertyTableTextureCount; ++j) {
-            const auto& texture = propertyTableTextures[j];
-            fabricMesh.propertyTableTextures[j]->setBytes(texture.bytes, texture.width, texture.height, texture.format);
+        // Primitives and tiles that use property tables with the same values share the same textures
+        fabricMesh.propertyTableTextures.reserve(primitiveInfo.propertyTableTextures.size());
+        for (const auto& texture : primitiveInfo.propertyTableTextures) {
+            fabricMesh.propertyTableTextures.push_back(fabricResourceManager.acquireSharedTexture(
+                texture.contentHash, texture.content, texture.textureDescriptor, texture.setTexture));
+        }
+
+        // The contents and encode callbacks are no longer needed. The callbacks reference the glTF buffers.
+        primitiveInfo.propertyTableTextures.clear();
+        primitiveInfo.propertyTableTextures.shrink_to_fit();
+    }
+}
+
+TilesetRenderInfo getTilesetRenderInfo(const OmniTileset& tileset, const TilesetSettings& tilesetSettings) {
+    // The transform was already computed this frame in OmniTileset::updateTransform
+    return TilesetRenderInfo{
+        tilesetSettings.tilesetId,
+        tileset.getEcefToPrimWorldTransform(),
+        tilesetSettings.materialPath,
+        tilesetSettings.displayColor,
+        tilesetSettings.displayOpacity,
+    };
+}
+
+uint64_t getRasterOverlayIndex(
+    const TilesetSettings& tilesetSettings,
+    const CesiumRasterOverlays::RasterOverlay& nativeRasterOverlay) {
+    const auto& rasterOverlays = tilesetSettings.rasterOverlays;
+    const auto iter = std::find_if(
+        rasterOverlays.begin(), rasterOverlays.end(), [&nativeRasterOverlay](const auto& rasterOverlay) {
+            return rasterOverlay.pNativeRasterOverlay == &nativeRasterOverlay;
+        });
+
+    return static_cast<uint64_t>(std::distance(rasterOverlays.begin(), iter));
+}
+
+std::vector<FabricGeometryData> computeGeometryData(
+    const CesiumGltf::Model& model,
+    const std::vector<LoadingMesh>& loadingMeshes,
+    const std::vector<FabricMesh>& fabricMeshes,
+    bool smoothNormals) {
+    CESIUM_TRACE("FabricPrepareRenderResources::computeGeometryData");
+
+    std::vector<FabricGeometryData> geometryData(loadingMeshes.size());
+
+    for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
+        const auto& loadingMesh = loadingMeshes[i];
+        const auto& fabricMesh = fabricMeshes[i];
+
+        const auto computePrimitiveGeometryData = [&](uint64_t gltfMeshIndex, uint64_t gltfPrimitiveIndex) {
+            return FabricGeometry::computeGeometryData(
+                fabricMesh.pGeometry->getGeometryDescriptor(),
+                model,
+                model.meshes[gltfMeshIndex].primitives[gltfPrimitiveIndex],
+                fabricMesh.primitiveInfo.materialInfo,
+                smoothNormals,
+                fabricMesh.texcoordIndexMapping,
+                fabricMesh.rasterOverlayTexcoordIndexMapping);
+        };
+
+        geometryData[i] = computePrimitiveGeometryData(loadingMesh.gltfMeshIndex, loadingMesh.gltfPrimitiveIndex);
+
+        // Merged primitives are moved into the glTF local space of this mesh
+        const auto ecefToGltfLocalTransform = glm::inverse(loadingMesh.gltfLocalToEcefTransform);
+
+        for (const auto& mergedPrimitive : loadingMesh.mergedPrimitives) {
+            FabricGeometryDataUtil::appendGeometryData(
+                geometryData[i],
+                computePrimitiveGeometryData(mergedPrimitive.gltfMeshIndex, mergedPrimitive.gltfPrimitiveIndex),
+                ecefToGltfLocalTransform * mergedPrimitive.gltfLocalToEcefTransform);
         }
     }
+
+    return geometryData;
 }
 
 void setFabricMeshes(
-    const Context& context,
     const CesiumGltf::Model& model,
     const std::vector<LoadingMesh>& loadingMeshes,
     std::vector<FabricMesh>& fabricMeshes,
-    const OmniTileset& tileset) {
+    const std::vector<FabricGeometryData>& geometryData,
+    const TilesetRenderInfo& tilesetRenderInfo) {
     CESIUM_TRACE("FabricPrepareRenderResources::setFabricMeshes");
 
-    const auto& tilesetMaterialPath = tileset.getMaterialPath();
-    const auto displayColor = tileset.getDisplayColor();
-    const auto displayOpacity = tileset.getDisplayOpacity();
-
-    const auto ecefToPrimWorldTransform =
-        UsdUtil::computeEcefToPrimWorldTransform(context, tileset.getResolvedGeoreferencePath(), tileset.getPath());
-
-    const auto tilesetId = tileset.getTilesetId();
-    const auto smoothNormals = tileset.getSmoothNormals();
+    const auto& tilesetMaterialPath = tilesetRenderInfo.tilesetMaterialPath;
+    const auto& displayColor = tilesetRenderInfo.displayColor;
+    const auto displayOpacity = tilesetRenderInfo.displayOpacity;
+    const auto& ecefToPrimWorldTransform = tilesetRenderInfo.ecefToPrimWorldTransform;
+    const auto tilesetId = tilesetRenderInfo.tilesetId;
 
     for (uint64_t i = 0; i < loadingMeshes.size(); ++i) {
         const auto& loadingMesh = loadingMeshes[i];
@@ -260,23 +685,14 @@ void setFabricMeshes(
         const auto pMaterial = fabricMesh.pMaterial;
 
         pGeometry->setGeometry(
-            tilesetId,
-            ecefToPrimWorldTransform,
-            loadingMesh.gltfLocalToEcefTransform,
-            model,
-            primitive,
-            fabricMesh.materialInfo,
-            smoothNormals,
-            fabricMesh.texcoordIndexMapping,
-            fabricMesh.rasterOverlayTexcoordIndexMapping);
+            tilesetId, ecefToPrimWorldTransform, loadingMesh.gltfLocalToEcefTransform, geometryData[i]);
 
         if (pMaterial) {
             pMaterial->setMaterial(
                 model,
                 primitive,
                 tilesetId,
-                fabricMesh.materialInfo,
-                fabricMesh.featuresInfo,
+                fabricMesh.primitiveInfo,
                 fabricMesh.pBaseColorTexture.get(),
                 fabricMesh.featureIdTextures,
                 fabricMesh.propertyTextures,
@@ -286,8 +702,7 @@ void setFabricMeshes(
                 fabricMesh.texcoordIndexMapping,
                 fabricMesh.featureIdIndexSetIndexMapping,
                 fabricMesh.featureIdAttributeSetIndexMapping,
-                fabricMesh.featureIdTextureSetIndexMapping,
-                fabricMesh.propertyTextureIndexMapping);
+                fabricMesh.featureIdTextureSetIndexMapping);
 
             pGeometry->setMaterial(pMaterial->getPath());
         } else if (!tilesetMaterialPath.IsEmpty()) {
@@ -302,6 +717,7 @@ void freeFabricMeshes(Context& context, const std::vector<FabricMesh>& fabricMes
     for (const auto& fabricMesh : fabricMeshes) {
         if (fabricMesh.pGeometry) {
             fabricResourceManager.releaseGeometry(fabricMesh.pGeometry);
+            fabricResourceManager.removeGeometryPrimitives(fabricMesh.primitiveCount);
         }
 
         if (fabricMesh.pMaterial) {
@@ -328,9 +744,22 @@ void freeFabricMeshes(Context& context, const std::vector<FabricMesh>& fabricMes
 
 } // namespace
 
+struct FabricPrepareRenderResources::PendingFabricMeshes {
+    const Cesium3DTilesSelection::Tile* pTile;
+    FabricRenderResources* pRenderResources;
+    std::vector<LoadingMesh> loadingMeshes;
+    std::vector<FabricGeometryData> geometryData;
+};
+
 FabricPrepareRenderResources::FabricPrepareRenderResources(Context* pContext, OmniTileset* pTileset)
     : _pContext(pContext)
-    , _pTileset(pTileset) {}
+    , _pTileset(pTileset)
+    , _mainThreadId(std::this_thread::get_id()) {}
+
+FabricPrepareRenderResources::~FabricPrepareRenderResources() {
+    // Release anything that was freed off the main thread since the last commit
+    flushFabricWrites();
+}
 
 CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources>
 FabricPrepareRenderResources::prepareInLoadThread(
@@ -344,7 +773,10 @@ FabricPrepareRenderResources::prepareInLoadThread(
             Cesium3DTilesSelection::TileLoadResultAndRenderResources{std::move(tileLoadResult), nullptr});
     }
 
-    if (!tilesetExists()) {
+    // The settings snapshot is read once so that every primitive in the tile sees the same settings
+    const auto pSettings = getSettings();
+
+    if (!tilesetExists() || !pSettings) {
         return asyncSystem.createResolvedFuture(
             Cesium3DTilesSelection::TileLoadResultAndRenderResources{std::move(tileLoadResult), nullptr});
     }
@@ -357,61 +789,37 @@ FabricPrepareRenderResources::prepareInLoadThread(
     FabricRasterOverlaysInfo rasterOverlaysInfo;
 
     if (overlapsRasterOverlay) {
-        for (const auto& rasterOverlayPath : _pTileset->getRasterOverlayPaths()) {
-            const auto& pRasterOverlay = _pContext->getAssetRegistry().getRasterOverlay(rasterOverlayPath);
-            const auto overlayRenderMethod =
-                pRasterOverlay ? pRasterOverlay->getOverlayRenderMethod() : FabricOverlayRenderMethod::OVERLAY;
-            rasterOverlaysInfo.overlayRenderMethods.push_back(overlayRenderMethod);
+        for (const auto& rasterOverlay : pSettings->rasterOverlays) {
+            rasterOverlaysInfo.overlayRenderMethods.push_back(rasterOverlay.overlayRenderMethod);
         }
     }
 
     auto loadingMeshes = getLoadingMeshes(tileToEcefTransform, *pModel);
 
-    struct IntermediateLoadThreadResult {
-        Cesium3DTilesSelection::TileLoadResult tileLoadResult;
-        std::vector<LoadingMesh> loadingMeshes;
-        std::vector<FabricMesh> fabricMeshes;
-    };
-
-    return asyncSystem
-        .runInMainThread([this,
-                          rasterOverlaysInfo = std::move(rasterOverlaysInfo),
-                          loadingMeshes = std::move(loadingMeshes),
-                          tileLoadResult = std::move(tileLoadResult)]() mutable {
-            if (!tilesetExists()) {
-                return IntermediateLoadThreadResult{
-                    std::move(tileLoadResult),
-                    {},
-                    {},
-                };
-            }
+    auto fabricMeshes = getFabricMeshes(*_pContext, *pModel, loadingMeshes, rasterOverlaysInfo, *pSettings);
 
-            const auto pModel = std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
-            auto fabricMeshes = acquireFabricMeshes(*_pContext, *pModel, loadingMeshes, rasterOverlaysInfo, *_pTileset);
-            return IntermediateLoadThreadResult{
-                std::move(tileLoadResult),
-                std::move(loadingMeshes),
-                std::move(fabricMeshes),
-            };
-        })
-        .thenInWorkerThread([this](IntermediateLoadThreadResult&& workerResult) mutable {
-            auto tileLoadResult = std::move(workerResult.tileLoadResult);
-            auto loadingMeshes = std::move(workerResult.loadingMeshes);
-            auto fabricMeshes = std::move(workerResult.fabricMeshes);
-            const auto pModel = std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
-
-            if (tilesetExists()) {
-                setFabricTextures(*_pContext, *pModel, loadingMeshes, fabricMeshes);
-            }
+    // Compatible primitives are merged before anything is acquired so that merged primitives don't use any Fabric
+    // prims of their own
+    if (pSettings->mergePrimitives) {
+        mergeLoadingMeshes(*_pContext, *pModel, loadingMeshes, fabricMeshes, rasterOverlaysInfo, *pSettings);
+    }
 
-            return Cesium3DTilesSelection::TileLoadResultAndRenderResources{
-                std::move(tileLoadResult),
-                new TileLoadThreadResult{
-                    std::move(loadingMeshes),
-                    std::move(fabricMeshes),
-                },
-            };
-        });
+    // Geometry and materials are acquired here in the worker thread. Their Fabric prims are created in a batch on
+    // the main thread before prepareInMainThread is called. See FabricResourceManager::initializePendingResources.
+    acquireFabricMeshes(*_pContext, *pModel, loadingMeshes, fabricMeshes, rasterOverlaysInfo, *pSettings);
+    acquireFabricTextures(*_pContext, *pModel, loadingMeshes, fabricMeshes, pSettings->textureCompression);
+
+    // Vertex buffers are computed here so that the main thread only needs to copy them into Fabric
+    auto geometryData = computeGeometryData(*pModel, loadingMeshes, fabricMeshes, pSettings->smoothNormals);
+
+    return asyncSystem.createResolvedFuture(Cesium3DTilesSelection::TileLoadResultAndRenderResources{
+        std::move(tileLoadResult),
+        new TileLoadThreadResult{
+            std::move(loadingMeshes),
+            std::move(fabricMeshes),
+            std::move(geometryData),
+        },
+    });
 }
 
 void* FabricPrepareRenderResources::prepareInMainThread(Cesium3DTilesSelection::Tile& tile, void* pLoadThreadResult) {
@@ -422,7 +830,7 @@ void* FabricPrepareRenderResources::prepareInMainThread(Cesium3DTilesSelection::
     // Wrap in a unique_ptr so that pLoadThreadResult gets freed when this function returns
     std::unique_ptr<TileLoadThreadResult> pTileLoadThreadResult(static_cast<TileLoadThreadResult*>(pLoadThreadResult));
 
-    const auto& loadingMeshes = pTileLoadThreadResult->loadingMeshes;
+    auto& loadingMeshes = pTileLoadThreadResult->loadingMeshes;
     auto& fabricMeshes = pTileLoadThreadResult->fabricMeshes;
 
     const auto& content = tile.getContent();
@@ -431,44 +839,71 @@ void* FabricPrepareRenderResources::prepareInMainThread(Cesium3DTilesSelection::
         return nullptr;
     }
 
-    const auto& model = pRenderContent->getModel();
+    const auto pRenderResources = new FabricRenderResources{
+        std::move(fabricMeshes),
+    };
 
     if (tilesetExists()) {
-        setFabricMeshes(*_pContext, model, loadingMeshes, fabricMeshes, *_pTileset);
+        // Make sure the Fabric prims for this tile have been created
+        runFabricWrite([this]() { _pContext->getFabricResourceManager().initializePendingResources(); });
+
+        // The geometry and material values are written later in commitFabricMeshes
+        _pendingFabricMeshes.push_back(std::make_unique<PendingFabricMeshes>(PendingFabricMeshes{
+            &tile,
+            pRenderResources,
+            std::move(loadingMeshes),
+            std::move(pTileLoadThreadResult->geometryData),
+        }));
     }
 
-    return new FabricRenderResources{
-        std::move(fabricMeshes),
-    };
+    return pRenderResources;
 }
 
 void FabricPrepareRenderResources::free(
     [[maybe_unused]] Cesium3DTilesSelection::Tile& tile,
     void* pLoadThreadResult,
     void* pMainThreadResult) noexcept {
-    if (pLoadThreadResult) {
-        const auto pTileLoadThreadResult = static_cast<TileLoadThreadResult*>(pLoadThreadResult);
-        freeFabricMeshes(*_pContext, pTileLoadThreadResult->fabricMeshes);
-        delete pTileLoadThreadResult;
-    }
+    // Releasing resets the Fabric prims, so the render resources stay alive until the write runs
+    runFabricWrite([this, pLoadThreadResult, pMainThreadResult]() {
+        if (pLoadThreadResult) {
+            const auto pTileLoadThreadResult = static_cast<TileLoadThreadResult*>(pLoadThreadResult);
+            freeFabricMeshes(*_pContext, pTileLoadThreadResult->fabricMeshes);
+            delete pTileLoadThreadResult;
+        }
 
-    if (pMainThreadResult) {
-        const auto pFabricRenderResources = static_cast<FabricRenderResources*>(pMainThreadResult);
-        freeFabricMeshes(*_pContext, pFabricRenderResources->fabricMeshes);
-        delete pFabricRenderResources;
-    }
+        if (pMainThreadResult) {
+            const auto pFabricRenderResources = static_cast<FabricRenderResources*>(pMainThreadResult);
+            CppUtil::eraseIf(_pendingFabricMeshes, [pFabricRenderResources](const auto& pPendingFabricMeshes) {
+                return pPendingFabricMeshes->pRenderResources == pFabricRenderResources;
+            });
+            freeFabricMeshes(*_pContext, pFabricRenderResources->fabricMeshes);
+            delete pFabricRenderResources;
+        }
+    });
 }
 
 void* FabricPrepareRenderResources::prepareRasterInLoadThread(
     CesiumGltf::ImageCesium& image,
-    [[maybe_unused]] const std::any& rendererOptions) {
+    const std::any& rendererOptions) {
 
     if (!tilesetExists()) {
         return nullptr;
     }
 
-    const auto pTexture = _pContext->getFabricResourceManager().acquireTexture();
-    pTexture->setImage(image, TransferFunction::SRGB);
+    auto& fabricResourceManager = _pContext->getFabricResourceManager();
+
+    // See OmniRasterOverlay::setRasterOverlayOptionsFromUsd
+    const auto pTextureCompression = std::any_cast<TextureCompression>(&rendererOptions);
+    const auto textureCompression = pTextureCompression ? *pTextureCompression : TextureCompression::NONE;
+
+    if (shouldCompressImage(image, textureCompression)) {
+        // The raster overlay image is left as is since cesium-native may use it to create sub tiles
+        const auto compressedImage = compressImage(fabricResourceManager, image, textureCompression);
+        const auto pTexture = acquireFabricTexture(fabricResourceManager, compressedImage, TransferFunction::SRGB);
+        return new RasterOverlayLoadThreadResult{pTexture};
+    }
+
+    const auto pTexture = acquireFabricTexture(fabricResourceManager, image, TransferFunction::SRGB);
     return new RasterOverlayLoadThreadResult{pTexture};
 }
 
@@ -495,17 +930,19 @@ void FabricPrepareRenderResources::freeRaster(
     void* pLoadThreadResult,
     void* pMainThreadResult) noexcept {
 
-    if (pLoadThreadResult) {
-        const auto pRasterOverlayLoadThreadResult = static_cast<RasterOverlayLoadThreadResult*>(pLoadThreadResult);
-        _pContext->getFabricResourceManager().releaseTexture(pRasterOverlayLoadThreadResult->pTexture);
-        delete pRasterOverlayLoadThreadResult;
-    }
+    runFabricWrite([this, pLoadThreadResult, pMainThreadResult]() {
+        if (pLoadThreadResult) {
+            const auto pRasterOverlayLoadThreadResult = static_cast<RasterOverlayLoadThreadResult*>(pLoadThreadResult);
+            _pContext->getFabricResourceManager().releaseTexture(pRasterOverlayLoadThreadResult->pTexture);
+            delete pRasterOverlayLoadThreadResult;
+        }
 
-    if (pMainThreadResult) {
-        const auto pRasterOverlayRenderResources = static_cast<RasterOverlayRenderResources*>(pMainThreadResult);
-        _pContext->getFabricResourceManager().releaseTexture(pRasterOverlayRenderResources->pTexture);
-        delete pRasterOverlayRenderResources;
-    }
+        if (pMainThreadResult) {
+            const auto pRasterOverlayRenderResources = static_cast<RasterOverlayRenderResources*>(pMainThreadResult);
+            _pContext->getFabricResourceManager().releaseTexture(pRasterOverlayRenderResources->pTexture);
+            delete pRasterOverlayRenderResources;
+        }
+    });
 }
 
 void FabricPrepareRenderResources::attachRasterInMainThread(
@@ -525,7 +962,7 @@ void FabricPrepareRenderResources::attachRasterInMainThread(
         return;
     }
 
-    const auto pTexture = pRasterOverlayRenderResources->pTexture.get();
+    const auto pTexture = pRasterOverlayRenderResources->pTexture;
 
     const auto& content = tile.getContent();
     const auto pRenderContent = content.getRenderContent();
@@ -538,45 +975,46 @@ void FabricPrepareRenderResources::attachRasterInMainThread(
         return;
     }
 
-    const auto rasterOverlayPath = _pTileset->getRasterOverlayPathIfExists(rasterTile.getOverlay());
-
-    if (rasterOverlayPath.IsEmpty()) {
-        return;
-    }
-
-    const auto rasterOverlayPaths = _pTileset->getRasterOverlayPaths();
-    const auto rasterOverlayIndex = CppUtil::indexOf(_pTileset->getRasterOverlayPaths(), rasterOverlayPath);
-
-    if (rasterOverlayIndex == rasterOverlayPaths.size()) {
+    const auto pSettings = getSettings();
+    if (!pSettings) {
         return;
     }
 
-    const auto pRasterOverlay = _pContext->getAssetRegistry().getRasterOverlay(rasterOverlayPath);
+    const auto rasterOverlayIndex = getRasterOverlayIndex(*pSettings, rasterTile.getOverlay());
 
-    if (!pRasterOverlay) {
+    if (rasterOverlayIndex == pSettings->rasterOverlays.size()) {
         return;
     }
 
-    const auto alpha = glm::clamp(pRasterOverlay->getAlpha(), 0.0, 1.0);
+    const auto alpha = glm::clamp(pSettings->rasterOverlays[rasterOverlayIndex].alpha, 0.0, 1.0);
+    const auto gltfSetIndex = static_cast<uint64_t>(overlayTextureCoordinateID);
+    const auto textureInfo = FabricTextureInfo{
+        translation,
+        0.0,
+        scale,
+        gltfSetIndex,
+        CesiumGltf::Sampler::WrapS::CLAMP_TO_EDGE,
+        CesiumGltf::Sampler::WrapT::CLAMP_TO_EDGE,
+        false,
+        {},
+    };
 
-    for (const auto& fabricMesh : pFabricRenderResources->fabricMeshes) {
-        const auto pMaterial = fabricMesh.pMaterial;
-        if (pMaterial) {
-            const auto gltfSetIndex = static_cast<uint64_t>(overlayTextureCoordinateID);
-            const auto textureInfo = FabricTextureInfo{
-                translation,
-                0.0,
-                scale,
-                gltfSetIndex,
-                CesiumGltf::Sampler::WrapS::CLAMP_TO_EDGE,
-                CesiumGltf::Sampler::WrapT::CLAMP_TO_EDGE,
-                false,
-                {},
-            };
-            pMaterial->setRasterOverlay(
-                pTexture, textureInfo, rasterOverlayIndex, alpha, fabricMesh.rasterOverlayTexcoordIndexMapping);
+    runFabricWrite([this, pFabricRenderResources, pTexture, textureInfo, rasterOverlayIndex, alpha]() {
+        // The material values need to be written before the raster overlay is attached
+        flushFabricMeshes(pFabricRenderResources);
+
+        for (const auto& fabricMesh : pFabricRenderResources->fabricMeshes) {
+            const auto pMaterial = fabricMesh.pMaterial;
+            if (pMaterial) {
+                pMaterial->setRasterOverlay(
+                    pTexture.get(),
+                    textureInfo,
+                    rasterOverlayIndex,
+                    alpha,
+                    fabricMesh.rasterOverlayTexcoordIndexMapping);
+            }
         }
-    }
+    });
 }
 
 void FabricPrepareRenderResources::detachRasterInMainThread(
@@ -596,39 +1034,157 @@ void FabricPrepareRenderResources::detachRasterInMainThread(
         return;
     }
 
-    if (!tilesetExists()) {
+    const auto pSettings = getSettings();
+
+    if (!tilesetExists() || !pSettings) {
         return;
     }
 
-    const auto rasterOverlayPath = _pTileset->getRasterOverlayPathIfExists(rasterTile.getOverlay());
+    const auto rasterOverlayIndex = getRasterOverlayIndex(*pSettings, rasterTile.getOverlay());
 
-    if (rasterOverlayPath.IsEmpty()) {
+    if (rasterOverlayIndex == pSettings->rasterOverlays.size()) {
         return;
     }
 
-    const auto rasterOverlayPaths = _pTileset->getRasterOverlayPaths();
-    const auto rasterOverlayIndex = CppUtil::indexOf(rasterOverlayPaths, rasterOverlayPath);
+    runFabricWrite([pFabricRenderResources, rasterOverlayIndex]() {
+        for (const auto& fabricMesh : pFabricRenderResources->fabricMeshes) {
+            const auto pMaterial = fabricMesh.pMaterial;
+            if (pMaterial) {
+                pMaterial->clearRasterOverlay(rasterOverlayIndex);
+            }
+        }
+    });
+}
 
-    if (rasterOverlayIndex == rasterOverlayPaths.size()) {
+void FabricPrepareRenderResources::commitFabricMeshes(double timeBudget) {
+    CESIUM_TRACE("FabricPrepareRenderResources::commitFabricMeshes");
+
+    flushFabricWrites();
+
+    if (_pendingFabricMeshes.empty()) {
         return;
     }
 
-    for (const auto& fabricMesh : pFabricRenderResources->fabricMeshes) {
-        const auto pMaterial = fabricMesh.pMaterial;
-        if (pMaterial) {
-            pMaterial->clearRasterOverlay(rasterOverlayIndex);
+    const auto pSettings = getSettings();
+
+    if (!tilesetExists() || !pSettings) {
+        _pendingFabricMeshes.clear();
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto tilesetRenderInfo = getTilesetRenderInfo(*_pTileset, *pSettings);
+
+    uint64_t committedCount = 0;
+
+    for (const auto& pPendingFabricMeshes : _pendingFabricMeshes) {
+        const auto pRenderContent = pPendingFabricMeshes->pTile->getContent().getRenderContent();
+        if (pRenderContent) {
+            setFabricMeshes(
+                pRenderContent->getModel(),
+                pPendingFabricMeshes->loadingMeshes,
+                pPendingFabricMeshes->pRenderResources->fabricMeshes,
+                pPendingFabricMeshes->geometryData,
+                tilesetRenderInfo);
+        }
+
+        ++committedCount;
+
+        // At least one tile is committed each frame so that loading always makes progress
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        if (timeBudget > 0.0 && elapsed.count() >= timeBudget) {
+            break;
         }
     }
+
+    _pendingFabricMeshes.erase(
+        _pendingFabricMeshes.begin(), _pendingFabricMeshes.begin() + static_cast<int64_t>(committedCount));
+}
+
+void FabricPrepareRenderResources::flushFabricMeshes(const FabricRenderResources* pRenderResources) {
+    const auto pSettings = getSettings();
+    if (!pSettings) {
+        return;
+    }
+
+    const auto iter = std::find_if(
+        _pendingFabricMeshes.begin(), _pendingFabricMeshes.end(), [pRenderResources](const auto& pPendingFabricMeshes) {
+            return pPendingFabricMeshes->pRenderResources == pRenderResources;
+        });
+
+    if (iter == _pendingFabricMeshes.end()) {
+        return;
+    }
+
+    const auto pPendingFabricMeshes = std::move(*iter);
+    _pendingFabricMeshes.erase(iter);
+
+    const auto pRenderContent = pPendingFabricMeshes->pTile->getContent().getRenderContent();
+    if (!pRenderContent) {
+        return;
+    }
+
+    setFabricMeshes(
+        pRenderContent->getModel(),
+        pPendingFabricMeshes->loadingMeshes,
+        pPendingFabricMeshes->pRenderResources->fabricMeshes,
+        pPendingFabricMeshes->geometryData,
+        getTilesetRenderInfo(*_pTileset, *pSettings));
+}
+
+void FabricPrepareRenderResources::setSettings(std::shared_ptr<const TilesetSettings> pSettings) {
+    std::scoped_lock<std::mutex> lock(_settingsMutex);
+    _pSettings = std::move(pSettings);
+}
+
+std::shared_ptr<const TilesetSettings> FabricPrepareRenderResources::getSettings() const {
+    std::scoped_lock<std::mutex> lock(_settingsMutex);
+    return _pSettings;
+}
+
+void FabricPrepareRenderResources::setTilesetExists(bool tilesetExists) {
+    _tilesetExists = tilesetExists;
+}
+
+void FabricPrepareRenderResources::runFabricWrite(std::function<void()> fabricWrite) {
+    // Fabric is only written from the main thread. Callbacks that run on another thread, such as those called during
+    // pipelined tile selection, queue their writes until the next commit. Writes are applied in the order they were
+    // made so that a tile is never written after it's freed.
+    if (std::this_thread::get_id() != _mainThreadId) {
+        std::scoped_lock<std::mutex> lock(_fabricWritesMutex);
+        _deferredFabricWrites.push_back(std::move(fabricWrite));
+        return;
+    }
+
+    flushFabricWrites();
+    fabricWrite();
+}
+
+void FabricPrepareRenderResources::flushFabricWrites() {
+    std::vector<std::function<void()>> fabricWrites;
+
+    {
+        std::scoped_lock<std::mutex> lock(_fabricWritesMutex);
+        fabricWrites.swap(_deferredFabricWrites);
+    }
+
+    for (const auto& fabricWrite : fabricWrites) {
+        fabricWrite();
+    }
 }
 
 bool FabricPrepareRenderResources::tilesetExists() const {
-    // When a tileset is deleted there's a short period between the prim being deleted and TfNotice notifying us about the change.
-    // This function helps us know whether we should proceed with loading render resources.
-    return _pTileset && _pContext->hasUsdStage() && UsdUtil::primExists(_pContext->getUsdStage(), _pTileset->getPath());
+    // When a tileset is deleted there's a short period between the prim being deleted and TfNotice notifying us about
+    // the change. This flag helps us know whether we should proceed with loading render resources. It's updated by
+    // OmniTileset once per frame so that worker threads don't need to query USD.
+    return _tilesetExists;
 }
 
 void FabricPrepareRenderResources::detachTileset() {
+    flushFabricWrites();
+    _tilesetExists = false;
     _pTileset = nullptr;
+    _pendingFabricMeshes.clear();
 }
 
 } // namespace cesium::omniverse
@@ -1,24 +1,31 @@
 #include "cesium/omniverse/FabricResourceManager.h"
 
+#include "cesium/omniverse/AssetRegistry.h"
 #include "cesium/omniverse/Context.h"
+#include "cesium/omniverse/CppUtil.h"
 #include "cesium/omniverse/FabricGeometry.h"
 #include "cesium/omniverse/FabricGeometryDescriptor.h"
 #include "cesium/omniverse/FabricGeometryPool.h"
 #include "cesium/omniverse/FabricMaterialDescriptor.h"
 #include "cesium/omniverse/FabricMaterialInfo.h"
 #include "cesium/omniverse/FabricMaterialPool.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricPropertyDescriptor.h"
 #include "cesium/omniverse/FabricTexture.h"
 #include "cesium/omniverse/FabricTexturePool.h"
 #include "cesium/omniverse/FabricUtil.h"
 #include "cesium/omniverse/FabricVertexAttributeDescriptor.h"
 #include "cesium/omniverse/GltfUtil.h"
-#include "cesium/omniverse/MetadataUtil.h"
+#include "cesium/omniverse/OmniTileset.h"
+#include "cesium/omniverse/TilesetSettings.h"
 #include "cesium/omniverse/UsdUtil.h"
 
+#include <CesiumUtility/Tracing.h>
 #include <omni/ui/ImageProvider/DynamicTextureProvider.h>
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -26,6 +33,10 @@ namespace {
 const std::string_view DEFAULT_WHITE_TEXTURE_NAME = "cesium_default_white_texture";
 const std::string_view DEFAULT_TRANSPARENT_TEXTURE_NAME = "cesium_default_transparent_texture";
 
+// Raster overlay tiles are 256x256 RGBA8 images. Only their pool starts with the configured initial capacity. Base
+// color, feature ID, and property textures come in arbitrary sizes, so their pools start empty and grow on demand.
+const auto TILE_IMAGERY_TEXTURE_DESCRIPTOR = FabricTextureDescriptor(256, 256, carb::Format::eRGBA8_SRGB);
+
 std::unique_ptr<omni::ui::DynamicTextureProvider>
 createSinglePixelTexture(const std::string_view& name, const std::array<uint8_t, 4>& bytes) {
     const auto size = carb::Uint2{1, 1};
@@ -45,6 +56,14 @@ bool shouldAcquireSharedMaterial(const FabricMaterialDescriptor& materialDescrip
 
 } // namespace
 
+size_t FabricResourceManager::SharedMaterialKeyHash::operator()(const SharedMaterialKey& key) const noexcept {
+    return static_cast<size_t>(CppUtil::hashValues(key.materialInfo, key.tilesetId));
+}
+
+size_t FabricResourceManager::SharedTextureKeyHash::operator()(const SharedTextureKey& key) const noexcept {
+    return static_cast<size_t>(CppUtil::hashValues(key.contentHash, key.textureDescriptor));
+}
+
 FabricResourceManager::FabricResourceManager(Context* pContext)
     : _pContext(pContext)
     , _defaultWhiteTexture(createSinglePixelTexture(DEFAULT_WHITE_TEXTURE_NAME, {{255, 255, 255, 255}}))
@@ -60,14 +79,14 @@ FabricResourceManager::~FabricResourceManager() = default;
 bool FabricResourceManager::shouldAcquireMaterial(
     const CesiumGltf::MeshPrimitive& primitive,
     bool hasRasterOverlay,
-    const pxr::SdfPath& tilesetMaterialPath) const {
+    const pxr::SdfPath& tilesetMaterialPath) {
     if (_disableMaterials) {
         return false;
     }
 
     if (!tilesetMaterialPath.IsEmpty()) {
-        return FabricUtil::materialHasCesiumNodes(
-            _pContext->getFabricStage(), FabricUtil::toFabricPath(tilesetMaterialPath));
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+        return _tilesetMaterialsWithCesiumNodes.find(tilesetMaterialPath) != _tilesetMaterialsWithCesiumNodes.end();
     }
 
     return hasRasterOverlay || GltfUtil::hasMaterial(primitive);
@@ -80,48 +99,61 @@ bool FabricResourceManager::getDisableTextures() const {
 std::shared_ptr<FabricGeometry> FabricResourceManager::acquireGeometry(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
-    const FabricFeaturesInfo& featuresInfo,
-    bool smoothNormals) {
+    const FabricPrimitiveInfo& primitiveInfo,
+    bool smoothNormals,
+    bool renderPointsAsVoxels) {
 
-    FabricGeometryDescriptor geometryDescriptor(model, primitive, featuresInfo, smoothNormals);
+    FabricGeometryDescriptor geometryDescriptor(model, primitive, primitiveInfo, smoothNormals, renderPointsAsVoxels);
 
     if (_disableGeometryPool) {
         const auto contextId = _pContext->getContextId();
         const auto pathStr = fmt::format("/cesium_geometry_{}_context_{}", getNextGeometryId(), contextId);
         const auto path = omni::fabric::Path(pathStr.c_str());
-        return std::make_shared<FabricGeometry>(_pContext, path, geometryDescriptor, -1);
+        auto pGeometry = std::make_shared<FabricGeometry>(_pContext, path, geometryDescriptor, -1);
+
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+        _pendingGeometries.push_back(pGeometry);
+        return pGeometry;
     }
 
     std::scoped_lock<std::mutex> lock(_poolMutex);
 
-    return acquireGeometryFromPool(geometryDescriptor);
+    auto pGeometry = acquireGeometryFromPool(geometryDescriptor);
+    _pendingGeometries.push_back(pGeometry);
+    return pGeometry;
 }
 
 std::shared_ptr<FabricMaterial> FabricResourceManager::acquireMaterial(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const FabricMaterialInfo& materialInfo,
-    const FabricFeaturesInfo& featuresInfo,
+    const FabricPrimitiveInfo& primitiveInfo,
     const FabricRasterOverlaysInfo& rasterOverlaysInfo,
     int64_t tilesetId,
     const pxr::SdfPath& tilesetMaterialPath) {
-    FabricMaterialDescriptor materialDescriptor(
-        *_pContext, model, primitive, materialInfo, featuresInfo, rasterOverlaysInfo, tilesetMaterialPath);
+    FabricMaterialDescriptor materialDescriptor(primitiveInfo, rasterOverlaysInfo, tilesetMaterialPath);
 
     if (shouldAcquireSharedMaterial(materialDescriptor)) {
-        return acquireSharedMaterial(materialInfo, materialDescriptor, tilesetId);
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+        auto pMaterial = acquireSharedMaterial(primitiveInfo.materialInfo, materialDescriptor, tilesetId);
+        _pendingMaterials.push_back(pMaterial);
+        return pMaterial;
     }
 
     if (_disableMaterialPool) {
-        return createMaterial(materialDescriptor);
+        auto pMaterial = createMaterial(materialDescriptor);
+
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+        _pendingMaterials.push_back(pMaterial);
+        return pMaterial;
     }
 
     std::scoped_lock<std::mutex> lock(_poolMutex);
 
-    return acquireMaterialFromPool(materialDescriptor);
+    auto pMaterial = acquireMaterialFromPool(materialDescriptor);
+    _pendingMaterials.push_back(pMaterial);
+    return pMaterial;
 }
 
-std::shared_ptr<FabricTexture> FabricResourceManager::acquireTexture() {
+std::shared_ptr<FabricTexture>
+FabricResourceManager::acquireTexture(const FabricTextureDescriptor& textureDescriptor) {
     if (_disableTexturePool) {
         const auto contextId = _pContext->getContextId();
         const auto name = fmt::format("/cesium_texture_{}_context_{}", getNextTextureId(), contextId);
@@ -130,7 +162,76 @@ std::shared_ptr<FabricTexture> FabricResourceManager::acquireTexture() {
 
     std::scoped_lock<std::mutex> lock(_poolMutex);
 
-    return acquireTextureFromPool();
+    auto pTexture = acquireTextureFromPool(textureDescriptor);
+
+    if (pTexture->getTextureDescriptor() == textureDescriptor) {
+        ++_texturePoolHits;
+    } else {
+        ++_texturePoolMisses;
+    }
+
+    return pTexture;
+}
+
+std::shared_ptr<FabricTexture> FabricResourceManager::acquireSharedTexture(
+    uint64_t contentHash,
+    gsl::span<const std::byte> content,
+    const FabricTextureDescriptor& textureDescriptor,
+    const std::function<void(FabricTexture& texture)>& setTexture) {
+    const auto key = SharedTextureKey{contentHash, textureDescriptor};
+
+    const auto hasSameContent = [content](const SharedTexture& sharedTexture) {
+        return std::equal(sharedTexture.content.begin(), sharedTexture.content.end(), content.begin(), content.end());
+    };
+
+    auto isHashCollision = false;
+
+    {
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+
+        const auto iter = _sharedTextures.find(key);
+        if (iter != _sharedTextures.end()) {
+            auto& sharedTexture = iter->second;
+            if (hasSameContent(sharedTexture)) {
+                ++sharedTexture.referenceCount;
+                ++_sharedTextureHits;
+                return sharedTexture.pTexture;
+            }
+
+            isHashCollision = true;
+        }
+    }
+
+    // The texture contents are written outside the lock so that other worker threads aren't blocked
+    auto pTexture = acquireTexture(textureDescriptor);
+    setTexture(*pTexture);
+
+    if (isHashCollision) {
+        // A different content already owns the cache entry. This texture isn't shared.
+        return pTexture;
+    }
+
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    // Another worker thread may have shared a texture with the same content hash in the meantime
+    const auto iter = _sharedTextures.find(key);
+    if (iter != _sharedTextures.end()) {
+        auto& sharedTexture = iter->second;
+        if (!hasSameContent(sharedTexture)) {
+            return pTexture;
+        }
+
+        releaseTextureToPool(std::move(pTexture));
+        ++sharedTexture.referenceCount;
+        ++_sharedTextureHits;
+        return sharedTexture.pTexture;
+    }
+
+    _sharedTextureKeys.emplace(pTexture.get(), key);
+    const auto inserted = _sharedTextures.emplace(
+        key, SharedTexture{std::move(pTexture), std::vector<std::byte>(content.begin(), content.end()), 1});
+
+    return inserted.first->second.pTexture;
 }
 
 void FabricResourceManager::releaseGeometry(std::shared_ptr<FabricGeometry> pGeometry) {
@@ -148,6 +249,8 @@ void FabricResourceManager::releaseGeometry(std::shared_ptr<FabricGeometry> pGeo
 }
 
 void FabricResourceManager::releaseMaterial(std::shared_ptr<FabricMaterial> pMaterial) {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
     if (isSharedMaterial(*pMaterial)) {
         releaseSharedMaterial(*pMaterial);
         return;
@@ -157,8 +260,6 @@ void FabricResourceManager::releaseMaterial(std::shared_ptr<FabricMaterial> pMat
         return;
     }
 
-    std::scoped_lock<std::mutex> lock(_poolMutex);
-
     const auto pMaterialPool = getMaterialPool(*pMaterial);
 
     if (pMaterialPool) {
@@ -167,17 +268,14 @@ void FabricResourceManager::releaseMaterial(std::shared_ptr<FabricMaterial> pMat
 }
 
 void FabricResourceManager::releaseTexture(std::shared_ptr<FabricTexture> pTexture) {
-    if (_disableTexturePool) {
-        return;
-    }
-
     std::scoped_lock<std::mutex> lock(_poolMutex);
 
-    const auto pTexturePool = getTexturePool(*pTexture);
-
-    if (pTexturePool) {
-        pTexturePool->release(std::move(pTexture));
+    if (isSharedTexture(*pTexture)) {
+        releaseSharedTexture(*pTexture);
+        return;
     }
+
+    releaseTextureToPool(std::move(pTexture));
 }
 
 void FabricResourceManager::setDisableMaterials(bool disableMaterials) {
@@ -218,15 +316,114 @@ void FabricResourceManager::setTexturePoolInitialCapacity(uint64_t texturePoolIn
     _texturePoolInitialCapacity = texturePoolInitialCapacity;
 }
 
+void FabricResourceManager::setPoolGrowthFactor(double poolGrowthFactor) {
+    assert(_geometryPools.size() == 0 && _materialPools.size() == 0 && _texturePools.size() == 0);
+    _poolGrowthFactor = poolGrowthFactor;
+}
+
+void FabricResourceManager::setPoolLowWaterMark(uint64_t poolLowWaterMark) {
+    assert(_geometryPools.size() == 0 && _materialPools.size() == 0 && _texturePools.size() == 0);
+    _poolLowWaterMark = poolLowWaterMark;
+}
+
+void FabricResourceManager::setPoolMaximumIdleTime(double poolMaximumIdleTime) {
+    assert(_geometryPools.size() == 0 && _materialPools.size() == 0 && _texturePools.size() == 0);
+    _poolMaximumIdleTime = poolMaximumIdleTime;
+}
+
 void FabricResourceManager::setDebugRandomColors(bool debugRandomColors) {
     _debugRandomColors = debugRandomColors;
 }
 
+void FabricResourceManager::addCompressedTexture(
+    uint64_t inputByteLength,
+    uint64_t outputByteLength,
+    uint64_t encodeTime) {
+    ++_texturesCompressed;
+    _textureCompressionInputBytes += inputByteLength;
+    _textureCompressionOutputBytes += outputByteLength;
+    _textureCompressionTime += encodeTime;
+}
+
+void FabricResourceManager::addGeometryPrimitives(uint64_t primitiveCount) {
+    _geometryPrimitivesLoaded += primitiveCount;
+    _geometryPrimitivesMerged += primitiveCount - 1;
+}
+
+void FabricResourceManager::removeGeometryPrimitives(uint64_t primitiveCount) {
+    _geometryPrimitivesLoaded -= primitiveCount;
+    _geometryPrimitivesMerged -= primitiveCount - 1;
+}
+
+uint64_t FabricResourceManager::getGeometryPrimitivesLoaded() const {
+    return _geometryPrimitivesLoaded;
+}
+
+uint64_t FabricResourceManager::getGeometryPrimitivesMerged() const {
+    return _geometryPrimitivesMerged;
+}
+
+uint64_t FabricResourceManager::getTexturePoolHits() const {
+    return _texturePoolHits;
+}
+
+uint64_t FabricResourceManager::getTexturePoolMisses() const {
+    return _texturePoolMisses;
+}
+
+uint64_t FabricResourceManager::getTextureBytesLoaded() const {
+    // Textures created while the texture pool is disabled aren't counted
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    uint64_t textureBytesLoaded = 0;
+
+    for (const auto& [poolId, pTexturePool] : _texturePools) {
+        textureBytesLoaded += pTexturePool->getNumberActive() * pTexturePool->getTextureDescriptor().getByteLength();
+    }
+
+    return textureBytesLoaded;
+}
+
+uint64_t FabricResourceManager::getSharedTexturesLoaded() const {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+    return _sharedTextures.size();
+}
+
+uint64_t FabricResourceManager::getSharedTextureHits() const {
+    return _sharedTextureHits;
+}
+
+uint64_t FabricResourceManager::getTexturesCompressed() const {
+    return _texturesCompressed;
+}
+
+uint64_t FabricResourceManager::getTextureCompressionInputBytes() const {
+    return _textureCompressionInputBytes;
+}
+
+uint64_t FabricResourceManager::getTextureCompressionOutputBytes() const {
+    return _textureCompressionOutputBytes;
+}
+
+uint64_t FabricResourceManager::getTextureCompressionTime() const {
+    return _textureCompressionTime;
+}
+
+FabricStatistics FabricResourceManager::getStatistics() const {
+    return _pStatisticsCounter->get();
+}
+
+const std::shared_ptr<FabricStatisticsCounter>& FabricResourceManager::getStatisticsCounter() const {
+    return _pStatisticsCounter;
+}
+
 void FabricResourceManager::updateShaderInput(
     const pxr::SdfPath& materialPath,
     const pxr::SdfPath& shaderPath,
-    const pxr::TfToken& attributeName) const {
-    for (const auto& pMaterialPool : _materialPools) {
+    const pxr::TfToken& attributeName) {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    for (const auto& [poolId, pMaterialPool] : _materialPools) {
         const auto& tilesetMaterialPath = pMaterialPool->getMaterialDescriptor().getTilesetMaterialPath();
         if (tilesetMaterialPath == materialPath) {
             pMaterialPool->updateShaderInput(shaderPath, attributeName);
@@ -234,11 +431,58 @@ void FabricResourceManager::updateShaderInput(
     }
 }
 
+void FabricResourceManager::initializePendingResources() {
+    CESIUM_TRACE("FabricResourceManager::initializePendingResources");
+
+    std::vector<std::shared_ptr<FabricGeometry>> pendingGeometries;
+    std::vector<std::shared_ptr<FabricMaterial>> pendingMaterials;
+
+    {
+        std::scoped_lock<std::mutex> lock(_poolMutex);
+        pendingGeometries.swap(_pendingGeometries);
+        pendingMaterials.swap(_pendingMaterials);
+    }
+
+    // Creating Fabric prims must happen on the main thread. Objects that were acquired before and are already
+    // initialized return early.
+    for (const auto& pGeometry : pendingGeometries) {
+        pGeometry->initialize();
+    }
+
+    for (const auto& pMaterial : pendingMaterials) {
+        pMaterial->initialize();
+    }
+}
+
+void FabricResourceManager::onUpdateFrame() {
+    initializePendingResources();
+    updateTilesetMaterials();
+    trimPools();
+}
+
 void FabricResourceManager::clear() {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    _pendingGeometries.clear();
+    _pendingMaterials.clear();
+    _tilesetMaterialsWithCesiumNodes.clear();
+    _geometryPoolsByDescriptor.clear();
+    _materialPoolsByDescriptor.clear();
+    _texturePoolsByDescriptor.clear();
     _geometryPools.clear();
     _materialPools.clear();
     _texturePools.clear();
+    _sharedMaterialKeys.clear();
     _sharedMaterials.clear();
+    _sharedTextureKeys.clear();
+    _sharedTextures.clear();
+    _texturePoolHits = 0;
+    _sharedTextureHits = 0;
+    _texturePoolMisses = 0;
+    _texturesCompressed = 0;
+    _textureCompressionInputBytes = 0;
+    _textureCompressionOutputBytes = 0;
+    _textureCompressionTime = 0;
 }
 
 std::shared_ptr<FabricMaterial>
@@ -260,126 +504,217 @@ std::shared_ptr<FabricMaterial> FabricResourceManager::acquireSharedMaterial(
     const FabricMaterialInfo& materialInfo,
     const FabricMaterialDescriptor& materialDescriptor,
     int64_t tilesetId) {
-    for (auto& sharedMaterial : _sharedMaterials) {
-        if (sharedMaterial.materialInfo == materialInfo && sharedMaterial.tilesetId == tilesetId) {
-            ++sharedMaterial.referenceCount;
-            return sharedMaterial.pMaterial;
-        }
+    auto key = SharedMaterialKey{materialInfo, tilesetId};
+
+    const auto iter = _sharedMaterials.find(key);
+    if (iter != _sharedMaterials.end()) {
+        auto& sharedMaterial = iter->second;
+        ++sharedMaterial.referenceCount;
+        return sharedMaterial.pMaterial;
     }
 
-    const auto material = createMaterial(materialDescriptor);
+    auto pMaterial = createMaterial(materialDescriptor);
+    _sharedMaterialKeys.emplace(pMaterial.get(), key);
 
-    // In C++ 20 this can be emplace_back without the {}
-    _sharedMaterials.push_back({
-        material,
-        materialInfo,
-        tilesetId,
-        1,
-    });
+    const auto inserted = _sharedMaterials.emplace(std::move(key), SharedMaterial{std::move(pMaterial), 1});
 
-    return _sharedMaterials.back().pMaterial;
+    return inserted.first->second.pMaterial;
 }
 
 void FabricResourceManager::releaseSharedMaterial(const FabricMaterial& material) {
-    CppUtil::eraseIf(_sharedMaterials, [&material](auto& sharedMaterial) {
-        if (sharedMaterial.pMaterial.get() == &material) {
-            --sharedMaterial.referenceCount;
-            if (sharedMaterial.referenceCount == 0) {
-                return true;
-            }
-        }
-        return false;
-    });
+    const auto keyIter = _sharedMaterialKeys.find(&material);
+    if (keyIter == _sharedMaterialKeys.end()) {
+        return;
+    }
+
+    const auto iter = _sharedMaterials.find(keyIter->second);
+    assert(iter != _sharedMaterials.end());
+
+    auto& sharedMaterial = iter->second;
+    --sharedMaterial.referenceCount;
+
+    if (sharedMaterial.referenceCount == 0) {
+        _sharedMaterialKeys.erase(keyIter);
+        _sharedMaterials.erase(iter);
+    }
 }
 
 bool FabricResourceManager::isSharedMaterial(const FabricMaterial& material) const {
-    for (auto& sharedMaterial : _sharedMaterials) {
-        if (sharedMaterial.pMaterial.get() == &material) {
-            return true;
-        }
+    return _sharedMaterialKeys.find(&material) != _sharedMaterialKeys.end();
+}
+
+void FabricResourceManager::releaseSharedTexture(const FabricTexture& texture) {
+    const auto keyIter = _sharedTextureKeys.find(&texture);
+    if (keyIter == _sharedTextureKeys.end()) {
+        return;
+    }
+
+    const auto iter = _sharedTextures.find(keyIter->second);
+    assert(iter != _sharedTextures.end());
+
+    auto& sharedTexture = iter->second;
+    --sharedTexture.referenceCount;
+
+    if (sharedTexture.referenceCount == 0) {
+        auto pTexture = std::move(sharedTexture.pTexture);
+        _sharedTextureKeys.erase(keyIter);
+        _sharedTextures.erase(iter);
+        releaseTextureToPool(std::move(pTexture));
     }
+}
 
-    return false;
+bool FabricResourceManager::isSharedTexture(const FabricTexture& texture) const {
+    return _sharedTextureKeys.find(&texture) != _sharedTextureKeys.end();
+}
+
+void FabricResourceManager::releaseTextureToPool(std::shared_ptr<FabricTexture> pTexture) {
+    if (_disableTexturePool) {
+        return;
+    }
+
+    const auto pTexturePool = getTexturePool(*pTexture);
+
+    if (pTexturePool) {
+        pTexturePool->release(std::move(pTexture));
+    }
 }
 
 std::shared_ptr<FabricGeometry>
 FabricResourceManager::acquireGeometryFromPool(const FabricGeometryDescriptor& geometryDescriptor) {
-    for (const auto& pGeometryPool : _geometryPools) {
-        if (geometryDescriptor == pGeometryPool->getGeometryDescriptor()) {
-            // Found a pool with the same geometry descriptor
-            return pGeometryPool->acquire();
-        }
+    const auto iter = _geometryPoolsByDescriptor.find(geometryDescriptor);
+    if (iter != _geometryPoolsByDescriptor.end()) {
+        // Found a pool with the same geometry descriptor
+        return iter->second->acquire();
     }
 
-    auto pGeometryPool = std::make_unique<FabricGeometryPool>(
-        _pContext, getNextGeometryPoolId(), geometryDescriptor, _geometryPoolInitialCapacity);
+    const auto poolId = getNextGeometryPoolId();
+    auto pGeometryPool =
+        std::make_unique<FabricGeometryPool>(_pContext, poolId, geometryDescriptor, _geometryPoolInitialCapacity);
+
+    initializePool(*pGeometryPool);
 
-    _geometryPools.push_back(std::move(pGeometryPool));
+    const auto pGeometryPoolRaw = pGeometryPool.get();
+    _geometryPools.emplace(poolId, std::move(pGeometryPool));
+    _geometryPoolsByDescriptor.emplace(geometryDescriptor, pGeometryPoolRaw);
 
-    return _geometryPools.back()->acquire();
+    return pGeometryPoolRaw->acquire();
 }
 
 std::shared_ptr<FabricMaterial>
 FabricResourceManager::acquireMaterialFromPool(const FabricMaterialDescriptor& materialDescriptor) {
-    for (const auto& pMaterialPool : _materialPools) {
-        if (materialDescriptor == pMaterialPool->getMaterialDescriptor()) {
-            // Found a pool with the same material descriptor
-            return pMaterialPool->acquire();
-        }
+    const auto iter = _materialPoolsByDescriptor.find(materialDescriptor);
+    if (iter != _materialPoolsByDescriptor.end()) {
+        // Found a pool with the same material descriptor
+        return iter->second->acquire();
     }
 
+    const auto poolId = getNextMaterialPoolId();
     auto pMaterialPool = std::make_unique<FabricMaterialPool>(
         _pContext,
-        getNextMaterialPoolId(),
+        poolId,
         materialDescriptor,
         _materialPoolInitialCapacity,
         _defaultWhiteTextureAssetPathToken,
         _defaultTransparentTextureAssetPathToken,
         _debugRandomColors);
 
-    _materialPools.push_back(std::move(pMaterialPool));
+    initializePool(*pMaterialPool);
+
+    const auto pMaterialPoolRaw = pMaterialPool.get();
+    _materialPools.emplace(poolId, std::move(pMaterialPool));
+    _materialPoolsByDescriptor.emplace(materialDescriptor, pMaterialPoolRaw);
 
-    return _materialPools.back()->acquire();
+    return pMaterialPoolRaw->acquire();
 }
 
-std::shared_ptr<FabricTexture> FabricResourceManager::acquireTextureFromPool() {
-    if (!_texturePools.empty()) {
-        return _texturePools.front()->acquire();
+std::shared_ptr<FabricTexture>
+FabricResourceManager::acquireTextureFromPool(const FabricTextureDescriptor& textureDescriptor) {
+    const auto iter = _texturePoolsByDescriptor.find(textureDescriptor);
+    if (iter != _texturePoolsByDescriptor.end()) {
+        // Found a pool with the same texture descriptor
+        return iter->second->acquire();
     }
 
-    auto pTexturePool =
-        std::make_unique<FabricTexturePool>(_pContext, getNextTexturePoolId(), _texturePoolInitialCapacity);
+    const auto poolId = getNextTexturePoolId();
+    const auto initialCapacity =
+        textureDescriptor == TILE_IMAGERY_TEXTURE_DESCRIPTOR ? _texturePoolInitialCapacity : uint64_t(0);
+    auto pTexturePool = std::make_unique<FabricTexturePool>(_pContext, poolId, textureDescriptor, initialCapacity);
+
+    initializePool(*pTexturePool);
 
-    _texturePools.push_back(std::move(pTexturePool));
+    const auto pTexturePoolRaw = pTexturePool.get();
+    _texturePools.emplace(poolId, std::move(pTexturePool));
+    _texturePoolsByDescriptor.emplace(textureDescriptor, pTexturePoolRaw);
 
-    return _texturePools.back()->acquire();
+    return pTexturePoolRaw->acquire();
 }
 
-FabricGeometryPool* FabricResourceManager::getGeometryPool(const FabricGeometry& geometry) const {
-    for (const auto& pGeometryPool : _geometryPools) {
-        if (pGeometryPool->getPoolId() == geometry.getPoolId()) {
-            return pGeometryPool.get();
+template <typename T> void FabricResourceManager::initializePool(ObjectPool<T>& pool) const {
+    pool.setGrowthFactor(_poolGrowthFactor);
+    pool.setLowWaterMark(_poolLowWaterMark);
+    pool.setMaximumIdleTime(_poolMaximumIdleTime);
+}
+
+void FabricResourceManager::updateTilesetMaterials() {
+    // Reading the material network every frame is simple and reacts to material edits without subscribing to
+    // change events. The number of tilesets with materials is expected to be small.
+    std::unordered_set<pxr::SdfPath, pxr::SdfPath::Hash> tilesetMaterialsWithCesiumNodes;
+
+    for (const auto& pTileset : _pContext->getAssetRegistry().getTilesets()) {
+        const auto& tilesetMaterialPath = pTileset->getSettings()->materialPath;
+        if (!tilesetMaterialPath.IsEmpty() &&
+            FabricUtil::materialHasCesiumNodes(
+                _pContext->getFabricStage(), FabricUtil::toFabricPath(tilesetMaterialPath))) {
+            tilesetMaterialsWithCesiumNodes.insert(tilesetMaterialPath);
         }
     }
 
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+    _tilesetMaterialsWithCesiumNodes.swap(tilesetMaterialsWithCesiumNodes);
+}
+
+void FabricResourceManager::trimPools() {
+    if (_poolMaximumIdleTime <= 0.0) {
+        return;
+    }
+
+    // Trimming destroys Fabric prims so it must happen on the main thread
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    for (const auto& [poolId, pGeometryPool] : _geometryPools) {
+        pGeometryPool->trim();
+    }
+
+    for (const auto& [poolId, pTexturePool] : _texturePools) {
+        pTexturePool->trim();
+    }
+
+    // Material pools are not trimmed because FabricMaterial doesn't destroy its Fabric prims yet.
+    // See https://github.com/CesiumGS/cesium-omniverse/issues/444 for details.
+}
+
+FabricGeometryPool* FabricResourceManager::getGeometryPool(const FabricGeometry& geometry) const {
+    const auto iter = _geometryPools.find(geometry.getPoolId());
+    if (iter != _geometryPools.end()) {
+        return iter->second.get();
+    }
+
     return nullptr;
 }
 
 FabricMaterialPool* FabricResourceManager::getMaterialPool(const FabricMaterial& material) const {
-    for (const auto& pMaterialPool : _materialPools) {
-        if (pMaterialPool->getPoolId() == material.getPoolId()) {
-            return pMaterialPool.get();
-        }
+    const auto iter = _materialPools.find(material.getPoolId());
+    if (iter != _materialPools.end()) {
+        return iter->second.get();
     }
 
     return nullptr;
 }
 
 FabricTexturePool* FabricResourceManager::getTexturePool(const FabricTexture& texture) const {
-    for (const auto& pTexturePool : _texturePools) {
-        if (pTexturePool->getPoolId() == texture.getPoolId()) {
-            return pTexturePool.get();
-        }
+    const auto iter = _texturePools.find(texture.getPoolId());
+    if (iter != _texturePools.end()) {
+        return iter->second.get();
     }
 
     return nullptr;
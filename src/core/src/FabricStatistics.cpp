@@ -0,0 +1,38 @@
+#include "cesium/omniverse/FabricStatistics.h"
+
+namespace cesium::omniverse {
+
+bool FabricStatistics::operator==(const FabricStatistics& other) const {
+    return materialsCapacity == other.materialsCapacity && materialsLoaded == other.materialsLoaded &&
+           geometriesCapacity == other.geometriesCapacity && geometriesLoaded == other.geometriesLoaded &&
+           geometriesRendered == other.geometriesRendered && trianglesLoaded == other.trianglesLoaded &&
+           trianglesRendered == other.trianglesRendered && pointsLoaded == other.pointsLoaded &&
+           pointsRendered == other.pointsRendered && geometryBytesLoaded == other.geometryBytesLoaded;
+}
+
+bool FabricStatistics::operator!=(const FabricStatistics& other) const {
+    return !(*this == other);
+}
+
+void FabricStatisticsCounter::update(const FabricStatistics& previous, const FabricStatistics& current) {
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    // Unsigned arithmetic is modular so adding the difference is exact even when a contribution shrinks
+    _statistics.materialsCapacity += current.materialsCapacity - previous.materialsCapacity;
+    _statistics.materialsLoaded += current.materialsLoaded - previous.materialsLoaded;
+    _statistics.geometriesCapacity += current.geometriesCapacity - previous.geometriesCapacity;
+    _statistics.geometriesLoaded += current.geometriesLoaded - previous.geometriesLoaded;
+    _statistics.geometriesRendered += current.geometriesRendered - previous.geometriesRendered;
+    _statistics.trianglesLoaded += current.trianglesLoaded - previous.trianglesLoaded;
+    _statistics.trianglesRendered += current.trianglesRendered - previous.trianglesRendered;
+    _statistics.pointsLoaded += current.pointsLoaded - previous.pointsLoaded;
+    _statistics.pointsRendered += current.pointsRendered - previous.pointsRendered;
+    _statistics.geometryBytesLoaded += current.geometryBytesLoaded - previous.geometryBytesLoaded;
+}
+
+FabricStatistics FabricStatisticsCounter::get() const {
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _statistics;
+}
+
+} // namespace cesium::omniverse
@@ -0,0 +1,216 @@
+#include "cesium/omniverse/FabricTextureDescriptor.h"
+
+#include "cesium/omniverse/CppUtil.h"
+
+#include <CesiumGltf/ImageCesium.h>
+
+namespace cesium::omniverse {
+
+namespace {
+
+carb::Format
+getCompressedImageFormat(CesiumGltf::GpuCompressedPixelFormat pixelFormat, TransferFunction transferFunction) {
+    switch (pixelFormat) {
+        case CesiumGltf::GpuCompressedPixelFormat::BC1_RGB:
+            switch (transferFunction) {
+                case TransferFunction::LINEAR:
+                    return carb::Format::eBC1_RGBA_UNORM;
+                case TransferFunction::SRGB:
+                    return carb::Format::eBC1_RGBA_SRGB;
+            }
+            return carb::Format::eUnknown;
+        case CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA:
+            switch (transferFunction) {
+                case TransferFunction::LINEAR:
+                    return carb::Format::eBC3_RGBA_UNORM;
+                case TransferFunction::SRGB:
+                    return carb::Format::eBC3_RGBA_SRGB;
+            }
+            return carb::Format::eUnknown;
+        case CesiumGltf::GpuCompressedPixelFormat::BC4_R:
+            return carb::Format::eBC4_R_UNORM;
+        case CesiumGltf::GpuCompressedPixelFormat::BC5_RG:
+            return carb::Format::eBC5_RG_UNORM;
+        case CesiumGltf::GpuCompressedPixelFormat::BC7_RGBA:
+            switch (transferFunction) {
+                case TransferFunction::LINEAR:
+                    return carb::Format::eBC7_RGBA_UNORM;
+                case TransferFunction::SRGB:
+                    return carb::Format::eBC7_RGBA_SRGB;
+            }
+            return carb::Format::eUnknown;
+        default:
+            // Unsupported compressed texture format.
+            return carb::Format::eUnknown;
+    }
+}
+
+carb::Format
+getUncompressedImageFormat(uint64_t channels, uint64_t bytesPerChannel, TransferFunction transferFunction) {
+    switch (channels) {
+        case 1:
+            switch (bytesPerChannel) {
+                case 1:
+                    return carb::Format::eR8_UNORM;
+                case 2:
+                    return carb::Format::eR16_UNORM;
+            }
+            break;
+        case 2:
+            switch (bytesPerChannel) {
+                case 1:
+                    return carb::Format::eRG8_UNORM;
+                case 2:
+                    return carb::Format::eRG16_UNORM;
+            }
+            break;
+        case 4:
+            switch (bytesPerChannel) {
+                case 1:
+                    switch (transferFunction) {
+                        case TransferFunction::LINEAR:
+                            return carb::Format::eRGBA8_UNORM;
+                        case TransferFunction::SRGB:
+                            return carb::Format::eRGBA8_SRGB;
+                    }
+                    break;
+                case 2:
+                    return carb::Format::eRGBA16_UNORM;
+            }
+            break;
+    }
+
+    return carb::Format::eUnknown;
+}
+
+carb::Format getImageFormat(const CesiumGltf::ImageCesium& image, TransferFunction transferFunction) {
+    if (image.compressedPixelFormat != CesiumGltf::GpuCompressedPixelFormat::NONE) {
+        return getCompressedImageFormat(image.compressedPixelFormat, transferFunction);
+    }
+
+    return getUncompressedImageFormat(
+        static_cast<uint64_t>(image.channels), static_cast<uint64_t>(image.bytesPerChannel), transferFunction);
+}
+
+// Block compressed formats are stored in 4x4 blocks. Uncompressed formats are treated as 1x1 blocks.
+uint64_t getBlockByteLength(carb::Format format) {
+    switch (format) {
+        case carb::Format::eBC1_RGBA_UNORM:
+        case carb::Format::eBC1_RGBA_SRGB:
+        case carb::Format::eBC4_R_UNORM:
+            return 8;
+        case carb::Format::eBC3_RGBA_UNORM:
+        case carb::Format::eBC3_RGBA_SRGB:
+        case carb::Format::eBC5_RG_UNORM:
+        case carb::Format::eBC7_RGBA_UNORM:
+        case carb::Format::eBC7_RGBA_SRGB:
+            return 16;
+        case carb::Format::eR8_UNORM:
+        case carb::Format::eR8_UINT:
+        case carb::Format::eR8_SINT:
+            return 1;
+        case carb::Format::eR16_UNORM:
+        case carb::Format::eR16_UINT:
+        case carb::Format::eR16_SINT:
+        case carb::Format::eRG8_UNORM:
+        case carb::Format::eRG8_UINT:
+        case carb::Format::eRG8_SINT:
+            return 2;
+        case carb::Format::eR32_UINT:
+        case carb::Format::eR32_SINT:
+        case carb::Format::eR32_SFLOAT:
+        case carb::Format::eRG16_UNORM:
+        case carb::Format::eRG16_UINT:
+        case carb::Format::eRG16_SINT:
+        case carb::Format::eRGBA8_UNORM:
+        case carb::Format::eRGBA8_SRGB:
+        case carb::Format::eRGBA8_UINT:
+        case carb::Format::eRGBA8_SINT:
+            return 4;
+        case carb::Format::eRG32_UINT:
+        case carb::Format::eRG32_SINT:
+        case carb::Format::eRG32_SFLOAT:
+        case carb::Format::eRGBA16_UNORM:
+        case carb::Format::eRGBA16_UINT:
+        case carb::Format::eRGBA16_SINT:
+            return 8;
+        case carb::Format::eRGB32_UINT:
+        case carb::Format::eRGB32_SINT:
+        case carb::Format::eRGB32_SFLOAT:
+            return 12;
+        case carb::Format::eRGBA32_UINT:
+        case carb::Format::eRGBA32_SINT:
+        case carb::Format::eRGBA32_SFLOAT:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool isBlockCompressed(carb::Format format) {
+    switch (format) {
+        case carb::Format::eBC1_RGBA_UNORM:
+        case carb::Format::eBC1_RGBA_SRGB:
+        case carb::Format::eBC3_RGBA_UNORM:
+        case carb::Format::eBC3_RGBA_SRGB:
+        case carb::Format::eBC4_R_UNORM:
+        case carb::Format::eBC5_RG_UNORM:
+        case carb::Format::eBC7_RGBA_UNORM:
+        case carb::Format::eBC7_RGBA_SRGB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+FabricTextureDescriptor::FabricTextureDescriptor(uint64_t width, uint64_t height, carb::Format format)
+    : _width(width)
+    , _height(height)
+    , _format(format) {}
+
+FabricTextureDescriptor::FabricTextureDescriptor(
+    const CesiumGltf::ImageCesium& image,
+    TransferFunction transferFunction)
+    : _width(static_cast<uint64_t>(image.width))
+    , _height(static_cast<uint64_t>(image.height))
+    , _format(getImageFormat(image, transferFunction)) {}
+
+uint64_t FabricTextureDescriptor::getWidth() const {
+    return _width;
+}
+
+uint64_t FabricTextureDescriptor::getHeight() const {
+    return _height;
+}
+
+carb::Format FabricTextureDescriptor::getFormat() const {
+    return _format;
+}
+
+uint64_t FabricTextureDescriptor::getByteLength() const {
+    if (isBlockCompressed(_format)) {
+        const auto blockCountX = (_width + 3) / 4;
+        const auto blockCountY = (_height + 3) / 4;
+        return blockCountX * blockCountY * getBlockByteLength(_format);
+    }
+
+    return _width * _height * getBlockByteLength(_format);
+}
+
+bool FabricTextureDescriptor::operator==(const FabricTextureDescriptor& other) const {
+    return _width == other._width && _height == other._height && _format == other._format;
+}
+
+} // namespace cesium::omniverse
+
+size_t std::hash<cesium::omniverse::FabricTextureDescriptor>::operator()(
+    const cesium::omniverse::FabricTextureDescriptor& textureDescriptor) const noexcept {
+    using namespace cesium::omniverse;
+
+    const auto seed = CppUtil::hashValues(
+        textureDescriptor.getWidth(), textureDescriptor.getHeight(), textureDescriptor.getFormat());
+
+    return static_cast<size_t>(seed);
+}
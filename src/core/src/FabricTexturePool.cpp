@@ -6,13 +6,22 @@
 
 namespace cesium::omniverse {
 
-FabricTexturePool::FabricTexturePool(Context* pContext, int64_t poolId, uint64_t initialCapacity)
+FabricTexturePool::FabricTexturePool(
+    Context* pContext,
+    int64_t poolId,
+    const FabricTextureDescriptor& textureDescriptor,
+    uint64_t initialCapacity)
     : ObjectPool<FabricTexture>()
     , _pContext(pContext)
-    , _poolId(poolId) {
+    , _poolId(poolId)
+    , _textureDescriptor(textureDescriptor) {
     setCapacity(initialCapacity);
 }
 
+const FabricTextureDescriptor& FabricTexturePool::getTextureDescriptor() const {
+    return _textureDescriptor;
+}
+
 int64_t FabricTexturePool::getPoolId() const {
     return _poolId;
 }
@@ -23,8 +32,11 @@ std::shared_ptr<FabricTexture> FabricTexturePool::createObject(uint64_t objectId
     return std::make_shared<FabricTexture>(_pContext, name, _poolId);
 }
 
-void FabricTexturePool::setActive(FabricTexture* pTexture, bool active) const {
-    pTexture->setActive(active);
+void FabricTexturePool::setActive(
+    [[maybe_unused]] FabricTexture* pTexture,
+    [[maybe_unused]] bool active) const {
+    // Released textures keep their pixel data. Every texture in the pool has the same resolution and format
+    // so the next acquire can overwrite the data without reallocating the backing storage.
 }
 
 }; // namespace cesium::omniverse
@@ -15,9 +15,13 @@
 #include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
+#include <pxr/base/work/loops.h>
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
+#include <array>
 #include <sstream>
+#include <unordered_set>
 
 namespace cesium::omniverse::FabricUtil {
 
@@ -26,6 +30,15 @@ namespace {
 const std::string_view NO_DATA_STRING = "[No Data]";
 const std::string_view TYPE_NOT_SUPPORTED_STRING = "[Type Not Supported]";
 
+// Number of prims processed by a single work item in setTilesetTransform
+const uint64_t TILESET_TRANSFORM_GRAIN_SIZE = 1024;
+
+// Number of prims converted between Fabric and glm types at a time in setTilesetTransform
+const uint64_t TILESET_TRANSFORM_BATCH_SIZE = 64;
+
+// Below this many changes, path-based writes are cheaper than scanning the tileset's buckets in setVisibility
+const uint64_t VISIBILITY_BATCH_THRESHOLD = 32;
+
 // Wraps the token type so that we can define a custom stream insertion operator
 class TokenWrapper {
   private:
@@ -414,6 +427,126 @@ std::string printAttributeValue(
     return std::string(TYPE_NOT_SUPPORTED_STRING);
 }
 
+uint64_t getBaseDataTypeSize(omni::fabric::BaseDataType baseDataType) {
+    switch (baseDataType) {
+        case omni::fabric::BaseDataType::eBool:
+        case omni::fabric::BaseDataType::eUChar:
+            return 1;
+        case omni::fabric::BaseDataType::eHalf:
+            return 2;
+        case omni::fabric::BaseDataType::eInt:
+        case omni::fabric::BaseDataType::eUInt:
+        case omni::fabric::BaseDataType::eFloat:
+            return 4;
+        case omni::fabric::BaseDataType::eInt64:
+        case omni::fabric::BaseDataType::eUInt64:
+        case omni::fabric::BaseDataType::eDouble:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+void getGeometryStatistics(
+    omni::fabric::StageReaderWriter& fabricStage,
+    const omni::fabric::PrimBucketList& buckets,
+    bool isPointCloud,
+    FabricStatistics& statistics) {
+    for (uint64_t bucketId = 0; bucketId < buckets.bucketCount(); ++bucketId) {
+        const auto paths = fabricStage.getPathArray(buckets, bucketId);
+
+        statistics.geometriesCapacity += paths.size();
+
+        for (const auto& path : paths) {
+            const auto worldVisibilityFabric = fabricStage.getAttributeRd<bool>(path, FabricTokens::_worldVisibility);
+            const auto tilesetIdFabric = fabricStage.getAttributeRd<int64_t>(path, FabricTokens::_cesium_tilesetId);
+
+            assert(worldVisibilityFabric);
+            assert(tilesetIdFabric);
+
+            if (*tilesetIdFabric == NO_TILESET_ID) {
+                continue;
+            }
+
+            ++statistics.geometriesLoaded;
+            statistics.geometryBytesLoaded += getArrayAttributesByteSize(fabricStage, path);
+
+            if (isPointCloud) {
+                const auto pointCount = fabricStage.getArrayAttributeSize(path, FabricTokens::points);
+                statistics.pointsLoaded += pointCount;
+
+                if (*worldVisibilityFabric) {
+                    ++statistics.geometriesRendered;
+                    statistics.pointsRendered += pointCount;
+                }
+            } else {
+                const auto triangleCount = fabricStage.getArrayAttributeSize(path, FabricTokens::faceVertexCounts);
+                statistics.trianglesLoaded += triangleCount;
+
+                if (*worldVisibilityFabric) {
+                    ++statistics.geometriesRendered;
+                    statistics.trianglesRendered += triangleCount;
+                }
+            }
+        }
+    }
+}
+
+struct TilesetTransformBucket {
+    gsl::span<const pxr::GfMatrix4d> gltfLocalToEcefTransformFabric;
+    gsl::span<const pxr::GfRange3d> extentFabric;
+    gsl::span<pxr::GfVec3d> worldPositionFabric;
+    gsl::span<pxr::GfQuatf> worldOrientationFabric;
+    gsl::span<pxr::GfVec3f> worldScaleFabric;
+    gsl::span<pxr::GfRange3d> worldExtentFabric;
+};
+
+struct TilesetTransformWorkItem {
+    uint64_t bucketIndex;
+    uint64_t begin;
+    uint64_t end;
+};
+
+void setTilesetTransformRange(
+    const TilesetTransformBucket& bucket,
+    const glm::dmat4& ecefToPrimWorldTransform,
+    uint64_t begin,
+    uint64_t end) {
+    std::array<glm::dmat4, TILESET_TRANSFORM_BATCH_SIZE> gltfLocalToEcefTransforms;
+    std::array<std::array<glm::dvec3, 2>, TILESET_TRANSFORM_BATCH_SIZE> gltfLocalExtents;
+    std::array<glm::dvec3, TILESET_TRANSFORM_BATCH_SIZE> worldPositions;
+    std::array<glm::fquat, TILESET_TRANSFORM_BATCH_SIZE> worldOrientations;
+    std::array<glm::fvec3, TILESET_TRANSFORM_BATCH_SIZE> worldScales;
+    std::array<std::array<glm::dvec3, 2>, TILESET_TRANSFORM_BATCH_SIZE> worldExtents;
+
+    for (auto batchBegin = begin; batchBegin < end; batchBegin += TILESET_TRANSFORM_BATCH_SIZE) {
+        const auto batchSize = std::min(TILESET_TRANSFORM_BATCH_SIZE, end - batchBegin);
+
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            const auto fabricIndex = batchBegin + i;
+            gltfLocalToEcefTransforms[i] = UsdUtil::usdToGlmMatrix(bucket.gltfLocalToEcefTransformFabric[fabricIndex]);
+            gltfLocalExtents[i] = UsdUtil::usdToGlmExtent(bucket.extentFabric[fabricIndex]);
+        }
+
+        MathUtil::computeWorldTransforms(
+            ecefToPrimWorldTransform,
+            gsl::span<const glm::dmat4>(gltfLocalToEcefTransforms.data(), batchSize),
+            gsl::span<const std::array<glm::dvec3, 2>>(gltfLocalExtents.data(), batchSize),
+            gsl::span<glm::dvec3>(worldPositions.data(), batchSize),
+            gsl::span<glm::fquat>(worldOrientations.data(), batchSize),
+            gsl::span<glm::fvec3>(worldScales.data(), batchSize),
+            gsl::span<std::array<glm::dvec3, 2>>(worldExtents.data(), batchSize));
+
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            const auto fabricIndex = batchBegin + i;
+            bucket.worldPositionFabric[fabricIndex] = UsdUtil::glmToUsdVector(worldPositions[i]);
+            bucket.worldOrientationFabric[fabricIndex] = UsdUtil::glmToUsdQuat(worldOrientations[i]);
+            bucket.worldScaleFabric[fabricIndex] = UsdUtil::glmToUsdVector(worldScales[i]);
+            bucket.worldExtentFabric[fabricIndex] = UsdUtil::glmToUsdExtent(worldExtents[i]);
+        }
+    }
+}
+
 } // namespace
 
 std::string printFabricStage(omni::fabric::StageReaderWriter& fabricStage) {
@@ -458,43 +591,20 @@ std::string printFabricStage(omni::fabric::StageReaderWriter& fabricStage) {
 FabricStatistics getStatistics(omni::fabric::StageReaderWriter& fabricStage) {
     FabricStatistics statistics;
 
-    const auto geometryBuckets = fabricStage.findPrims(
+    const auto meshBuckets = fabricStage.findPrims(
         {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
         {omni::fabric::AttrNameAndType(FabricTypes::Mesh, FabricTokens::Mesh)});
 
+    const auto pointsBuckets = fabricStage.findPrims(
+        {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
+        {omni::fabric::AttrNameAndType(FabricTypes::Points, FabricTokens::Points)});
+
     const auto materialBuckets = fabricStage.findPrims(
         {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
         {omni::fabric::AttrNameAndType(FabricTypes::Material, FabricTokens::Material)});
 
-    for (uint64_t bucketId = 0; bucketId < geometryBuckets.bucketCount(); ++bucketId) {
-        const auto paths = fabricStage.getPathArray(geometryBuckets, bucketId);
-
-        statistics.geometriesCapacity += paths.size();
-
-        for (const auto& path : paths) {
-            const auto worldVisibilityFabric = fabricStage.getAttributeRd<bool>(path, FabricTokens::_worldVisibility);
-            const auto faceVertexCountsFabric =
-                fabricStage.getArrayAttributeRd<int>(path, FabricTokens::faceVertexCounts);
-            const auto tilesetIdFabric = fabricStage.getAttributeRd<int64_t>(path, FabricTokens::_cesium_tilesetId);
-
-            assert(worldVisibilityFabric);
-            assert(tilesetIdFabric);
-
-            if (*tilesetIdFabric == NO_TILESET_ID) {
-                continue;
-            }
-
-            ++statistics.geometriesLoaded;
-
-            const auto triangleCount = faceVertexCountsFabric.size();
-            statistics.trianglesLoaded += triangleCount;
-
-            if (*worldVisibilityFabric) {
-                ++statistics.geometriesRendered;
-                statistics.trianglesRendered += triangleCount;
-            }
-        }
-    }
+    getGeometryStatistics(fabricStage, meshBuckets, false, statistics);
+    getGeometryStatistics(fabricStage, pointsBuckets, true, statistics);
 
     for (uint64_t bucketId = 0; bucketId < materialBuckets.bucketCount(); ++bucketId) {
         auto paths = fabricStage.getPathArray(materialBuckets, bucketId);
@@ -516,6 +626,28 @@ FabricStatistics getStatistics(omni::fabric::StageReaderWriter& fabricStage) {
     return statistics;
 }
 
+uint64_t getArrayAttributesByteSize(omni::fabric::StageReaderWriter& fabricStage, const omni::fabric::Path& path) {
+    // Sums the size of the numeric array attributes (points, indices, primvars, etc.) which make up the bulk of a
+    // geometry's memory
+    uint64_t byteSize = 0;
+
+    const auto attributes = fabricStage.getAttributeNamesAndTypes(path);
+    const auto& names = attributes.first;
+    const auto& types = attributes.second;
+
+    for (uint64_t i = 0; i < names.size(); ++i) {
+        const auto& type = types[i];
+        if (type.arrayDepth != 1) {
+            continue;
+        }
+
+        const auto elementSize = getBaseDataTypeSize(type.baseType) * type.componentCount;
+        byteSize += fabricStage.getArrayAttributeSize(path, names[i]) * elementSize;
+    }
+
+    return byteSize;
+}
+
 void destroyPrim(omni::fabric::StageReaderWriter& fabricStage, const omni::fabric::Path& path) {
     fabricStage.destroyPrim(path);
 
@@ -539,14 +671,24 @@ void setTilesetTransform(
     omni::fabric::StageReaderWriter& fabricStage,
     int64_t tilesetId,
     const glm::dmat4& ecefToPrimWorldTransform) {
+    if (tilesetId == NO_TILESET_ID) {
+        return;
+    }
+
+    // Only the buckets tagged with this tileset are visited. See FabricGeometry::setTilesetTag.
     const auto buckets = fabricStage.findPrims(
-        {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
+        {omni::fabric::AttrNameAndType(
+            FabricTypes::_cesium_tileset, FabricTokens::_cesium_tileset_n(static_cast<uint64_t>(tilesetId)))},
         {omni::fabric::AttrNameAndType(
             FabricTypes::_cesium_gltfLocalToEcefTransform, FabricTokens::_cesium_gltfLocalToEcefTransform)});
 
+    // Fabric arrays are acquired on the calling thread. Only the math runs in parallel.
+    std::vector<TilesetTransformBucket> tilesetTransformBuckets;
+    std::vector<TilesetTransformWorkItem> workItems;
+    tilesetTransformBuckets.reserve(buckets.bucketCount());
+
     for (uint64_t bucketId = 0; bucketId < buckets.bucketCount(); ++bucketId) {
         // clang-format off
-        const auto tilesetIdFabric = fabricStage.getAttributeArrayRd<int64_t>(buckets, bucketId, FabricTokens::_cesium_tilesetId);
         const auto gltfLocalToEcefTransformFabric = fabricStage.getAttributeArrayRd<pxr::GfMatrix4d>(buckets, bucketId, FabricTokens::_cesium_gltfLocalToEcefTransform);
         const auto extentFabric = fabricStage.getAttributeArrayRd<pxr::GfRange3d>(buckets, bucketId, FabricTokens::extent);
         const auto worldPositionFabric = fabricStage.getAttributeArrayWr<pxr::GfVec3d>(buckets, bucketId, FabricTokens::_worldPosition);
@@ -555,21 +697,91 @@ void setTilesetTransform(
         const auto worldExtentFabric = fabricStage.getAttributeArrayWr<pxr::GfRange3d>(buckets, bucketId, FabricTokens::_worldExtent);
         // clang-format on
 
-        for (uint64_t i = 0; i < tilesetIdFabric.size(); ++i) {
-            if (tilesetIdFabric[i] == tilesetId) {
-                const auto gltfLocalToEcefTransform = UsdUtil::usdToGlmMatrix(gltfLocalToEcefTransformFabric[i]);
-                const auto gltfLocalToPrimWorldTransform = ecefToPrimWorldTransform * gltfLocalToEcefTransform;
-                const auto gltfLocalExtent = UsdUtil::usdToGlmExtent(extentFabric[i]);
-                const auto [primWorldPosition, primWorldOrientation, primWorldScale] =
-                    MathUtil::decompose(gltfLocalToPrimWorldTransform);
-                const auto primWorldExtent = MathUtil::transformExtent(gltfLocalExtent, gltfLocalToPrimWorldTransform);
-
-                worldPositionFabric[i] = UsdUtil::glmToUsdVector(primWorldPosition);
-                worldOrientationFabric[i] = UsdUtil::glmToUsdQuat(glm::fquat(primWorldOrientation));
-                worldScaleFabric[i] = UsdUtil::glmToUsdVector(glm::fvec3(primWorldScale));
-                worldExtentFabric[i] = UsdUtil::glmToUsdExtent(primWorldExtent);
+        const auto bucketIndex = tilesetTransformBuckets.size();
+        const auto primCount = gltfLocalToEcefTransformFabric.size();
+
+        tilesetTransformBuckets.push_back(
+            {gltfLocalToEcefTransformFabric,
+             extentFabric,
+             worldPositionFabric,
+             worldOrientationFabric,
+             worldScaleFabric,
+             worldExtentFabric});
+
+        // Large buckets are split so that a single bucket can still use every worker thread
+        for (uint64_t begin = 0; begin < primCount; begin += TILESET_TRANSFORM_GRAIN_SIZE) {
+            workItems.push_back({bucketIndex, begin, std::min(begin + TILESET_TRANSFORM_GRAIN_SIZE, primCount)});
+        }
+    }
+
+    pxr::WorkParallelForN(workItems.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            const auto& workItem = workItems[i];
+            setTilesetTransformRange(
+                tilesetTransformBuckets[workItem.bucketIndex],
+                ecefToPrimWorldTransform,
+                workItem.begin,
+                workItem.end);
+        }
+    });
+}
+
+void setVisibility(
+    omni::fabric::StageReaderWriter& fabricStage,
+    int64_t tilesetId,
+    const std::vector<omni::fabric::Path>& paths,
+    bool visible) {
+    if (paths.empty()) {
+        return;
+    }
+
+    const auto batched = tilesetId != NO_TILESET_ID && paths.size() >= VISIBILITY_BATCH_THRESHOLD;
+    std::unordered_set<uint64_t> remainingPaths;
+
+    if (batched) {
+        remainingPaths.reserve(paths.size());
+        for (const auto& path : paths) {
+            remainingPaths.insert(path.asPathC().path);
+        }
+
+        // Write the changes bucket by bucket. A bucket's visibility array is only acquired if one of its prims changed.
+        const auto buckets = fabricStage.findPrims(
+            {omni::fabric::AttrNameAndType(
+                FabricTypes::_cesium_tileset, FabricTokens::_cesium_tileset_n(static_cast<uint64_t>(tilesetId)))},
+            {omni::fabric::AttrNameAndType(FabricTypes::_worldVisibility, FabricTokens::_worldVisibility)});
+
+        for (uint64_t bucketId = 0; bucketId < buckets.bucketCount() && !remainingPaths.empty(); ++bucketId) {
+            const auto primPaths = fabricStage.getPathArray(buckets, bucketId);
+            gsl::span<bool> worldVisibilityFabric;
+
+            for (uint64_t i = 0; i < primPaths.size(); ++i) {
+                if (remainingPaths.erase(primPaths[i].asPathC().path) == 0) {
+                    continue;
+                }
+
+                if (worldVisibilityFabric.empty()) {
+                    worldVisibilityFabric =
+                        fabricStage.getAttributeArrayWr<bool>(buckets, bucketId, FabricTokens::_worldVisibility);
+                }
+
+                worldVisibilityFabric[i] = visible;
             }
         }
+
+        if (remainingPaths.empty()) {
+            return;
+        }
+    }
+
+    // Small changes are written individually. So are prims whose geometry hasn't been committed yet since they aren't
+    // tagged with the tileset.
+    for (const auto& path : paths) {
+        if (batched && remainingPaths.count(path.asPathC().path) == 0) {
+            continue;
+        }
+
+        const auto worldVisibilityFabric = fabricStage.getAttributeWr<bool>(path, FabricTokens::_worldVisibility);
+        *worldVisibilityFabric = visible;
     }
 }
 
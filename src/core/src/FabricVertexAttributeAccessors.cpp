@@ -1,5 +1,7 @@
 #include "cesium/omniverse/FabricVertexAttributeAccessors.h"
 
+#include "cesium/omniverse/MathUtil.h"
+
 namespace cesium::omniverse {
 PositionsAccessor::PositionsAccessor()
     : _size(0) {}
@@ -141,30 +143,18 @@ NormalsAccessor::NormalsAccessor(const CesiumGltf::AccessorView<glm::fvec3>& vie
     , _size(static_cast<uint64_t>(view.size())) {}
 
 NormalsAccessor NormalsAccessor::GenerateSmooth(const PositionsAccessor& positions, const IndicesAccessor& indices) {
-    auto normals = std::vector<glm::fvec3>(positions.size(), glm::fvec3(0.0f));
-
-    for (uint64_t i = 0; i < indices.size(); i += 3) {
-        const auto idx0 = static_cast<uint64_t>(indices.get(i));
-        const auto idx1 = static_cast<uint64_t>(indices.get(i + 1));
-        const auto idx2 = static_cast<uint64_t>(indices.get(i + 2));
-
-        const auto& p0 = positions.get(idx0);
-        const auto& p1 = positions.get(idx1);
-        const auto& p2 = positions.get(idx2);
-        auto n = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+    auto positionsValues = std::vector<glm::fvec3>(positions.size());
+    auto indicesValues = std::vector<int>(indices.size());
+    auto normals = std::vector<glm::fvec3>(positions.size());
 
-        normals[idx0] += n;
-        normals[idx1] += n;
-        normals[idx2] += n;
-    }
+    positions.fill(positionsValues);
+    indices.fill(indicesValues);
 
-    for (auto& n : normals) {
-        n = glm::normalize(n);
-    }
+    MathUtil::computeSmoothNormals(positionsValues, indicesValues, normals);
 
     auto accessor = NormalsAccessor();
     accessor._computed = std::move(normals);
-    accessor._size = indices.size();
+    accessor._size = positions.size();
     return accessor;
 }
 
@@ -1,10 +1,272 @@
 #include "cesium/omniverse/MathUtil.h"
 
+#include <CesiumUtility/Tracing.h>
 #include <glm/gtx/euler_angles.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
+#include <pxr/base/work/loops.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define CESIUM_OMNI_SSE
+#include <emmintrin.h>
+#endif
 
 namespace cesium::omniverse::MathUtil {
 
+namespace {
+
+// Number of triangles or vertices processed by a single work item
+const uint64_t SMOOTH_NORMALS_GRAIN_SIZE = 16384;
+
+// Number of prims transformed together by computeWorldTransforms. A block of doubles this size stays in L1.
+const uint64_t WORLD_TRANSFORM_BLOCK_SIZE = 64;
+
+glm::fvec3 computeFaceNormal(const glm::fvec3& p0, const glm::fvec3& p1, const glm::fvec3& p2) {
+    const auto n = glm::cross(p1 - p0, p2 - p0);
+    const auto length = glm::length(n);
+    return length > 0.0f ? n / length : glm::fvec3(0.0f);
+}
+
+void computeFaceNormals(
+    const gsl::span<const glm::fvec3>& positions,
+    const gsl::span<const int>& indices,
+    const gsl::span<glm::fvec3>& faceNormals,
+    uint64_t begin,
+    uint64_t end) {
+    auto t = begin;
+
+#ifdef CESIUM_OMNI_SSE
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+
+    for (; t + 4 <= end; t += 4) {
+        const auto& a0 = positions[static_cast<uint64_t>(indices[t * 3 + 0])];
+        const auto& a1 = positions[static_cast<uint64_t>(indices[t * 3 + 1])];
+        const auto& a2 = positions[static_cast<uint64_t>(indices[t * 3 + 2])];
+        const auto& b0 = positions[static_cast<uint64_t>(indices[t * 3 + 3])];
+        const auto& b1 = positions[static_cast<uint64_t>(indices[t * 3 + 4])];
+        const auto& b2 = positions[static_cast<uint64_t>(indices[t * 3 + 5])];
+        const auto& c0 = positions[static_cast<uint64_t>(indices[t * 3 + 6])];
+        const auto& c1 = positions[static_cast<uint64_t>(indices[t * 3 + 7])];
+        const auto& c2 = positions[static_cast<uint64_t>(indices[t * 3 + 8])];
+        const auto& d0 = positions[static_cast<uint64_t>(indices[t * 3 + 9])];
+        const auto& d1 = positions[static_cast<uint64_t>(indices[t * 3 + 10])];
+        const auto& d2 = positions[static_cast<uint64_t>(indices[t * 3 + 11])];
+
+        // Transpose four triangles into x, y, z lanes
+        const auto p0x = _mm_set_ps(d0.x, c0.x, b0.x, a0.x);
+        const auto p0y = _mm_set_ps(d0.y, c0.y, b0.y, a0.y);
+        const auto p0z = _mm_set_ps(d0.z, c0.z, b0.z, a0.z);
+
+        const auto e1x = _mm_sub_ps(_mm_set_ps(d1.x, c1.x, b1.x, a1.x), p0x);
+        const auto e1y = _mm_sub_ps(_mm_set_ps(d1.y, c1.y, b1.y, a1.y), p0y);
+        const auto e1z = _mm_sub_ps(_mm_set_ps(d1.z, c1.z, b1.z, a1.z), p0z);
+
+        const auto e2x = _mm_sub_ps(_mm_set_ps(d2.x, c2.x, b2.x, a2.x), p0x);
+        const auto e2y = _mm_sub_ps(_mm_set_ps(d2.y, c2.y, b2.y, a2.y), p0y);
+        const auto e2z = _mm_sub_ps(_mm_set_ps(d2.z, c2.z, b2.z, a2.z), p0z);
+
+        auto nx = _mm_sub_ps(_mm_mul_ps(e1y, e2z), _mm_mul_ps(e1z, e2y));
+        auto ny = _mm_sub_ps(_mm_mul_ps(e1z, e2x), _mm_mul_ps(e1x, e2z));
+        auto nz = _mm_sub_ps(_mm_mul_ps(e1x, e2y), _mm_mul_ps(e1y, e2x));
+
+        const auto lengthSquared =
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz));
+        const auto length = _mm_sqrt_ps(lengthSquared);
+
+        // Degenerate triangles get a zero normal
+        const auto inverseLength = _mm_and_ps(_mm_div_ps(one, length), _mm_cmpgt_ps(length, zero));
+
+        nx = _mm_mul_ps(nx, inverseLength);
+        ny = _mm_mul_ps(ny, inverseLength);
+        nz = _mm_mul_ps(nz, inverseLength);
+
+        alignas(16) float x[4];
+        alignas(16) float y[4];
+        alignas(16) float z[4];
+
+        _mm_store_ps(x, nx);
+        _mm_store_ps(y, ny);
+        _mm_store_ps(z, nz);
+
+        for (uint64_t i = 0; i < 4; ++i) {
+            faceNormals[t + i] = glm::fvec3(x[i], y[i], z[i]);
+        }
+    }
+#endif
+
+    for (; t < end; ++t) {
+        const auto& p0 = positions[static_cast<uint64_t>(indices[t * 3 + 0])];
+        const auto& p1 = positions[static_cast<uint64_t>(indices[t * 3 + 1])];
+        const auto& p2 = positions[static_cast<uint64_t>(indices[t * 3 + 2])];
+        faceNormals[t] = computeFaceNormal(p0, p1, p2);
+    }
+}
+
+void computeWorldTransformsBlock(
+    const glm::dmat4& ecefToPrimWorldTransform,
+    const gsl::span<const glm::dmat4>& gltfLocalToEcefTransforms,
+    const gsl::span<const std::array<glm::dvec3, 2>>& gltfLocalExtents,
+    const gsl::span<glm::dvec3>& worldPositions,
+    const gsl::span<glm::fquat>& worldOrientations,
+    const gsl::span<glm::fvec3>& worldScales,
+    const gsl::span<std::array<glm::dvec3, 2>>& worldExtents,
+    uint64_t begin,
+    uint64_t count) {
+    const auto& a = ecefToPrimWorldTransform;
+
+    // Structure-of-arrays block indexed by [column][row][lane] or [component][lane]
+    double m[4][3][WORLD_TRANSFORM_BLOCK_SIZE];
+    double rotation[3][3][WORLD_TRANSFORM_BLOCK_SIZE];
+    double scale[3][WORLD_TRANSFORM_BLOCK_SIZE];
+    double center[3][WORLD_TRANSFORM_BLOCK_SIZE];
+    double halfSize[3][WORLD_TRANSFORM_BLOCK_SIZE];
+
+    // Gather. Only the affine rows of the combined transform are needed.
+    for (uint64_t lane = 0; lane < count; ++lane) {
+        const auto& b = gltfLocalToEcefTransforms[begin + lane];
+        const auto& extent = gltfLocalExtents[begin + lane];
+
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 3; ++r) {
+                m[c][r][lane] = a[0][r] * b[c][0] + a[1][r] * b[c][1] + a[2][r] * b[c][2] + a[3][r] * b[c][3];
+            }
+        }
+
+        for (glm::length_t r = 0; r < 3; ++r) {
+            center[r][lane] = (extent[0][r] + extent[1][r]) * 0.5;
+            halfSize[r][lane] = (extent[1][r] - extent[0][r]) * 0.5;
+        }
+    }
+
+    // Branch free so that the compiler vectorizes across lanes. This is the same Gram-Schmidt orthogonalization
+    // that glm::decompose does, minus the perspective and skew outputs.
+    for (uint64_t lane = 0; lane < count; ++lane) {
+        auto x0 = m[0][0][lane];
+        auto y0 = m[0][1][lane];
+        auto z0 = m[0][2][lane];
+        auto x1 = m[1][0][lane];
+        auto y1 = m[1][1][lane];
+        auto z1 = m[1][2][lane];
+        auto x2 = m[2][0][lane];
+        auto y2 = m[2][1][lane];
+        auto z2 = m[2][2][lane];
+
+        const auto sx = std::sqrt(x0 * x0 + y0 * y0 + z0 * z0);
+        x0 /= sx;
+        y0 /= sx;
+        z0 /= sx;
+
+        const auto skewZ = x0 * x1 + y0 * y1 + z0 * z1;
+        x1 -= x0 * skewZ;
+        y1 -= y0 * skewZ;
+        z1 -= z0 * skewZ;
+
+        const auto sy = std::sqrt(x1 * x1 + y1 * y1 + z1 * z1);
+        x1 /= sy;
+        y1 /= sy;
+        z1 /= sy;
+
+        const auto skewY = x0 * x2 + y0 * y2 + z0 * z2;
+        x2 -= x0 * skewY;
+        y2 -= y0 * skewY;
+        z2 -= z0 * skewY;
+
+        const auto skewX = x1 * x2 + y1 * y2 + z1 * z2;
+        x2 -= x1 * skewX;
+        y2 -= y1 * skewX;
+        z2 -= z1 * skewX;
+
+        const auto sz = std::sqrt(x2 * x2 + y2 * y2 + z2 * z2);
+        x2 /= sz;
+        y2 /= sz;
+        z2 /= sz;
+
+        // A negative determinant means the transform mirrors, which is folded into the scale
+        const auto determinant = x0 * (y1 * z2 - z1 * y2) + y0 * (z1 * x2 - x1 * z2) + z0 * (x1 * y2 - y1 * x2);
+        const auto sign = determinant < 0.0 ? -1.0 : 1.0;
+
+        rotation[0][0][lane] = x0 * sign;
+        rotation[0][1][lane] = y0 * sign;
+        rotation[0][2][lane] = z0 * sign;
+        rotation[1][0][lane] = x1 * sign;
+        rotation[1][1][lane] = y1 * sign;
+        rotation[1][2][lane] = z1 * sign;
+        rotation[2][0][lane] = x2 * sign;
+        rotation[2][1][lane] = y2 * sign;
+        rotation[2][2][lane] = z2 * sign;
+
+        scale[0][lane] = sx * sign;
+        scale[1][lane] = sy * sign;
+        scale[2][lane] = sz * sign;
+    }
+
+    // An affine transform maps the extent center to the new center and the half size to the absolute value of the
+    // linear part times the half size. This gives the same box as transforming all eight corners.
+    for (glm::length_t r = 0; r < 3; ++r) {
+        for (uint64_t lane = 0; lane < count; ++lane) {
+            const auto cx = center[0][lane];
+            const auto cy = center[1][lane];
+            const auto cz = center[2][lane];
+            const auto hx = halfSize[0][lane];
+            const auto hy = halfSize[1][lane];
+            const auto hz = halfSize[2][lane];
+
+            const auto transformedCenter = m[0][r][lane] * cx + m[1][r][lane] * cy + m[2][r][lane] * cz + m[3][r][lane];
+            const auto transformedHalfSize =
+                std::abs(m[0][r][lane]) * hx + std::abs(m[1][r][lane]) * hy + std::abs(m[2][r][lane]) * hz;
+
+            worldExtents[begin + lane][0][r] = transformedCenter - transformedHalfSize;
+            worldExtents[begin + lane][1][r] = transformedCenter + transformedHalfSize;
+        }
+    }
+
+    // Quaternion extraction branches per lane so it runs as a scalar pass, again matching glm::decompose
+    for (uint64_t lane = 0; lane < count; ++lane) {
+        const auto r = [&](int column, int row) { return rotation[column][row][lane]; };
+
+        double q[4]; // x, y, z, w
+        const auto trace = r(0, 0) + r(1, 1) + r(2, 2);
+
+        if (trace > 0.0) {
+            auto root = std::sqrt(trace + 1.0);
+            q[3] = 0.5 * root;
+            root = 0.5 / root;
+            q[0] = root * (r(1, 2) - r(2, 1));
+            q[1] = root * (r(2, 0) - r(0, 2));
+            q[2] = root * (r(0, 1) - r(1, 0));
+        } else {
+            const int next[3] = {1, 2, 0};
+            auto i = 0;
+            if (r(1, 1) > r(0, 0)) {
+                i = 1;
+            }
+            if (r(2, 2) > r(i, i)) {
+                i = 2;
+            }
+            const auto j = next[i];
+            const auto k = next[j];
+
+            auto root = std::sqrt(r(i, i) - r(j, j) - r(k, k) + 1.0);
+            q[i] = 0.5 * root;
+            root = 0.5 / root;
+            q[j] = root * (r(i, j) + r(j, i));
+            q[k] = root * (r(i, k) + r(k, i));
+            q[3] = root * (r(j, k) - r(k, j));
+        }
+
+        worldPositions[begin + lane] = glm::dvec3(m[3][0][lane], m[3][1][lane], m[3][2][lane]);
+        worldOrientations[begin + lane] = glm::fquat(glm::dquat(q[3], q[0], q[1], q[2]));
+        worldScales[begin + lane] = glm::fvec3(scale[0][lane], scale[1][lane], scale[2][lane]);
+    }
+}
+
+} // namespace
+
 EulerAngleOrder getReversedEulerAngleOrder(EulerAngleOrder eulerAngleOrder) {
     switch (eulerAngleOrder) {
         case EulerAngleOrder::XYZ:
@@ -167,4 +429,73 @@ std::array<glm::dvec3, 2> transformExtent(const std::array<glm::dvec3, 2>& exten
     return {{transformedMin, transformedMax}};
 }
 
+void computeSmoothNormals(
+    const gsl::span<const glm::fvec3>& positions,
+    const gsl::span<const int>& indices,
+    const gsl::span<glm::fvec3>& normals) {
+    CESIUM_TRACE("MathUtil::computeSmoothNormals");
+
+    assert(normals.size() == positions.size());
+
+    const auto triangleCount = indices.size() / 3;
+
+    // Face normals are computed in parallel and then accumulated serially so that the result doesn't depend
+    // on how the work was split and no synchronization is needed on shared vertices
+    std::vector<glm::fvec3> faceNormals(triangleCount);
+
+    pxr::WorkParallelForN(
+        triangleCount,
+        [&](size_t begin, size_t end) { computeFaceNormals(positions, indices, faceNormals, begin, end); },
+        SMOOTH_NORMALS_GRAIN_SIZE);
+
+    std::fill(normals.begin(), normals.end(), glm::fvec3(0.0f));
+
+    for (uint64_t t = 0; t < triangleCount; ++t) {
+        const auto& n = faceNormals[t];
+        normals[static_cast<uint64_t>(indices[t * 3 + 0])] += n;
+        normals[static_cast<uint64_t>(indices[t * 3 + 1])] += n;
+        normals[static_cast<uint64_t>(indices[t * 3 + 2])] += n;
+    }
+
+    pxr::WorkParallelForN(
+        normals.size(),
+        [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                const auto length = glm::length(normals[i]);
+                normals[i] = length > 0.0f ? normals[i] / length : glm::fvec3(0.0f);
+            }
+        },
+        SMOOTH_NORMALS_GRAIN_SIZE);
+}
+
+void computeWorldTransforms(
+    const glm::dmat4& ecefToPrimWorldTransform,
+    const gsl::span<const glm::dmat4>& gltfLocalToEcefTransforms,
+    const gsl::span<const std::array<glm::dvec3, 2>>& gltfLocalExtents,
+    const gsl::span<glm::dvec3>& worldPositions,
+    const gsl::span<glm::fquat>& worldOrientations,
+    const gsl::span<glm::fvec3>& worldScales,
+    const gsl::span<std::array<glm::dvec3, 2>>& worldExtents) {
+    const auto count = gltfLocalToEcefTransforms.size();
+
+    assert(gltfLocalExtents.size() == count);
+    assert(worldPositions.size() == count);
+    assert(worldOrientations.size() == count);
+    assert(worldScales.size() == count);
+    assert(worldExtents.size() == count);
+
+    for (uint64_t begin = 0; begin < count; begin += WORLD_TRANSFORM_BLOCK_SIZE) {
+        computeWorldTransformsBlock(
+            ecefToPrimWorldTransform,
+            gltfLocalToEcefTransforms,
+            gltfLocalExtents,
+            worldPositions,
+            worldOrientations,
+            worldScales,
+            worldExtents,
+            begin,
+            std::min(WORLD_TRANSFORM_BLOCK_SIZE, count - begin));
+    }
+}
+
 } // namespace cesium::omniverse::MathUtil
@@ -2,22 +2,130 @@
 
 #include "cesium/omniverse/Context.h"
 #include "cesium/omniverse/DataType.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
 #include "cesium/omniverse/FabricPropertyDescriptor.h"
-#include "cesium/omniverse/FabricTextureData.h"
+#include "cesium/omniverse/FabricTexture.h"
 
 namespace cesium::omniverse::MetadataUtil {
 
 namespace {
-const auto unsupportedPropertyCallbackNoop = []([[maybe_unused]] const std::string& propertyId,
-                                                [[maybe_unused]] const std::string& warning) {};
+
+constexpr uint64_t MAXIMUM_PROPERTY_TABLE_TEXTURE_WIDTH = 4096;
+
+// Properties with the same texture format are packed into one texture, one after another in texel order
+struct PropertyTableAtlas {
+    carb::Format format;
+    uint64_t texelByteLength;
+    uint64_t texelCount;
+    std::vector<std::byte> content;
+    std::vector<std::function<void(std::vector<std::byte>& texelBytes)>> encoders;
+};
+
+template <typename T> void appendBytes(std::vector<std::byte>& bytes, const T& value) {
+    const auto pValue = reinterpret_cast<const std::byte*>(&value);
+    bytes.insert(bytes.end(), pValue, pValue + sizeof(T));
+}
+
+void appendPropertyTableContent(
+    std::vector<std::byte>& content,
+    const CesiumGltf::Model& model,
+    int32_t bufferViewIndex,
+    DataType type,
+    uint64_t size) {
+    const auto pBufferView = model.getSafe(&model.bufferViews, bufferViewIndex);
+    assert(pBufferView); // Shouldn't have gotten this far if the property table property is invalid
+
+    const auto pBuffer = model.getSafe(&model.buffers, pBufferView->buffer);
+    assert(pBuffer);
+
+    const auto& data = pBuffer->cesium.data;
+    const auto byteOffset = static_cast<uint64_t>(pBufferView->byteOffset);
+    const auto byteLength = static_cast<uint64_t>(pBufferView->byteLength);
+
+    // The same bytes encode to different texel values depending on the property type
+    appendBytes(content, type);
+    appendBytes(content, size);
+    appendBytes(content, byteLength);
+    content.insert(content.end(), data.begin() + byteOffset, data.begin() + byteOffset + byteLength);
+}
+
+template <DataType type, typename PropertyTablePropertyView>
+void encodePropertyTableProperty(
+    const PropertyTablePropertyView& propertyTablePropertyView,
+    uint64_t texelOffset,
+    std::vector<std::byte>& texelBytes) {
+    constexpr auto textureType = DataTypeUtil::getPropertyTableTextureType<type>();
+    using TextureType = DataTypeUtil::GetNativeType<textureType>;
+    using TextureComponentType = DataTypeUtil::GetNativeType<DataTypeUtil::getComponentType<textureType>()>;
+
+    // The texture type should always be the same or larger type
+    static_assert(DataTypeUtil::getComponentCount<type>() <= DataTypeUtil::getComponentCount<textureType>());
+
+    // Matrix packing not implemented yet
+    static_assert(!DataTypeUtil::isMatrix<type>());
+
+    const auto size = static_cast<uint64_t>(propertyTablePropertyView.size());
+
+    constexpr auto texelByteLength = DataTypeUtil::getByteLength<textureType>();
+    gsl::span<TextureType> texelValues(
+        reinterpret_cast<TextureType*>(texelBytes.data()), texelBytes.size() / texelByteLength);
+
+    for (uint64_t i = 0; i < size; ++i) {
+        auto& texelValue = texelValues[texelOffset + i];
+        const auto& rawValue = propertyTablePropertyView.getRaw(static_cast<int64_t>(i));
+
+        if constexpr (DataTypeUtil::isVector<type>()) {
+            for (uint64_t j = 0; j < DataTypeUtil::getComponentCount<type>(); ++j) {
+                texelValue[j] = static_cast<TextureComponentType>(rawValue[j]);
+            }
+        } else {
+            texelValue = static_cast<TextureType>(rawValue);
+        }
+    }
+}
+
+FabricPropertyTableTexture createPropertyTableTexture(PropertyTableAtlas&& atlas) {
+    assert(atlas.texelCount > 0);
+    const auto width = glm::min(MAXIMUM_PROPERTY_TABLE_TEXTURE_WIDTH, atlas.texelCount);
+    const auto height = ((atlas.texelCount - 1) / MAXIMUM_PROPERTY_TABLE_TEXTURE_WIDTH) + 1;
+    const auto textureDescriptor = FabricTextureDescriptor(width, height, atlas.format);
+    const auto texelByteLength = atlas.texelByteLength;
+
+    const auto contentHash = CppUtil::hashValues(
+        std::string_view(reinterpret_cast<const char*>(atlas.content.data()), atlas.content.size()));
+
+    return {
+        contentHash,
+        std::move(atlas.content),
+        textureDescriptor,
+        [encoders = std::move(atlas.encoders), textureDescriptor, texelByteLength](FabricTexture& texture) {
+            const auto width = textureDescriptor.getWidth();
+            const auto height = textureDescriptor.getHeight();
+
+            std::vector<std::byte> texelBytes(width * height * texelByteLength, std::byte(0));
+
+            for (const auto& encoder : encoders) {
+                encoder(texelBytes);
+            }
+
+            texture.setBytes(texelBytes, width, height, textureDescriptor.getFormat());
+        },
+    };
 }
 
-std::tuple<std::vector<FabricPropertyDescriptor>, std::map<std::string, std::string>> getStyleableProperties(
+} // namespace
+
+void getStyleablePropertyInfo(
     const Context& context,
     const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
-    std::vector<FabricPropertyDescriptor> properties;
-    std::map<std::string, std::string> unsupportedPropertyWarnings;
+    const CesiumGltf::MeshPrimitive& primitive,
+    FabricPrimitiveInfo& primitiveInfo) {
+    auto& properties = primitiveInfo.styleableProperties;
+    auto& unsupportedPropertyWarnings = primitiveInfo.unsupportedPropertyWarnings;
+    auto& images = primitiveInfo.propertyTextureImages;
+    auto& propertyTextureIndexMapping = primitiveInfo.propertyTextureIndexMapping;
+    auto& propertyTableTextures = primitiveInfo.propertyTableTextures;
+    auto& propertyTableTextureRegions = primitiveInfo.propertyTableTextureRegions;
 
     const auto unsupportedPropertyCallback =
         [&unsupportedPropertyWarnings](const std::string& propertyId, const std::string& warning) {
@@ -48,9 +156,9 @@ std::tuple<std::vector<FabricPropertyDescriptor>, std::map<std::string, std::str
         context,
         model,
         primitive,
-        [&properties](
+        [&properties, &images, &propertyTextureIndexMapping](
             const std::string& propertyId,
-            [[maybe_unused]] const auto& propertyTexturePropertyView,
+            const auto& propertyTexturePropertyView,
             const auto& property) {
             constexpr auto type = std::decay_t<decltype(property)>::Type;
 
@@ -61,77 +169,7 @@ std::tuple<std::vector<FabricPropertyDescriptor>, std::map<std::string, std::str
                 propertyId,
                 0, // featureIdSetIndex not relevant for property textures
             });
-        },
-        unsupportedPropertyCallback);
-
-    forEachStyleablePropertyTableProperty(
-        context,
-        model,
-        primitive,
-        [&properties](
-            const std::string& propertyId,
-            [[maybe_unused]] const auto& propertyTablePropertyView,
-            const auto& property) {
-            constexpr auto type = std::decay_t<decltype(property)>::Type;
-
-            // In C++ 20 this can be emplace_back without the {}
-            properties.push_back({
-                FabricPropertyStorageType::TABLE,
-                DataTypeUtil::getMdlInternalPropertyType<type>(),
-                propertyId,
-                property.featureIdSetIndex,
-            });
-        },
-        unsupportedPropertyCallback);
-
-    // Sorting is important for checking FabricMaterialDescriptor equality
-    CppUtil::sort(properties, [](const auto& lhs, const auto& rhs) { return lhs.propertyId > rhs.propertyId; });
-
-    return {std::move(properties), std::move(unsupportedPropertyWarnings)};
-}
-
-std::vector<const CesiumGltf::ImageCesium*> getPropertyTextureImages(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
-    std::vector<const CesiumGltf::ImageCesium*> images;
-
-    forEachStyleablePropertyTextureProperty(
-        context,
-        model,
-        primitive,
-        [&images](
-            [[maybe_unused]] const std::string& propertyId,
-            const auto& propertyTexturePropertyView,
-            [[maybe_unused]] const auto& property) {
-            const auto pImage = propertyTexturePropertyView.getImage();
-            assert(pImage); // Shouldn't have gotten this far if image is invalid
-
-            const auto imageIndex = CppUtil::indexOf(images, pImage);
-            if (imageIndex == images.size()) {
-                images.push_back(pImage);
-            }
-        },
-        unsupportedPropertyCallbackNoop);
-
-    return images;
-}
 
-std::unordered_map<uint64_t, uint64_t> getPropertyTextureIndexMapping(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
-    std::vector<const CesiumGltf::ImageCesium*> images;
-    std::unordered_map<uint64_t, uint64_t> propertyTextureIndexMapping;
-
-    forEachStyleablePropertyTextureProperty(
-        context,
-        model,
-        primitive,
-        [&images, &propertyTextureIndexMapping](
-            [[maybe_unused]] const std::string& propertyId,
-            const auto& propertyTexturePropertyView,
-            [[maybe_unused]] const auto& property) {
             const auto pImage = propertyTexturePropertyView.getImage();
             assert(pImage); // Shouldn't have gotten this far if image is invalid
 
@@ -140,97 +178,71 @@ std::unordered_map<uint64_t, uint64_t> getPropertyTextureIndexMapping(
                 images.push_back(pImage);
             }
 
-            const auto textureIndex = property.textureIndex;
-            propertyTextureIndexMapping[textureIndex] = imageIndex;
+            propertyTextureIndexMapping[property.textureIndex] = imageIndex;
         },
-        unsupportedPropertyCallbackNoop);
+        unsupportedPropertyCallback);
 
-    return propertyTextureIndexMapping;
-}
-
-std::vector<FabricTextureData> encodePropertyTables(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
-    std::vector<FabricTextureData> textures;
+    std::vector<PropertyTableAtlas> propertyTableAtlases;
 
     forEachStyleablePropertyTableProperty(
         context,
         model,
         primitive,
-        [&textures](
-            [[maybe_unused]] const std::string& propertyId,
+        [&model, &properties, &propertyTableAtlases, &propertyTableTextureRegions](
+            const std::string& propertyId,
             const auto& propertyTablePropertyView,
             const auto& property) {
             constexpr auto type = std::decay_t<decltype(property)>::Type;
             constexpr auto textureType = DataTypeUtil::getPropertyTableTextureType<type>();
             constexpr auto textureFormat = DataTypeUtil::getTextureFormat<textureType>();
-            using TextureType = DataTypeUtil::GetNativeType<textureType>;
-            using TextureComponentType = DataTypeUtil::GetNativeType<DataTypeUtil::getComponentType<textureType>()>;
 
-            // The texture type should always be the same or larger type
-            static_assert(DataTypeUtil::getComponentCount<type>() <= DataTypeUtil::getComponentCount<textureType>());
+            // In C++ 20 this can be emplace_back without the {}
+            properties.push_back({
+                FabricPropertyStorageType::TABLE,
+                DataTypeUtil::getMdlInternalPropertyType<type>(),
+                propertyId,
+                property.featureIdSetIndex,
+            });
 
-            // Matrix packing not implemented yet
-            static_assert(!DataTypeUtil::isMatrix<type>());
+            const auto atlasIndex =
+                CppUtil::indexOfByMember(propertyTableAtlases, &PropertyTableAtlas::format, textureFormat);
+
+            if (atlasIndex == propertyTableAtlases.size()) {
+                // In C++ 20 this can be emplace_back without the {}
+                propertyTableAtlases.push_back({
+                    textureFormat,
+                    DataTypeUtil::getByteLength<textureType>(),
+                    0,
+                    {},
+                    {},
+                });
+            }
 
+            auto& atlas = propertyTableAtlases[atlasIndex];
             const auto size = static_cast<uint64_t>(propertyTablePropertyView.size());
-            assert(size > 0);
-
-            constexpr uint64_t maximumTextureWidth = 4096;
-            const auto width = glm::min(maximumTextureWidth, size);
-            const auto height = ((size - 1) / maximumTextureWidth) + 1;
-
-            constexpr auto texelByteLength = DataTypeUtil::getByteLength<textureType>();
-            const auto textureByteLength = width * height * texelByteLength;
-
-            std::vector<std::byte> texelBytes(textureByteLength, std::byte(0));
-            gsl::span<TextureType> texelValues(
-                reinterpret_cast<TextureType*>(texelBytes.data()), texelBytes.size() / texelByteLength);
-
-            for (uint64_t i = 0; i < size; ++i) {
-                auto& texelValue = texelValues[i];
-                const auto& rawValue = propertyTablePropertyView.getRaw(static_cast<int64_t>(i));
-
-                if constexpr (DataTypeUtil::isVector<type>()) {
-                    for (uint64_t j = 0; j < DataTypeUtil::getComponentCount<type>(); ++j) {
-                        texelValue[j] = static_cast<TextureComponentType>(rawValue[j]);
-                    }
-                } else {
-                    texelValue = static_cast<TextureType>(rawValue);
-                }
-            }
+            const auto texelOffset = atlas.texelCount;
 
-            // In C++ 20 this can be push_back without the {}
-            textures.push_back({
-                std::move(texelBytes),
-                width,
-                height,
-                textureFormat,
-            });
-        },
-        unsupportedPropertyCallbackNoop);
+            atlas.texelCount += size;
+            appendPropertyTableContent(atlas.content, model, property.valuesBufferView, type, size);
 
-    return textures;
-}
+            // Encoding is deferred until the texture is acquired so that it can be skipped when a texture with the
+            // same values is already shared, e.g. by another primitive in the tile that uses the same property table
+            atlas.encoders.emplace_back([propertyTablePropertyView, texelOffset](std::vector<std::byte>& texelBytes) {
+                encodePropertyTableProperty<type>(propertyTablePropertyView, texelOffset, texelBytes);
+            });
 
-uint64_t getPropertyTableTextureCount(
-    const Context& context,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
-    uint64_t count = 0;
+            // In C++ 20 this can be emplace_back without the {}
+            propertyTableTextureRegions.push_back({atlasIndex, texelOffset});
+        },
+        unsupportedPropertyCallback);
 
-    forEachStyleablePropertyTableProperty(
-        context,
-        model,
-        primitive,
-        [&count](
-            [[maybe_unused]] const std::string& propertyId,
-            [[maybe_unused]] const auto& propertyTablePropertyView,
-            [[maybe_unused]] const auto& property) { ++count; },
-        unsupportedPropertyCallbackNoop);
+    propertyTableTextures.reserve(propertyTableAtlases.size());
+    for (auto& atlas : propertyTableAtlases) {
+        propertyTableTextures.push_back(createPropertyTableTexture(std::move(atlas)));
+    }
 
-    return count;
+    // Sorting is important for checking FabricMaterialDescriptor equality
+    CppUtil::sort(properties, [](const auto& lhs, const auto& rhs) { return lhs.propertyId > rhs.propertyId; });
 }
 
 } // namespace cesium::omniverse::MetadataUtil
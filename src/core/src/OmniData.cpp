@@ -127,6 +127,42 @@ uint64_t OmniData::getDebugTexturePoolInitialCapacity() const {
     return texturePoolInitialCapacity;
 }
 
+double OmniData::getDebugPoolGrowthFactor() const {
+    const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumData)) {
+        return 2.0;
+    }
+
+    double poolGrowthFactor;
+    cesiumData.GetDebugPoolGrowthFactorAttr().Get(&poolGrowthFactor);
+
+    return poolGrowthFactor;
+}
+
+uint64_t OmniData::getDebugPoolLowWaterMark() const {
+    const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumData)) {
+        return 0;
+    }
+
+    uint64_t poolLowWaterMark;
+    cesiumData.GetDebugPoolLowWaterMarkAttr().Get(&poolLowWaterMark);
+
+    return poolLowWaterMark;
+}
+
+double OmniData::getDebugPoolMaximumIdleTime() const {
+    const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumData)) {
+        return 0.0;
+    }
+
+    double poolMaximumIdleTime;
+    cesiumData.GetDebugPoolMaximumIdleTimeAttr().Get(&poolMaximumIdleTime);
+
+    return poolMaximumIdleTime;
+}
+
 bool OmniData::getDebugRandomColors() const {
     const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
     if (!UsdUtil::isSchemaValid(cesiumData)) {
@@ -151,4 +187,28 @@ bool OmniData::getDebugDisableGeoreferencing() const {
     return debugDisableGeoreferencing;
 }
 
+bool OmniData::getDebugVerifyRenderStatistics() const {
+    const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumData)) {
+        return false;
+    }
+
+    bool debugVerifyRenderStatistics;
+    cesiumData.GetDebugVerifyRenderStatisticsAttr().Get(&debugVerifyRenderStatistics);
+
+    return debugVerifyRenderStatistics;
+}
+
+bool OmniData::getDebugPipelinedTileSelection() const {
+    const auto cesiumData = UsdUtil::getCesiumData(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumData)) {
+        return false;
+    }
+
+    bool debugPipelinedTileSelection;
+    cesiumData.GetDebugPipelinedTileSelectionAttr().Get(&debugPipelinedTileSelection);
+
+    return debugPipelinedTileSelection;
+}
+
 } // namespace cesium::omniverse
@@ -129,7 +129,10 @@ void OmniIonRasterOverlay::reload() {
 
         if (error.type == CesiumRasterOverlays::RasterOverlayLoadType::CesiumIon &&
             (statusCode == 401 || statusCode == 404)) {
-            Broadcast::showTroubleshooter({}, 0, "", rasterOverlayIonAssetId, rasterOverlayName, error.message);
+            // Load errors may be reported during pipelined tile selection on a worker thread
+            _pContext->runInMainThread([rasterOverlayIonAssetId, rasterOverlayName, message = error.message]() {
+                Broadcast::showTroubleshooter({}, 0, "", rasterOverlayIonAssetId, rasterOverlayName, message);
+            });
         }
 
         _pContext->getLogger()->error(error.message);
@@ -6,6 +6,7 @@
 #include "cesium/omniverse/GltfUtil.h"
 #include "cesium/omniverse/Logger.h"
 #include "cesium/omniverse/OmniIonServer.h"
+#include "cesium/omniverse/TextureCompressionUtil.h"
 #include "cesium/omniverse/UsdUtil.h"
 
 #include <CesiumIonClient/Token.h>
@@ -112,6 +113,27 @@ FabricOverlayRenderMethod OmniRasterOverlay::getOverlayRenderMethod() const {
     return FabricOverlayRenderMethod::OVERLAY;
 }
 
+TextureCompression OmniRasterOverlay::getTextureCompression() const {
+    const auto cesiumRasterOverlay = UsdUtil::getCesiumRasterOverlay(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumRasterOverlay)) {
+        return TextureCompression::NONE;
+    }
+
+    pxr::TfToken textureCompression;
+    cesiumRasterOverlay.GetTextureCompressionAttr().Get(&textureCompression);
+
+    if (textureCompression == pxr::CesiumTokens->none) {
+        return TextureCompression::NONE;
+    } else if (textureCompression == pxr::CesiumTokens->fast) {
+        return TextureCompression::FAST;
+    } else if (textureCompression == pxr::CesiumTokens->quality) {
+        return TextureCompression::QUALITY;
+    }
+
+    _pContext->getLogger()->warn("Invalid texture compression encountered {}.", textureCompression.GetText());
+    return TextureCompression::NONE;
+}
+
 CesiumRasterOverlays::RasterOverlayOptions OmniRasterOverlay::createRasterOverlayOptions() const {
     CesiumRasterOverlays::RasterOverlayOptions options;
     options.ktx2TranscodeTargets = GltfUtil::getKtx2TranscodeTargets();
@@ -132,6 +154,9 @@ void OmniRasterOverlay::setRasterOverlayOptionsFromUsd(CesiumRasterOverlays::Ras
     options.maximumTextureSize = getMaximumTextureSize();
     options.maximumSimultaneousTileLoads = getMaximumSimultaneousTileLoads();
     options.subTileCacheBytes = getSubTileCacheBytes();
+
+    // Read by FabricPrepareRenderResources::prepareRasterInLoadThread
+    options.rendererOptions = getTextureCompression();
 }
 
 } // namespace cesium::omniverse
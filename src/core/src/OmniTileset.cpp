@@ -19,6 +19,8 @@
 #include "cesium/omniverse/OmniPolygonRasterOverlay.h"
 #include "cesium/omniverse/OmniRasterOverlay.h"
 #include "cesium/omniverse/TaskProcessor.h"
+#include "cesium/omniverse/TextureCompressionUtil.h"
+#include "cesium/omniverse/TilesetSettings.h"
 #include "cesium/omniverse/TilesetStatistics.h"
 #include "cesium/omniverse/UsdUtil.h"
 #include "cesium/omniverse/Viewport.h"
@@ -33,11 +35,16 @@
 #include <Cesium3DTilesSelection/ViewUpdateResult.h>
 #include <CesiumUsdSchemas/rasterOverlay.h>
 #include <CesiumUsdSchemas/tileset.h>
+#include <glm/gtc/matrix_inverse.hpp>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -66,6 +73,27 @@ void forEachFabricMaterial(
     });
 }
 
+void setTileRendered(
+    const Cesium3DTilesSelection::Tile& tile,
+    bool rendered,
+    std::vector<omni::fabric::Path>& geometryPaths) {
+    if (tile.getState() != Cesium3DTilesSelection::TileLoadState::Done) {
+        return;
+    }
+    const auto pRenderContent = tile.getContent().getRenderContent();
+    if (!pRenderContent) {
+        return;
+    }
+    const auto pRenderResources = static_cast<const FabricRenderResources*>(pRenderContent->getRenderResources());
+    if (!pRenderResources) {
+        return;
+    }
+    for (const auto& fabricMesh : pRenderResources->fabricMeshes) {
+        fabricMesh.pGeometry->setRendered(rendered);
+        geometryPaths.push_back(fabricMesh.pGeometry->getPath());
+    }
+}
+
 } // namespace
 
 OmniTileset::OmniTileset(Context* pContext, const pxr::SdfPath& path, int64_t tilesetId)
@@ -88,6 +116,11 @@ int64_t OmniTileset::getTilesetId() const {
 }
 
 TilesetStatistics OmniTileset::getStatistics() const {
+    return _statistics;
+}
+
+void OmniTileset::updateStatistics() {
+    // Statistics are snapshotted on the main thread so that they can be read while tiles are being selected
     TilesetStatistics statistics;
 
     statistics.tilesetCachedBytes = static_cast<uint64_t>(_pTileset->getTotalDataBytes());
@@ -103,7 +136,17 @@ TilesetStatistics OmniTileset::getStatistics() const {
         statistics.tilesLoadingMain = static_cast<uint64_t>(_pViewUpdateResult->mainThreadTileLoadQueueLength);
     }
 
-    return statistics;
+    statistics.visibilityWrites = _visibilityWrites;
+
+    _statistics = statistics;
+}
+
+std::shared_ptr<const TilesetSettings> OmniTileset::getSettings() const {
+    return _pSettings;
+}
+
+const glm::dmat4& OmniTileset::getEcefToPrimWorldTransform() const {
+    return _ecefToPrimWorldTransform;
 }
 
 TilesetSourceType OmniTileset::getSourceType() const {
@@ -382,6 +425,30 @@ bool OmniTileset::getSmoothNormals() const {
     return smoothNormals;
 }
 
+bool OmniTileset::getRenderPointsAsVoxels() const {
+    const auto cesiumTileset = UsdUtil::getCesiumTileset(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumTileset)) {
+        return false;
+    }
+
+    bool renderPointsAsVoxels;
+    cesiumTileset.GetRenderPointsAsVoxelsAttr().Get(&renderPointsAsVoxels);
+
+    return renderPointsAsVoxels;
+}
+
+bool OmniTileset::getMergePrimitives() const {
+    const auto cesiumTileset = UsdUtil::getCesiumTileset(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumTileset)) {
+        return false;
+    }
+
+    bool mergePrimitives;
+    cesiumTileset.GetMergePrimitivesAttr().Get(&mergePrimitives);
+
+    return mergePrimitives;
+}
+
 bool OmniTileset::getShowCreditsOnScreen() const {
     const auto cesiumTileset = UsdUtil::getCesiumTileset(_pContext->getUsdStage(), _path);
     if (!UsdUtil::isSchemaValid(cesiumTileset)) {
@@ -394,6 +461,27 @@ bool OmniTileset::getShowCreditsOnScreen() const {
     return showCreditsOnScreen;
 }
 
+TextureCompression OmniTileset::getTextureCompression() const {
+    const auto cesiumTileset = UsdUtil::getCesiumTileset(_pContext->getUsdStage(), _path);
+    if (!UsdUtil::isSchemaValid(cesiumTileset)) {
+        return TextureCompression::NONE;
+    }
+
+    pxr::TfToken textureCompression;
+    cesiumTileset.GetTextureCompressionAttr().Get(&textureCompression);
+
+    if (textureCompression == pxr::CesiumTokens->none) {
+        return TextureCompression::NONE;
+    } else if (textureCompression == pxr::CesiumTokens->fast) {
+        return TextureCompression::FAST;
+    } else if (textureCompression == pxr::CesiumTokens->quality) {
+        return TextureCompression::QUALITY;
+    }
+
+    _pContext->getLogger()->warn("Invalid texture compression encountered {}.", textureCompression.GetText());
+    return TextureCompression::NONE;
+}
+
 pxr::SdfPath OmniTileset::getResolvedGeoreferencePath() const {
     const auto pGlobeAnchor = _pContext->getAssetRegistry().getGlobeAnchor(_path);
     if (pGlobeAnchor) {
@@ -510,7 +598,7 @@ void OmniTileset::reload() {
     const auto externals = Cesium3DTilesSelection::TilesetExternals{
         _pContext->getAssetAccessor(),
         _pRenderResourcesPreparer,
-        _pContext->getAsyncSystem(),
+        _pContext->getTilesetAsyncSystem(),
         _pContext->getCreditSystem(),
         _pContext->getLogger()};
 
@@ -545,7 +633,10 @@ void OmniTileset::reload() {
             // when the token is valid but not authorized for the asset.
             if (error.type == Cesium3DTilesSelection::TilesetLoadType::CesiumIon &&
                 (error.statusCode == 401 || error.statusCode == 404)) {
-                Broadcast::showTroubleshooter(tilesetPath, ionAssetId, name, 0, "", error.message);
+                // Load errors may be reported during pipelined tile selection on a worker thread
+                _pContext->runInMainThread([tilesetPath, ionAssetId, name, message = error.message]() {
+                    Broadcast::showTroubleshooter(tilesetPath, ionAssetId, name, 0, "", message);
+                });
             }
 
             _pContext->getLogger()->error(error.message);
@@ -565,6 +656,7 @@ void OmniTileset::reload() {
     }
 
     _pViewUpdateResult = nullptr;
+    _visibleTiles.clear();
     _extentSet = false;
     _activeLoading = false;
 
@@ -591,39 +683,26 @@ void OmniTileset::reload() {
             addRasterOverlayIfExists(pOmniRasterOverlay);
         }
     }
-}
-
-pxr::SdfPath OmniTileset::getRasterOverlayPathIfExists(const CesiumRasterOverlays::RasterOverlay& rasterOverlay) {
-    const auto rasterOverlayPaths = getRasterOverlayPaths();
-
-    for (const auto& rasterOverlayPath : rasterOverlayPaths) {
-        const auto pRasterOverlay = _pContext->getAssetRegistry().getRasterOverlay(rasterOverlayPath);
-        if (pRasterOverlay) {
-            const auto pNativeRasterOverlay = pRasterOverlay->getRasterOverlay();
-            if (pNativeRasterOverlay == &rasterOverlay) {
-                return rasterOverlayPath;
-            }
-        }
-    }
 
-    return {};
+    // Tiles aren't loaded until the first call to updateView so the settings are always in place before then
+    updateSettings();
 }
 
 void OmniTileset::updateRasterOverlayAlpha(const pxr::SdfPath& rasterOverlayPath) {
-    const auto rasterOverlayPaths = getRasterOverlayPaths();
-    const auto rasterOverlayIndex = CppUtil::indexOf(rasterOverlayPaths, rasterOverlayPath);
+    updateSettings();
 
-    if (rasterOverlayIndex == rasterOverlayPaths.size()) {
-        return;
-    }
+    const auto& rasterOverlays = _pSettings->rasterOverlays;
+    const auto iter =
+        std::find_if(rasterOverlays.begin(), rasterOverlays.end(), [&rasterOverlayPath](const auto& rasterOverlay) {
+            return rasterOverlay.path == rasterOverlayPath;
+        });
 
-    const auto pRasterOverlay = _pContext->getAssetRegistry().getRasterOverlay(rasterOverlayPath);
-
-    if (!pRasterOverlay) {
+    if (iter == rasterOverlays.end()) {
         return;
     }
 
-    const auto alpha = glm::clamp(pRasterOverlay->getAlpha(), 0.0, 1.0);
+    const auto rasterOverlayIndex = static_cast<uint64_t>(std::distance(rasterOverlays.begin(), iter));
+    const auto alpha = glm::clamp(iter->alpha, 0.0, 1.0);
 
     forEachFabricMaterial(_pTileset.get(), [rasterOverlayIndex, alpha](FabricMaterial& fabricMaterial) {
         fabricMaterial.setRasterOverlayAlpha(rasterOverlayIndex, alpha);
@@ -631,8 +710,10 @@ void OmniTileset::updateRasterOverlayAlpha(const pxr::SdfPath& rasterOverlayPath
 }
 
 void OmniTileset::updateDisplayColorAndOpacity() {
-    const auto displayColor = getDisplayColor();
-    const auto displayOpacity = getDisplayOpacity();
+    updateSettings();
+
+    const auto& displayColor = _pSettings->displayColor;
+    const auto displayOpacity = _pSettings->displayOpacity;
 
     forEachFabricMaterial(_pTileset.get(), [&displayColor, &displayOpacity](FabricMaterial& fabricMaterial) {
         fabricMaterial.setDisplayColorAndOpacity(displayColor, displayOpacity);
@@ -647,33 +728,97 @@ void OmniTileset::updateShaderInput(const pxr::SdfPath& shaderPath, const pxr::T
 }
 
 void OmniTileset::onUpdateFrame(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles) {
-    if (!UsdUtil::primExists(_pContext->getUsdStage(), _path)) {
-        // TfNotice can be slow, and sometimes we get a frame or two before we actually get a chance to react on it.
-        // This guard prevents us from crashing if the prim no longer exists.
+    if (!updatePrimExists()) {
         return;
     }
 
     updateTransform();
-    updateView(viewports, waitForLoadingTiles);
 
-    if (!_extentSet) {
-        _extentSet = updateExtent();
+    const auto visible = UsdUtil::isPrimVisible(_pContext->getUsdStage(), _path);
+
+    double updateViewTime = 0.0;
+
+    if (updateViewStates(viewports, visible)) {
+        const auto start = std::chrono::steady_clock::now();
+        if (waitForLoadingTiles) {
+            _pViewUpdateResult = &_pTileset->updateViewOffline(_viewStates);
+        } else {
+            _pViewUpdateResult = &_pTileset->updateView(_viewStates);
+        }
+        updateViewTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
 
-    updateLoadStatus();
+    applyTileSelection(visible, waitForLoadingTiles, updateViewTime);
+}
+
+bool OmniTileset::onUpdateFramePipelined(const gsl::span<const Viewport>& viewports) {
+    if (!updatePrimExists()) {
+        return false;
+    }
+
+    updateTransform();
+
+    const auto visible = UsdUtil::isPrimVisible(_pContext->getUsdStage(), _path);
+
+    // Apply the tiles that were selected last frame before selecting tiles for this frame. updateView ran on a worker
+    // thread so none of the main thread loading time limit has been used yet.
+    applyTileSelection(visible, false, 0.0);
+
+    return updateViewStates(viewports, visible);
+}
+
+void OmniTileset::selectTiles() {
+    _pViewUpdateResult = &_pTileset->updateView(_viewStates);
+}
+
+void OmniTileset::updateSettings() {
+    auto pSettings = std::make_shared<TilesetSettings>();
+    pSettings->version = ++_settingsVersion;
+    pSettings->tilesetId = _tilesetId;
+    pSettings->materialPath = getMaterialPath();
+    pSettings->displayColor = getDisplayColor();
+    pSettings->displayOpacity = getDisplayOpacity();
+    pSettings->smoothNormals = getSmoothNormals();
+    pSettings->renderPointsAsVoxels = getRenderPointsAsVoxels();
+    pSettings->mergePrimitives = getMergePrimitives();
+    pSettings->textureCompression = getTextureCompression();
+
+    const auto rasterOverlayPaths = getRasterOverlayPaths();
+    pSettings->rasterOverlays.reserve(rasterOverlayPaths.size());
+
+    for (const auto& rasterOverlayPath : rasterOverlayPaths) {
+        auto& rasterOverlay = pSettings->rasterOverlays.emplace_back();
+        rasterOverlay.path = rasterOverlayPath;
+
+        const auto pOmniRasterOverlay = _pContext->getAssetRegistry().getRasterOverlay(rasterOverlayPath);
+        if (pOmniRasterOverlay) {
+            rasterOverlay.pNativeRasterOverlay = pOmniRasterOverlay->getRasterOverlay();
+            rasterOverlay.overlayRenderMethod = pOmniRasterOverlay->getOverlayRenderMethod();
+            rasterOverlay.alpha = pOmniRasterOverlay->getAlpha();
+        }
+    }
+
+    _pSettings = std::move(pSettings);
+    _pRenderResourcesPreparer->setSettings(_pSettings);
+}
+
+void OmniTileset::markTransformDirty() {
+    _transformDirty = true;
 }
 
 void OmniTileset::updateTransform() {
-    // computeEcefToPrimWorldTransform is a slightly expensive operation to do every frame but it is simple
-    // and exhaustive; it reacts to USD scene graph changes, up-axis changes, meters-per-unit changes, and georeference
-    // origin changes without us needing to subscribe to any events.
-    //
-    // The faster approach would be to subscribe to change events for _worldPosition, _worldOrientation, _worldScale.
-    // Alternatively, we could register a listener with Tf::Notice but this has the downside of only notifying us
-    // about changes to the current prim and not its ancestor prims. Also Tf::Notice may notify us in a thread other
-    // than the main thread and we would have to be careful to synchronize updates to Fabric in the main thread.
+    // computeEcefToPrimWorldTransform is a slightly expensive operation so it's only done when UsdNotificationHandler
+    // reports a change that could affect it: a transform change on the tileset or one of its ancestors, a change to
+    // the georeference or globe anchor, or a change to the stage up-axis or meters-per-unit.
+    if (!_transformDirty) {
+        return;
+    }
+
+    _transformDirty = false;
+
     const auto georeferencePath = getResolvedGeoreferencePath();
     const auto ecefToPrimWorldTransform = UsdUtil::computeEcefToPrimWorldTransform(*_pContext, georeferencePath, _path);
+    _primWorldToEcefTransform = glm::affineInverse(ecefToPrimWorldTransform);
 
     // Check for transform changes and update prims accordingly
     if (ecefToPrimWorldTransform != _ecefToPrimWorldTransform) {
@@ -683,61 +828,89 @@ void OmniTileset::updateTransform() {
     }
 }
 
-void OmniTileset::updateView(const gsl::span<const Viewport>& viewports, bool waitForLoadingTiles) {
-    const auto visible = UsdUtil::isPrimVisible(_pContext->getUsdStage(), _path);
+bool OmniTileset::updatePrimExists() {
+    const auto primExists = UsdUtil::primExists(_pContext->getUsdStage(), _path);
 
-    if (visible && !getSuspendUpdate()) {
-        // Go ahead and select some tiles
-        const auto georeferencePath = getResolvedGeoreferencePath();
+    // Tile loading checks this flag instead of querying USD for every tile
+    _pRenderResourcesPreparer->setTilesetExists(primExists);
 
-        _viewStates.clear();
-        for (const auto& viewport : viewports) {
-            _viewStates.push_back(UsdUtil::computeViewState(*_pContext, georeferencePath, _path, viewport));
-        }
+    // TfNotice can be slow, and sometimes we get a frame or two before we actually get a chance to react on it.
+    // Callers check the return value to avoid crashing if the prim no longer exists.
+    return primExists;
+}
 
-        if (waitForLoadingTiles) {
-            _pViewUpdateResult = &_pTileset->updateViewOffline(_viewStates);
-        } else {
-            _pViewUpdateResult = &_pTileset->updateView(_viewStates);
-        }
+bool OmniTileset::updateViewStates(const gsl::span<const Viewport>& viewports, bool visible) {
+    if (!visible || getSuspendUpdate()) {
+        return false;
     }
 
-    if (!_pViewUpdateResult) {
-        // No tiles have ever been selected. Return early.
-        return;
+    _viewStates.clear();
+    for (const auto& viewport : viewports) {
+        _viewStates.push_back(UsdUtil::computeViewState(_primWorldToEcefTransform, viewport));
+    }
+
+    return true;
+}
+
+void OmniTileset::applyTileSelection(bool visible, bool waitForLoadingTiles, double updateViewTime) {
+    // Write the tiles prepared during updateView to Fabric before their visibility is updated below. updateView
+    // already spent part of the main thread loading time limit, so Fabric writes only get what's left of it.
+    double commitTimeBudget = 0.0;
+    const auto mainThreadLoadingTimeLimit = getMainThreadLoadingTimeLimit();
+    if (!waitForLoadingTiles && mainThreadLoadingTimeLimit > 0.0) {
+        // Keep the budget positive so that at least one tile is still written when the limit is used up
+        const auto remainingTime = mainThreadLoadingTimeLimit - updateViewTime;
+        commitTimeBudget = std::max(remainingTime, std::numeric_limits<double>::min());
     }
+    _pRenderResourcesPreparer->commitFabricMeshes(commitTimeBudget);
 
-    // Hide tiles that we no longer need
-    for (const auto pTile : _pViewUpdateResult->tilesFadingOut) {
-        if (pTile->getState() == Cesium3DTilesSelection::TileLoadState::Done) {
-            const auto pRenderContent = pTile->getContent().getRenderContent();
-            if (pRenderContent) {
-                const auto pRenderResources =
-                    static_cast<const FabricRenderResources*>(pRenderContent->getRenderResources());
-                if (pRenderResources) {
-                    for (const auto& fabricMesh : pRenderResources->fabricMeshes) {
-                        fabricMesh.pGeometry->setVisibility(false);
-                    }
-                }
+    // No tiles are visible until tiles have been selected at least once
+    if (_pViewUpdateResult) {
+        updateVisibility(visible);
+    }
+
+    if (!_extentSet) {
+        _extentSet = updateExtent();
+    }
+
+    updateLoadStatus();
+    updateStatistics();
+}
+
+void OmniTileset::updateVisibility(bool visible) {
+    _shownGeometryPaths.clear();
+    _hiddenGeometryPaths.clear();
+
+    if (!visible) {
+        // Hide everything that is currently shown
+        for (const auto pTile : _visibleTiles) {
+            setTileRendered(*pTile, false, _hiddenGeometryPaths);
+        }
+        _visibleTiles.clear();
+    } else {
+        // Hide tiles that we no longer need. A tile that was never shown doesn't need to be hidden.
+        for (const auto pTile : _pViewUpdateResult->tilesFadingOut) {
+            if (_visibleTiles.erase(pTile) > 0) {
+                setTileRendered(*pTile, false, _hiddenGeometryPaths);
             }
         }
-    }
 
-    // Update visibility for selected tiles
-    for (const auto pTile : _pViewUpdateResult->tilesToRenderThisFrame) {
-        if (pTile->getState() == Cesium3DTilesSelection::TileLoadState::Done) {
-            const auto pRenderContent = pTile->getContent().getRenderContent();
-            if (pRenderContent) {
-                const auto pRenderResources =
-                    static_cast<const FabricRenderResources*>(pRenderContent->getRenderResources());
-                if (pRenderResources) {
-                    for (const auto& fabricMesh : pRenderResources->fabricMeshes) {
-                        fabricMesh.pGeometry->setVisibility(visible);
-                    }
-                }
+        // Show newly selected tiles. A tile is only counted as shown once it's done loading.
+        for (const auto pTile : _pViewUpdateResult->tilesToRenderThisFrame) {
+            if (pTile->getState() != Cesium3DTilesSelection::TileLoadState::Done) {
+                continue;
+            }
+            if (_visibleTiles.insert(pTile).second) {
+                setTileRendered(*pTile, true, _shownGeometryPaths);
             }
         }
     }
+
+    auto& fabricStage = _pContext->getFabricStage();
+    FabricUtil::setVisibility(fabricStage, _tilesetId, _hiddenGeometryPaths, false);
+    FabricUtil::setVisibility(fabricStage, _tilesetId, _shownGeometryPaths, true);
+
+    _visibilityWrites = _hiddenGeometryPaths.size() + _shownGeometryPaths.size();
 }
 
 bool OmniTileset::updateExtent() {
@@ -0,0 +1,381 @@
+#include "cesium/omniverse/TextureCompressionUtil.h"
+
+#include <CesiumGltf/ImageCesium.h>
+#include <CesiumUtility/Tracing.h>
+#include <glm/glm.hpp>
+#include <pxr/base/work/loops.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace cesium::omniverse::TextureCompressionUtil {
+
+namespace {
+
+constexpr uint64_t BLOCK_WIDTH = 4;
+constexpr uint64_t BLOCK_PIXEL_COUNT = BLOCK_WIDTH * BLOCK_WIDTH;
+constexpr uint64_t COLOR_BLOCK_BYTE_LENGTH = 8;
+constexpr uint64_t ALPHA_BLOCK_BYTE_LENGTH = 8;
+
+// Number of block rows encoded by a single work item
+constexpr uint64_t BLOCK_ROWS_GRAIN_SIZE = 4;
+
+// Number of power iterations used to find the principal axis of a block's colors
+constexpr uint64_t PRINCIPAL_AXIS_ITERATIONS = 8;
+
+// Number of least squares refinements of the color endpoints. Stops early once the error stops decreasing.
+constexpr uint64_t REFINEMENT_ITERATIONS = 2;
+
+// The weight of color0 for each 2-bit color index. The weight of color1 is one minus this.
+constexpr std::array<double, 4> COLOR_INDEX_WEIGHTS{{1.0, 0.0, 2.0 / 3.0, 1.0 / 3.0}};
+
+using Block = std::array<glm::u8vec4, BLOCK_PIXEL_COUNT>;
+
+struct ColorBlock {
+    uint16_t color0;
+    uint16_t color1;
+    uint32_t indices;
+    double error;
+};
+
+struct AlphaBlock {
+    uint8_t alpha0;
+    uint8_t alpha1;
+    uint64_t indices;
+};
+
+Block loadBlock(const CesiumGltf::ImageCesium& image, uint64_t blockX, uint64_t blockY) {
+    const auto width = static_cast<uint64_t>(image.width);
+    const auto pPixels = reinterpret_cast<const uint8_t*>(image.pixelData.data());
+
+    Block block{};
+
+    for (uint64_t y = 0; y < BLOCK_WIDTH; ++y) {
+        for (uint64_t x = 0; x < BLOCK_WIDTH; ++x) {
+            const auto pPixel = pPixels + ((blockY * BLOCK_WIDTH + y) * width + blockX * BLOCK_WIDTH + x) * 4;
+            block[y * BLOCK_WIDTH + x] = glm::u8vec4(pPixel[0], pPixel[1], pPixel[2], pPixel[3]);
+        }
+    }
+
+    return block;
+}
+
+uint16_t toColor565(const glm::dvec3& color) {
+    const auto clamped = glm::clamp(color, 0.0, 255.0);
+    const auto r = static_cast<uint16_t>(std::lround(clamped.r * 31.0 / 255.0));
+    const auto g = static_cast<uint16_t>(std::lround(clamped.g * 63.0 / 255.0));
+    const auto b = static_cast<uint16_t>(std::lround(clamped.b * 31.0 / 255.0));
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+glm::dvec3 fromColor565(uint16_t color) {
+    const auto r = (color >> 11) & 31;
+    const auto g = (color >> 5) & 63;
+    const auto b = color & 31;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+double getDistanceSquared(const glm::dvec3& a, const glm::dvec3& b) {
+    const auto difference = a - b;
+    return glm::dot(difference, difference);
+}
+
+ColorBlock fitColorIndices(const Block& block, uint16_t color0, uint16_t color1) {
+    // Four color mode requires color0 > color1. When they're equal every pixel uses color0.
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    const auto endpoint0 = fromColor565(color0);
+    const auto endpoint1 = fromColor565(color1);
+
+    const auto palette = std::array<glm::dvec3, 4>{{
+        endpoint0,
+        endpoint1,
+        (2.0 * endpoint0 + endpoint1) / 3.0,
+        (endpoint0 + 2.0 * endpoint1) / 3.0,
+    }};
+
+    const uint64_t paletteSize = color0 == color1 ? 1 : palette.size();
+
+    ColorBlock colorBlock{color0, color1, 0, 0.0};
+
+    for (uint64_t i = 0; i < BLOCK_PIXEL_COUNT; ++i) {
+        const auto color = glm::dvec3(block[i]);
+
+        uint64_t bestIndex = 0;
+        auto bestDistance = std::numeric_limits<double>::max();
+
+        for (uint64_t j = 0; j < paletteSize; ++j) {
+            const auto distance = getDistanceSquared(color, palette[j]);
+            if (distance < bestDistance) {
+                bestIndex = j;
+                bestDistance = distance;
+            }
+        }
+
+        colorBlock.indices |= static_cast<uint32_t>(bestIndex << (2 * i));
+        colorBlock.error += bestDistance;
+    }
+
+    return colorBlock;
+}
+
+ColorBlock fitColorBlockBoundingBox(const Block& block) {
+    auto minimum = glm::dvec3(255.0);
+    auto maximum = glm::dvec3(0.0);
+
+    for (const auto& pixel : block) {
+        minimum = glm::min(minimum, glm::dvec3(pixel));
+        maximum = glm::max(maximum, glm::dvec3(pixel));
+    }
+
+    // Insetting the box by 1/16 of its size moves the endpoints toward the colors that are actually used
+    const auto inset = (maximum - minimum) / 16.0;
+
+    return fitColorIndices(block, toColor565(maximum - inset), toColor565(minimum + inset));
+}
+
+ColorBlock refineColorBlock(const Block& block, const ColorBlock& colorBlock) {
+    auto alpha2 = 0.0;
+    auto beta2 = 0.0;
+    auto alphaBeta = 0.0;
+    auto alphaX = glm::dvec3(0.0);
+    auto betaX = glm::dvec3(0.0);
+
+    for (uint64_t i = 0; i < BLOCK_PIXEL_COUNT; ++i) {
+        const auto index = (colorBlock.indices >> (2 * i)) & 3;
+        const auto alpha = COLOR_INDEX_WEIGHTS[index];
+        const auto beta = 1.0 - alpha;
+        const auto color = glm::dvec3(block[i]);
+
+        alpha2 += alpha * alpha;
+        beta2 += beta * beta;
+        alphaBeta += alpha * beta;
+        alphaX += alpha * color;
+        betaX += beta * color;
+    }
+
+    const auto determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+
+    if (std::abs(determinant) < 1e-6) {
+        // All pixels use the same index so there's nothing to solve for
+        return colorBlock;
+    }
+
+    const auto endpoint0 = (alphaX * beta2 - betaX * alphaBeta) / determinant;
+    const auto endpoint1 = (betaX * alpha2 - alphaX * alphaBeta) / determinant;
+
+    return fitColorIndices(block, toColor565(endpoint0), toColor565(endpoint1));
+}
+
+ColorBlock fitColorBlockPrincipalAxis(const Block& block) {
+    auto mean = glm::dvec3(0.0);
+    for (const auto& pixel : block) {
+        mean += glm::dvec3(pixel);
+    }
+    mean /= static_cast<double>(BLOCK_PIXEL_COUNT);
+
+    auto covariance = glm::dmat3(0.0);
+    for (const auto& pixel : block) {
+        const auto difference = glm::dvec3(pixel) - mean;
+        covariance += glm::outerProduct(difference, difference);
+    }
+
+    const auto variance = glm::dvec3(covariance[0][0], covariance[1][1], covariance[2][2]);
+
+    if (variance.x + variance.y + variance.z < 1e-6) {
+        // Every pixel is the same color
+        return fitColorIndices(block, toColor565(mean), toColor565(mean));
+    }
+
+    // Start from the column with the largest variance so that the iteration can't start orthogonal to the axis
+    auto startColumn = 0;
+    for (auto i = 1; i < 3; ++i) {
+        if (variance[i] > variance[startColumn]) {
+            startColumn = i;
+        }
+    }
+
+    auto axis = glm::normalize(covariance[startColumn]);
+
+    for (uint64_t i = 0; i < PRINCIPAL_AXIS_ITERATIONS; ++i) {
+        const auto next = covariance * axis;
+        const auto length = glm::length(next);
+        if (length < 1e-12) {
+            break;
+        }
+        axis = next / length;
+    }
+
+    auto minimum = std::numeric_limits<double>::max();
+    auto maximum = std::numeric_limits<double>::lowest();
+
+    for (const auto& pixel : block) {
+        const auto t = glm::dot(glm::dvec3(pixel) - mean, axis);
+        minimum = std::min(minimum, t);
+        maximum = std::max(maximum, t);
+    }
+
+    auto best = fitColorIndices(block, toColor565(mean + axis * maximum), toColor565(mean + axis * minimum));
+
+    for (uint64_t i = 0; i < REFINEMENT_ITERATIONS; ++i) {
+        const auto refined = refineColorBlock(block, best);
+        if (refined.error >= best.error) {
+            break;
+        }
+        best = refined;
+    }
+
+    // The bounding box is occasionally a better fit, e.g. for blocks with two dominant colors that aren't on the axis
+    const auto boundingBox = fitColorBlockBoundingBox(block);
+    return boundingBox.error < best.error ? boundingBox : best;
+}
+
+AlphaBlock fitAlphaBlock(const Block& block) {
+    uint8_t minimum = 255;
+    uint8_t maximum = 0;
+
+    for (const auto& pixel : block) {
+        minimum = std::min(minimum, pixel.a);
+        maximum = std::max(maximum, pixel.a);
+    }
+
+    if (minimum == maximum) {
+        return {maximum, minimum, 0};
+    }
+
+    // Eight alpha mode requires alpha0 > alpha1. Index 0 is alpha0, index 1 is alpha1, and indices 2-7 are
+    // interpolated from alpha0 toward alpha1.
+    std::array<int, 8> palette{};
+    palette[0] = maximum;
+    palette[1] = minimum;
+    for (int i = 1; i < 7; ++i) {
+        palette[static_cast<uint64_t>(i + 1)] = ((7 - i) * maximum + i * minimum + 3) / 7;
+    }
+
+    AlphaBlock alphaBlock{maximum, minimum, 0};
+
+    for (uint64_t i = 0; i < BLOCK_PIXEL_COUNT; ++i) {
+        const auto alpha = static_cast<int>(block[i].a);
+
+        uint64_t bestIndex = 0;
+        auto bestDistance = std::numeric_limits<int>::max();
+
+        for (uint64_t j = 0; j < palette.size(); ++j) {
+            const auto distance = std::abs(alpha - palette[j]);
+            if (distance < bestDistance) {
+                bestIndex = j;
+                bestDistance = distance;
+            }
+        }
+
+        alphaBlock.indices |= bestIndex << (3 * i);
+    }
+
+    return alphaBlock;
+}
+
+void writeColorBlock(const ColorBlock& colorBlock, std::byte* pOutput) {
+    pOutput[0] = std::byte(colorBlock.color0 & 0xFF);
+    pOutput[1] = std::byte(colorBlock.color0 >> 8);
+    pOutput[2] = std::byte(colorBlock.color1 & 0xFF);
+    pOutput[3] = std::byte(colorBlock.color1 >> 8);
+
+    for (uint64_t i = 0; i < 4; ++i) {
+        pOutput[4 + i] = std::byte((colorBlock.indices >> (8 * i)) & 0xFF);
+    }
+}
+
+void writeAlphaBlock(const AlphaBlock& alphaBlock, std::byte* pOutput) {
+    pOutput[0] = std::byte(alphaBlock.alpha0);
+    pOutput[1] = std::byte(alphaBlock.alpha1);
+
+    for (uint64_t i = 0; i < 6; ++i) {
+        pOutput[2 + i] = std::byte((alphaBlock.indices >> (8 * i)) & 0xFF);
+    }
+}
+
+bool isOpaque(const CesiumGltf::ImageCesium& image) {
+    const auto pixelCount = static_cast<uint64_t>(image.width) * static_cast<uint64_t>(image.height);
+    const auto pPixels = reinterpret_cast<const uint8_t*>(image.pixelData.data());
+
+    for (uint64_t i = 0; i < pixelCount; ++i) {
+        if (pPixels[i * 4 + 3] != 255) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool canCompressImage(const CesiumGltf::ImageCesium& image) {
+    return image.compressedPixelFormat == CesiumGltf::GpuCompressedPixelFormat::NONE && image.channels == 4 &&
+           image.bytesPerChannel == 1 && image.mipPositions.empty() && image.width > 0 && image.height > 0 &&
+           image.width % static_cast<int32_t>(BLOCK_WIDTH) == 0 &&
+           image.height % static_cast<int32_t>(BLOCK_WIDTH) == 0 &&
+           image.pixelData.size() == static_cast<uint64_t>(image.width) * static_cast<uint64_t>(image.height) * 4;
+}
+
+CesiumGltf::GpuCompressedPixelFormat getCompressedPixelFormat(const CesiumGltf::ImageCesium& image) {
+    assert(canCompressImage(image));
+
+    return isOpaque(image) ? CesiumGltf::GpuCompressedPixelFormat::BC1_RGB
+                           : CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA;
+}
+
+CesiumGltf::ImageCesium compressImage(const CesiumGltf::ImageCesium& image, TextureCompression textureCompression) {
+    CESIUM_TRACE("TextureCompressionUtil::compressImage");
+
+    assert(canCompressImage(image));
+    assert(textureCompression != TextureCompression::NONE);
+
+    const auto compressedPixelFormat = getCompressedPixelFormat(image);
+    const auto hasAlpha = compressedPixelFormat == CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA;
+    const auto blockByteLength = hasAlpha ? ALPHA_BLOCK_BYTE_LENGTH + COLOR_BLOCK_BYTE_LENGTH : COLOR_BLOCK_BYTE_LENGTH;
+    const auto blockCountX = static_cast<uint64_t>(image.width) / BLOCK_WIDTH;
+    const auto blockCountY = static_cast<uint64_t>(image.height) / BLOCK_WIDTH;
+
+    CesiumGltf::ImageCesium compressedImage;
+    compressedImage.width = image.width;
+    compressedImage.height = image.height;
+    compressedImage.channels = image.channels;
+    compressedImage.bytesPerChannel = image.bytesPerChannel;
+    compressedImage.compressedPixelFormat = compressedPixelFormat;
+    compressedImage.pixelData.resize(blockCountX * blockCountY * blockByteLength);
+
+    const auto pOutput = compressedImage.pixelData.data();
+
+    pxr::WorkParallelForN(
+        blockCountY,
+        [&](size_t begin, size_t end) {
+            for (auto blockY = begin; blockY < end; ++blockY) {
+                for (uint64_t blockX = 0; blockX < blockCountX; ++blockX) {
+                    const auto block = loadBlock(image, blockX, blockY);
+                    const auto colorBlock = textureCompression == TextureCompression::QUALITY
+                                                ? fitColorBlockPrincipalAxis(block)
+                                                : fitColorBlockBoundingBox(block);
+
+                    auto pBlockOutput = pOutput + (blockY * blockCountX + blockX) * blockByteLength;
+
+                    // In BC3 the alpha block comes before the color block
+                    if (hasAlpha) {
+                        writeAlphaBlock(fitAlphaBlock(block), pBlockOutput);
+                        pBlockOutput += ALPHA_BLOCK_BYTE_LENGTH;
+                    }
+
+                    writeColorBlock(colorBlock, pBlockOutput);
+                }
+            }
+        },
+        BLOCK_ROWS_GRAIN_SIZE);
+
+    return compressedImage;
+}
+
+} // namespace cesium::omniverse::TextureCompressionUtil
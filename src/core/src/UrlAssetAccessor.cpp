@@ -27,14 +27,25 @@ SOFTWARE.
 #include "cesium/omniverse/UrlAssetAccessor.h"
 
 #include <CesiumAsync/IAssetResponse.h>
+#include <CesiumAsync/Promise.h>
 #include <CesiumUtility/Tracing.h>
 #include <omni/kit/IApp.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <thread>
+#include <unordered_map>
 
 namespace cesium::omniverse {
 const auto CURL_BUFFERSIZE = 3145728L; // 3 MiB
+const auto CURL_MAXCONNECTS = 20L;
+const auto CURL_MULTI_POLL_TIMEOUT_MS = 100;
+const uint64_t MAX_RESERVED_RESPONSE_SIZE = 1ULL << 30; // 1 GiB
+
+using RequestPromise = CesiumAsync::Promise<std::shared_ptr<CesiumAsync::IAssetRequest>>;
 
 class UrlAssetResponse final : public CesiumAsync::IAssetResponse {
   public:
@@ -57,6 +68,7 @@ class UrlAssetResponse final : public CesiumAsync::IAssetResponse {
     static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userData);
     static size_t dataCallback(char* buffer, size_t size, size_t nitems, void* userData);
     void setCallbacks(CURL* curl);
+    void reserve(const std::string& contentLength);
     uint16_t _statusCode = 0;
     std::string _contentType;
     CesiumAsync::HttpHeaders _headers;
@@ -116,6 +128,23 @@ class UrlAssetRequest final : public CesiumAsync::IAssetRequest {
     std::unique_ptr<UrlAssetResponse> _response;
 };
 
+namespace {
+bool isContentLength(const std::string& key) {
+    const std::string contentLength = "content-length";
+    return std::equal(key.begin(), key.end(), contentLength.begin(), contentLength.end(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    });
+}
+} // namespace
+
+void UrlAssetResponse::reserve(const std::string& contentLength) {
+    // Pre-size the buffer so that the body can be appended without reallocating. With compression the
+    // decoded body may be larger than Content-Length, in which case the buffer still grows as needed.
+    // Responses without a Content-Length (e.g. chunked) fall back to geometric growth.
+    const auto size = std::strtoull(contentLength.c_str(), nullptr, 10);
+    _result.reserve(std::min(static_cast<uint64_t>(size), MAX_RESERVED_RESPONSE_SIZE));
+}
+
 size_t UrlAssetResponse::headerCallback(char* buffer, size_t size, size_t nitems, void* userData) {
     // size is supposed to always be 1, but who knows
     const size_t cnt = size * nitems;
@@ -130,7 +159,11 @@ size_t UrlAssetResponse::headerCallback(char* buffer, size_t size, size_t nitems
         while (value < end && *value == ' ') {
             ++value;
         }
-        response->_headers.insert({std::string(buffer, colon), std::string(value, end)});
+        std::string key(buffer, colon);
+        if (isContentLength(key)) {
+            response->reserve(std::string(value, end));
+        }
+        response->_headers.insert({std::move(key), std::string(value, end)});
         auto contentTypeItr = response->_headers.find("content-type");
         if (contentTypeItr != response->_headers.end()) {
             response->_contentType = contentTypeItr->second;
@@ -145,9 +178,8 @@ size_t UrlAssetResponse::dataCallback(char* buffer, size_t size, size_t nitems,
     if (!response) {
         return cnt;
     }
-    std::transform(buffer, buffer + cnt, std::back_inserter(response->_result), [](char c) {
-        return std::byte{static_cast<unsigned char>(c)};
-    });
+    const auto pBytes = reinterpret_cast<const std::byte*>(buffer);
+    response->_result.insert(response->_result.end(), pBytes, pBytes + cnt);
     return cnt;
 }
 } //namespace cesium::omniverse
@@ -168,14 +200,202 @@ void UrlAssetResponse::setCallbacks(CURL* curl) {
     curl_easy_setopt(curl, CURLOPT_HEADERDATA, this);
 }
 
-UrlAssetAccessor::UrlAssetAccessor(const std::filesystem::path& certificatePath)
+namespace {
+
+void setPayload(CURL* curl, const std::string& verb, const std::vector<std::byte>& payload) {
+    if (payload.size() > 1UL << 31) {
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, payload.size());
+    } else {
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, payload.size());
+    }
+    curl_easy_setopt(curl, CURLOPT_COPYPOSTFIELDS, reinterpret_cast<const char*>(payload.data()));
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, verb.c_str());
+}
+
+void finishRequest(
+    CURL* curl,
+    CURLcode responseCode,
+    const std::shared_ptr<UrlAssetRequest>& request,
+    std::unique_ptr<UrlAssetResponse> response,
+    const RequestPromise& promise) {
+    if (responseCode == 0) {
+        long httpResponseCode = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpResponseCode);
+        response->_statusCode = static_cast<uint16_t>(httpResponseCode);
+        // The response header callback also sets _contentType, so not sure that this is
+        // necessary...
+        char* ct = nullptr;
+        curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &ct);
+        if (ct) {
+            response->_contentType = ct;
+        }
+        request->setResponse(std::move(response));
+        promise.resolve(request);
+    } else {
+        std::string curlMsg("curl: ");
+        curlMsg += curl_easy_strerror(responseCode);
+        promise.reject(std::runtime_error(curlMsg));
+    }
+}
+
+} // namespace
+
+// Drives all transfers through a single curl multi handle on a dedicated I/O thread. Easy handles
+// are configured on the calling thread and handed to the I/O thread, which resolves the promises
+// as transfers complete. No worker threads are consumed while waiting on the network.
+class CurlMultiLoop {
+  public:
+    CurlMultiLoop(UrlAssetAccessor* accessor_)
+        : _accessor(accessor_)
+        , _multi(curl_multi_init()) {
+        curl_multi_setopt(_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(_multi, CURLMOPT_MAXCONNECTS, CURL_MAXCONNECTS);
+        curl_multi_setopt(_multi, CURLMOPT_MAX_HOST_CONNECTIONS, CURL_MAXCONNECTS);
+        _thread = std::thread([this]() { run(); });
+    }
+
+    ~CurlMultiLoop() {
+        _stopped = true;
+        curl_multi_wakeup(_multi);
+        _thread.join();
+
+        for (auto& [curl, pTransfer] : _activeTransfers) {
+            curl_multi_remove_handle(_multi, curl);
+            cancelTransfer(*pTransfer);
+        }
+
+        for (auto& pTransfer : _queuedTransfers) {
+            cancelTransfer(*pTransfer);
+        }
+
+        curl_multi_cleanup(_multi);
+    }
+
+    CurlMultiLoop(const CurlMultiLoop&) = delete;
+    CurlMultiLoop& operator=(const CurlMultiLoop&) = delete;
+    CurlMultiLoop(CurlMultiLoop&&) noexcept = delete;
+    CurlMultiLoop& operator=(CurlMultiLoop&&) noexcept = delete;
+
+    void enqueue(
+        const std::shared_ptr<UrlAssetRequest>& request,
+        const std::vector<std::byte>* pPayload,
+        const RequestPromise& promise) {
+        auto curl = _accessor->curlCache.get();
+        auto list = _accessor->setCommonOptions(curl, request->url(), request->headers());
+
+        if (pPayload) {
+            setPayload(curl, request->method(), *pPayload);
+        }
+
+        // Prefer waiting for an existing HTTP/2 connection over opening a new one
+        curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+
+        auto response = std::make_unique<UrlAssetResponse>();
+        response->setCallbacks(curl);
+
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            _queuedTransfers.push_back(std::make_unique<Transfer>(Transfer{
+                curl,
+                list,
+                request,
+                std::move(response),
+                promise,
+            }));
+        }
+
+        curl_multi_wakeup(_multi);
+    }
+
+  private:
+    struct Transfer {
+        CURL* curl;
+        curl_slist* list;
+        std::shared_ptr<UrlAssetRequest> request;
+        std::unique_ptr<UrlAssetResponse> response;
+        RequestPromise promise;
+    };
+
+    void run() {
+        while (!_stopped) {
+            addQueuedTransfers();
+
+            int runningTransfers = 0;
+            curl_multi_perform(_multi, &runningTransfers);
+
+            int messagesInQueue = 0;
+            while (auto pMessage = curl_multi_info_read(_multi, &messagesInQueue)) {
+                if (pMessage->msg == CURLMSG_DONE) {
+                    finishTransfer(pMessage->easy_handle, pMessage->data.result);
+                }
+            }
+
+            // Sleeps until there is socket activity, a new transfer is queued, or the timeout expires
+            curl_multi_poll(_multi, nullptr, 0, CURL_MULTI_POLL_TIMEOUT_MS, nullptr);
+        }
+    }
+
+    void addQueuedTransfers() {
+        std::vector<std::unique_ptr<Transfer>> queuedTransfers;
+
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            queuedTransfers.swap(_queuedTransfers);
+        }
+
+        for (auto& pTransfer : queuedTransfers) {
+            const auto curl = pTransfer->curl;
+            curl_multi_add_handle(_multi, curl);
+            _activeTransfers.emplace(curl, std::move(pTransfer));
+        }
+    }
+
+    void finishTransfer(CURL* curl, CURLcode responseCode) {
+        CESIUM_TRACE("UrlAssetAccessor::finishTransfer");
+
+        const auto iter = _activeTransfers.find(curl);
+        if (iter == _activeTransfers.end()) {
+            return;
+        }
+
+        auto pTransfer = std::move(iter->second);
+        _activeTransfers.erase(iter);
+
+        curl_multi_remove_handle(_multi, curl);
+        curl_slist_free_all(pTransfer->list);
+        finishRequest(curl, responseCode, pTransfer->request, std::move(pTransfer->response), pTransfer->promise);
+        _accessor->curlCache.release(curl);
+    }
+
+    void cancelTransfer(Transfer& transfer) {
+        curl_slist_free_all(transfer.list);
+        transfer.promise.reject(std::runtime_error("curl: request cancelled"));
+        _accessor->curlCache.release(transfer.curl);
+    }
+
+    UrlAssetAccessor* _accessor;
+    CURLM* _multi;
+    std::mutex _queueMutex;
+    std::vector<std::unique_ptr<Transfer>> _queuedTransfers;
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> _activeTransfers;
+    std::atomic<bool> _stopped{false};
+    std::thread _thread;
+};
+
+UrlAssetAccessor::UrlAssetAccessor(const std::filesystem::path& certificatePath, bool useMultiHandle)
     : userAgent("Mozilla/5.0 Cesium for Omniverse")
     , _certificatePath(certificatePath.generic_string()) {
     // XXX Do we need to worry about the thread safety problems with this?
     curl_global_init(CURL_GLOBAL_ALL);
+
+    if (useMultiHandle) {
+        _pMultiLoop = std::make_unique<CurlMultiLoop>(this);
+    }
 }
 
 UrlAssetAccessor::~UrlAssetAccessor() {
+    // The I/O thread must be stopped before curl is cleaned up
+    _pMultiLoop = nullptr;
     curl_global_cleanup();
 }
 
@@ -190,7 +410,7 @@ UrlAssetAccessor::setCommonOptions(CURL* curl, const std::string& url, const Ces
     }
     curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
     curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, CURL_BUFFERSIZE);
-    curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, 20L);
+    curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, CURL_MAXCONNECTS);
     curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 300L);
     // curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
     curl_slist* list = nullptr;
@@ -234,6 +454,12 @@ CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> UrlAssetAccesso
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers) {
     return asyncSystem.createFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>([&](const auto& promise) {
         std::shared_ptr<UrlAssetRequest> request = std::make_shared<UrlAssetRequest>("GET", url, headers);
+
+        if (_pMultiLoop) {
+            _pMultiLoop->enqueue(request, nullptr, promise);
+            return;
+        }
+
         asyncSystem.runInWorkerThread([promise, request, this]() {
             CESIUM_TRACE("UrlAssetAccessor::get");
             CurlHandle curl(this);
@@ -242,24 +468,7 @@ CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> UrlAssetAccesso
             response->setCallbacks(curl());
             CURLcode responseCode = curl_easy_perform(curl());
             curl_slist_free_all(list);
-            if (responseCode == 0) {
-                long httpResponseCode = 0;
-                curl_easy_getinfo(curl(), CURLINFO_RESPONSE_CODE, &httpResponseCode);
-                response->_statusCode = static_cast<uint16_t>(httpResponseCode);
-                // The response header callback also sets _contentType, so not sure that this is
-                // necessary...
-                char* ct = nullptr;
-                curl_easy_getinfo(curl(), CURLINFO_CONTENT_TYPE, &ct);
-                if (ct) {
-                    response->_contentType = ct;
-                }
-                request->setResponse(std::move(response));
-                promise.resolve(request);
-            } else {
-                std::string curlMsg("curl: ");
-                curlMsg += curl_easy_strerror(responseCode);
-                promise.reject(std::runtime_error(curlMsg));
-            }
+            finishRequest(curl(), responseCode, request, std::move(response), promise);
         });
     });
 }
@@ -275,38 +484,23 @@ CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> UrlAssetAccesso
     return asyncSystem.createFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>([&](const auto& promise) {
         auto request = std::make_shared<UrlAssetRequest>(verb, url, headers);
         auto payloadCopy = std::make_shared<std::vector<std::byte>>(contentPayload.begin(), contentPayload.end());
+
+        if (_pMultiLoop) {
+            _pMultiLoop->enqueue(request, payloadCopy.get(), promise);
+            return;
+        }
+
         asyncSystem.runInWorkerThread([promise, request, payloadCopy, this]() {
             CESIUM_TRACE("UrlAssetAccessor::request");
             CurlHandle curl(this);
 
             curl_slist* list = setCommonOptions(curl(), request->url(), request->headers());
-            if (payloadCopy->size() > 1UL << 31) {
-                curl_easy_setopt(curl(), CURLOPT_POSTFIELDSIZE_LARGE, payloadCopy->size());
-            } else {
-                curl_easy_setopt(curl(), CURLOPT_POSTFIELDSIZE, payloadCopy->size());
-            }
-            curl_easy_setopt(curl(), CURLOPT_COPYPOSTFIELDS, reinterpret_cast<const char*>(payloadCopy->data()));
-            curl_easy_setopt(curl(), CURLOPT_CUSTOMREQUEST, request->method().c_str());
+            setPayload(curl(), request->method(), *payloadCopy);
             std::unique_ptr<UrlAssetResponse> response = std::make_unique<UrlAssetResponse>();
             response->setCallbacks(curl());
             CURLcode responseCode = curl_easy_perform(curl());
             curl_slist_free_all(list);
-            if (responseCode == 0) {
-                long httpResponseCode = 0;
-                curl_easy_getinfo(curl(), CURLINFO_RESPONSE_CODE, &httpResponseCode);
-                response->_statusCode = static_cast<uint16_t>(httpResponseCode);
-                char* ct = nullptr;
-                curl_easy_getinfo(curl(), CURLINFO_CONTENT_TYPE, &ct);
-                if (ct) {
-                    response->_contentType = ct;
-                }
-                request->setResponse(std::move(response));
-                promise.resolve(request);
-            } else {
-                std::string curlMsg("curl: ");
-                curlMsg += curl_easy_strerror(responseCode);
-                promise.reject(std::runtime_error(curlMsg));
-            }
+            finishRequest(curl(), responseCode, request, std::move(response), promise);
         });
     });
 }
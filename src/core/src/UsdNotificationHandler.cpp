@@ -19,26 +19,47 @@
 #include "cesium/omniverse/UsdTokens.h"
 #include "cesium/omniverse/UsdUtil.h"
 
+#include <CesiumUsdSchemas/data.h>
+#include <CesiumUsdSchemas/georeference.h>
+#include <CesiumUsdSchemas/globeAnchorAPI.h>
+#include <CesiumUsdSchemas/ionRasterOverlay.h>
+#include <CesiumUsdSchemas/ionServer.h>
+#include <CesiumUsdSchemas/polygonRasterOverlay.h>
+#include <CesiumUsdSchemas/tileMapServiceRasterOverlay.h>
+#include <CesiumUsdSchemas/tileset.h>
 #include <CesiumUsdSchemas/tokens.h>
+#include <CesiumUsdSchemas/webMapServiceRasterOverlay.h>
+#include <CesiumUsdSchemas/webMapTileServiceRasterOverlay.h>
 #include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/basisCurves.h>
+#include <pxr/usd/usdGeom/xformable.h>
 #include <pxr/usd/usdShade/shader.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace cesium::omniverse {
 
 namespace {
 
-bool isPrimOrDescendant(const pxr::SdfPath& descendantPath, const pxr::SdfPath& path) {
-    if (descendantPath == path) {
-        return true;
-    }
-
-    for (const auto& ancestorPath : descendantPath.GetAncestorsRange()) {
-        if (ancestorPath == path) {
-            return true;
-        }
-    }
-
-    return false;
+struct SchemaTypes {
+    pxr::TfType data{pxr::TfType::Find<pxr::CesiumData>()};
+    pxr::TfType tileset{pxr::TfType::Find<pxr::CesiumTileset>()};
+    pxr::TfType ionRasterOverlay{pxr::TfType::Find<pxr::CesiumIonRasterOverlay>()};
+    pxr::TfType polygonRasterOverlay{pxr::TfType::Find<pxr::CesiumPolygonRasterOverlay>()};
+    pxr::TfType webMapServiceRasterOverlay{pxr::TfType::Find<pxr::CesiumWebMapServiceRasterOverlay>()};
+    pxr::TfType tileMapServiceRasterOverlay{pxr::TfType::Find<pxr::CesiumTileMapServiceRasterOverlay>()};
+    pxr::TfType webMapTileServiceRasterOverlay{pxr::TfType::Find<pxr::CesiumWebMapTileServiceRasterOverlay>()};
+    pxr::TfType georeference{pxr::TfType::Find<pxr::CesiumGeoreference>()};
+    pxr::TfType ionServer{pxr::TfType::Find<pxr::CesiumIonServer>()};
+    pxr::TfType basisCurves{pxr::TfType::Find<pxr::UsdGeomBasisCurves>()};
+    pxr::TfType shader{pxr::TfType::Find<pxr::UsdShadeShader>()};
+};
+
+const SchemaTypes& getSchemaTypes() {
+    // TfType::Find takes a lock so the types are looked up once
+    static const SchemaTypes schemaTypes;
+    return schemaTypes;
 }
 
 void updateRasterOverlayBindings(const Context& context, const pxr::SdfPath& rasterOverlayPath) {
@@ -91,7 +112,12 @@ void updateCartographicPolygonBindings(const Context& context, const pxr::SdfPat
 }
 
 void updateGlobeAnchorBindings(const Context& context, const pxr::SdfPath& globeAnchorPath) {
-    // Don't need to update tilesets. Globe anchor changes are handled automatically in the update loop.
+    // Globe anchor transform changes are picked up by onTransformChanged. Adding or removing a globe anchor from a
+    // tileset changes which georeference the tileset resolves to so its transform needs to be recomputed.
+    const auto pTileset = context.getAssetRegistry().getTileset(globeAnchorPath);
+    if (pTileset) {
+        pTileset->markTransformDirty();
+    }
 
     if (context.getAssetRegistry().getCartographicPolygon(globeAnchorPath)) {
         // Update cartographic polygon that this globe anchor is attached to
@@ -100,7 +126,11 @@ void updateGlobeAnchorBindings(const Context& context, const pxr::SdfPath& globe
 }
 
 void updateGeoreferenceBindings(const Context& context) {
-    // Don't need to update tilesets. Georeference changes are handled automatically in the update loop.
+    // Update all tilesets. Some tilesets may have referenced this georeference implicitly.
+    const auto& tilesets = context.getAssetRegistry().getTilesets();
+    for (const auto& pTileset : tilesets) {
+        pTileset->markTransformDirty();
+    }
 
     // Update all globe anchors. Some globe anchors may have referenced this georeference implicitly.
     const auto& globeAnchors = context.getAssetRegistry().getGlobeAnchors();
@@ -133,6 +163,8 @@ bool isFirstData(const Context& context, const pxr::SdfPath& dataPath) {
     // * selectedIonServer
     // * projectDefaultIonAccessToken (deprecated)
     // * projectDefaultIonAccessTokenId (deprecated)
+    // * debugVerifyRenderStatistics (read whenever render statistics are requested)
+    // * debugPipelinedTileSelection (read every frame)
 
     for (const auto& property : properties) {
         if (property == pxr::CesiumTokens->cesiumDebugDisableMaterials ||
@@ -143,6 +175,9 @@ bool isFirstData(const Context& context, const pxr::SdfPath& dataPath) {
             property == pxr::CesiumTokens->cesiumDebugGeometryPoolInitialCapacity ||
             property == pxr::CesiumTokens->cesiumDebugMaterialPoolInitialCapacity ||
             property == pxr::CesiumTokens->cesiumDebugTexturePoolInitialCapacity ||
+            property == pxr::CesiumTokens->cesiumDebugPoolGrowthFactor ||
+            property == pxr::CesiumTokens->cesiumDebugPoolLowWaterMark ||
+            property == pxr::CesiumTokens->cesiumDebugPoolMaximumIdleTime ||
             property == pxr::CesiumTokens->cesiumDebugRandomColors) {
             reloadStage = true;
         } else if (property == pxr::CesiumTokens->cesiumDebugDisableGeoreferencing) {
@@ -247,11 +282,11 @@ void processCesiumTilesetChanged(
     auto reload = false;
     auto updateTilesetOptions = false;
     auto updateDisplayColorAndOpacity = false;
+    auto updateTransform = false;
 
     // No change tracking needed for
     // * suspendUpdate
-    // * georeferenceBinding
-    // * Transform changes (handled automatically in update loop)
+    // * Transform changes (handled by onTransformChanged)
 
     // clang-format off
     for (const auto& property : properties) {
@@ -261,7 +296,10 @@ void processCesiumTilesetChanged(
             property == pxr::CesiumTokens->cesiumIonAccessToken ||
             property == pxr::CesiumTokens->cesiumIonServerBinding ||
             property == pxr::CesiumTokens->cesiumSmoothNormals ||
+            property == pxr::CesiumTokens->cesiumRenderPointsAsVoxels ||
+            property == pxr::CesiumTokens->cesiumMergePrimitives ||
             property == pxr::CesiumTokens->cesiumShowCreditsOnScreen ||
+            property == pxr::CesiumTokens->cesiumTextureCompression ||
             property == pxr::CesiumTokens->cesiumRasterOverlayBinding ||
             property == pxr::UsdTokens->material_binding) {
             reload = true;
@@ -283,6 +321,8 @@ void processCesiumTilesetChanged(
             property == pxr::UsdTokens->primvars_displayColor ||
             property == pxr::UsdTokens->primvars_displayOpacity) {
             updateDisplayColorAndOpacity = true;
+        } else if (property == pxr::CesiumTokens->cesiumGeoreferenceBinding) {
+            updateTransform = true;
         }
     }
     // clang-format on
@@ -291,6 +331,10 @@ void processCesiumTilesetChanged(
         pTileset->reload();
     }
 
+    if (updateTransform) {
+        pTileset->markTransformDirty();
+    }
+
     if (updateTilesetOptions) {
         pTileset->updateTilesetOptions();
     }
@@ -315,7 +359,8 @@ void processCesiumRasterOverlayChanged(
     auto updateRasterOverlayOptions = false;
 
     for (const auto& property : properties) {
-        if (property == pxr::CesiumTokens->cesiumShowCreditsOnScreen) {
+        if (property == pxr::CesiumTokens->cesiumShowCreditsOnScreen ||
+            property == pxr::CesiumTokens->cesiumTextureCompression) {
             reload = true;
             updateBindings = true;
         } else if (property == pxr::CesiumTokens->cesiumOverlayRenderMethod) {
@@ -605,7 +650,7 @@ void processCesiumCartographicPolygonChanged(
 }
 
 void processUsdShaderChanged(
-    const Context& context,
+    Context& context,
     const pxr::SdfPath& shaderPath,
     const std::vector<pxr::TfToken>& properties) {
     const auto usdShader = UsdUtil::getUsdShader(context.getUsdStage(), shaderPath);
@@ -850,7 +895,7 @@ UsdNotificationHandler::~UsdNotificationHandler() {
 void UsdNotificationHandler::onStageLoaded() {
     // Insert prims manually since USD doesn't notify us about changes when the stage is first loaded
     for (const auto& prim : _pContext->getUsdStage()->Traverse()) {
-        const auto type = getTypeFromStage(prim.GetPath());
+        const auto type = getTypeFromPrim(prim);
         if (type != ChangedPrimType::OTHER) {
             insertAddedPrim(prim.GetPath(), type);
         }
@@ -863,6 +908,9 @@ void UsdNotificationHandler::onStageLoaded() {
 void UsdNotificationHandler::onUpdateFrame() {
     const auto reloadStage = processChangedPrims();
 
+    // Processed after the changed prims since updating globe anchors may move tilesets
+    processTransformChangedPaths();
+
     if (reloadStage) {
         _pContext->reloadStage();
     }
@@ -870,6 +918,28 @@ void UsdNotificationHandler::onUpdateFrame() {
 
 void UsdNotificationHandler::clear() {
     _changedPrims.clear();
+    _addedPrimPaths.clear();
+    _transformChangedPaths.clear();
+}
+
+void UsdNotificationHandler::processTransformChangedPaths() {
+    if (_transformChangedPaths.empty()) {
+        return;
+    }
+
+    // A change to a prim's transform affects the world transform of all its descendants
+    const auto& tilesets = _pContext->getAssetRegistry().getTilesets();
+    for (const auto& pTileset : tilesets) {
+        const auto& tilesetPath = pTileset->getPath();
+        for (const auto& path : _transformChangedPaths) {
+            if (tilesetPath.HasPrefix(path)) {
+                pTileset->markTransformDirty();
+                break;
+            }
+        }
+    }
+
+    _transformChangedPaths.clear();
 }
 
 bool UsdNotificationHandler::processChangedPrims() {
@@ -899,6 +969,7 @@ bool UsdNotificationHandler::processChangedPrims() {
     }
 
     _changedPrims.clear();
+    _addedPrimPaths.clear();
 
     auto reloadStage = false;
 
@@ -1055,6 +1126,11 @@ void UsdNotificationHandler::onObjectsChanged(const pxr::UsdNotice::ObjectsChang
 
     const auto resyncedPaths = objectsChanged.GetResyncedPaths();
     for (const auto& path : resyncedPaths) {
+        if (path.IsAbsoluteRootOrPrimPath()) {
+            // Prims that are added, removed, or reparented may change the transform of tilesets below them
+            onTransformChanged(path);
+        }
+
         if (path.IsPrimPath()) {
             if (UsdUtil::primExists(_pContext->getUsdStage(), path)) {
                 // A prim is resynced when it is added to the stage or when an API schema is applied to it, e.g. when
@@ -1074,114 +1150,83 @@ void UsdNotificationHandler::onObjectsChanged(const pxr::UsdNotice::ObjectsChang
     for (const auto& path : changedPaths) {
         if (path.IsPropertyPath()) {
             onPropertyChanged(path);
+        } else if (path.IsAbsoluteRootPath()) {
+            // Stage metadata such as upAxis and metersPerUnit affects the transform of every tileset
+            onTransformChanged(path);
         }
     }
 }
 
 void UsdNotificationHandler::onPrimAdded(const pxr::SdfPath& primPath) {
-    const auto type = getTypeFromStage(primPath);
+    onPrimAdded(_pContext->getUsdStage()->GetPrimAtPath(primPath));
+}
+
+void UsdNotificationHandler::onPrimAdded(const pxr::UsdPrim& prim) {
+    const auto type = getTypeFromPrim(prim);
     if (type != ChangedPrimType::OTHER) {
-        insertAddedPrim(primPath, type);
+        insertAddedPrim(prim.GetPath(), type);
     }
 
     // USD only notifies us about the top-most prim being added. Find all descendant prims
     // and add those as well (recursively)
-    const auto prim = _pContext->getUsdStage()->GetPrimAtPath(primPath);
     for (const auto& child : prim.GetAllChildren()) {
-        onPrimAdded(child.GetPath());
+        onPrimAdded(child);
     }
 }
 
 void UsdNotificationHandler::onPrimRemoved(const pxr::SdfPath& primPath) {
     // USD only notifies us about the top-most prim being removed. Find all descendant prims
     // and remove those as well. Since the prims no longer exist on the stage we need
-    // to look the paths in _changedPrims and the asset registry.
+    // to look the paths up in the pending added prims and the asset registry. Both are
+    // indexed by path so this only visits the removed subtree.
+    std::vector<std::pair<pxr::SdfPath, ChangedPrimType>> removedPrims;
 
     // Remove prims that haven't been added to asset registry yet
-    // This needs to be an index-based for loop since _changedPrims can grow in size
-    const auto changedPrimsCount = _changedPrims.size();
-    for (uint64_t i = 0; i < changedPrimsCount; ++i) {
-        if (_changedPrims[i].changedType == ChangedType::PRIM_ADDED) {
-            if (isPrimOrDescendant(_changedPrims[i].primPath, primPath)) {
-                insertRemovedPrim(_changedPrims[i].primPath, _changedPrims[i].primType);
-            }
-        }
-    }
+    _addedPrimPaths.forEachPrimOrDescendant(primPath, [&removedPrims](const pxr::SdfPath& path, ChangedPrimType type) {
+        removedPrims.emplace_back(path, type);
+    });
 
     // Remove prims in the asset registry
-    const auto& tilesets = _pContext->getAssetRegistry().getTilesets();
-    for (const auto& pTileset : tilesets) {
-        const auto tilesetPath = pTileset->getPath();
-        if (isPrimOrDescendant(tilesetPath, primPath)) {
-            insertRemovedPrim(tilesetPath, ChangedPrimType::CESIUM_TILESET);
-        }
-    }
-
-    const auto& ionRasterOverlays = _pContext->getAssetRegistry().getIonRasterOverlays();
-    for (const auto& pIonRasterOverlay : ionRasterOverlays) {
-        const auto ionRasterOverlayPath = pIonRasterOverlay->getPath();
-        if (isPrimOrDescendant(ionRasterOverlayPath, primPath)) {
-            insertRemovedPrim(ionRasterOverlayPath, ChangedPrimType::CESIUM_ION_RASTER_OVERLAY);
-        }
-    }
-
-    const auto& polygonRasterOverlays = _pContext->getAssetRegistry().getPolygonRasterOverlays();
-    for (const auto& pPolygonRasterOverlay : polygonRasterOverlays) {
-        const auto polygonRasterOverlayPath = pPolygonRasterOverlay->getPath();
-        if (isPrimOrDescendant(polygonRasterOverlayPath, primPath)) {
-            insertRemovedPrim(polygonRasterOverlayPath, ChangedPrimType::CESIUM_POLYGON_RASTER_OVERLAY);
-        }
-    }
-
-    const auto& georeferences = _pContext->getAssetRegistry().getGeoreferences();
-    for (const auto& pGeoreference : georeferences) {
-        const auto georeferencePath = pGeoreference->getPath();
-        if (isPrimOrDescendant(georeferencePath, primPath)) {
-            insertRemovedPrim(georeferencePath, ChangedPrimType::CESIUM_GEOREFERENCE);
-        }
-    }
-
-    const auto& ionServers = _pContext->getAssetRegistry().getIonServers();
-    for (const auto& pIonServer : ionServers) {
-        const auto ionServerPath = pIonServer->getPath();
-        if (isPrimOrDescendant(ionServerPath, primPath)) {
-            insertRemovedPrim(ionServerPath, ChangedPrimType::CESIUM_ION_SERVER);
+    for (const auto& path : _pContext->getAssetRegistry().getPrimOrDescendantAssetPaths(primPath)) {
+        const auto type = getTypeFromAssetRegistry(path);
+        if (type != ChangedPrimType::OTHER) {
+            removedPrims.emplace_back(path, type);
         }
     }
 
-    const auto& cartographicPolygons = _pContext->getAssetRegistry().getCartographicPolygons();
-    for (const auto& pCartographicPolygon : cartographicPolygons) {
-        const auto cartographicPolygonPath = pCartographicPolygon->getPath();
-        if (isPrimOrDescendant(cartographicPolygonPath, primPath)) {
-            insertRemovedPrim(cartographicPolygonPath, ChangedPrimType::CESIUM_CARTOGRAPHIC_POLYGON);
-        }
-    }
+    // Remove tilesets before the raster overlays, georeferences, and globe anchors they depend on
+    std::stable_sort(removedPrims.begin(), removedPrims.end(), [](const auto& a, const auto& b) {
+        return a.second == ChangedPrimType::CESIUM_TILESET && b.second != ChangedPrimType::CESIUM_TILESET;
+    });
 
-    const auto& globeAnchors = _pContext->getAssetRegistry().getGlobeAnchors();
-    for (const auto& pGlobeAnchor : globeAnchors) {
-        const auto globeAnchorPath = pGlobeAnchor->getPath();
-        const auto type = getTypeFromAssetRegistry(globeAnchorPath);
-        if (type == ChangedPrimType::CESIUM_GLOBE_ANCHOR) {
-            // Make sure it's not one of the types previously handled (e.g. cartographic polygon or tileset)
-            if (isPrimOrDescendant(globeAnchorPath, primPath)) {
-                insertRemovedPrim(globeAnchorPath, ChangedPrimType::CESIUM_GLOBE_ANCHOR);
-            }
-        }
+    for (const auto& [path, type] : removedPrims) {
+        insertRemovedPrim(path, type);
     }
 }
 
 void UsdNotificationHandler::onPropertyChanged(const pxr::SdfPath& propertyPath) {
     const auto& propertyName = propertyPath.GetNameToken();
     const auto primPath = propertyPath.GetPrimPath();
+
+    // Transform changes are tracked for all prims, not just Cesium prims, since ancestor prims affect tilesets too
+    if (pxr::UsdGeomXformable::IsTransformationAffectedByAttrNamed(propertyName)) {
+        onTransformChanged(primPath);
+    }
+
     const auto type = getTypeFromStage(primPath);
     if (type != ChangedPrimType::OTHER) {
         insertPropertyChanged(primPath, type, propertyName);
     }
 }
 
+void UsdNotificationHandler::onTransformChanged(const pxr::SdfPath& path) {
+    _transformChangedPaths.push_back(path);
+}
+
 void UsdNotificationHandler::insertAddedPrim(const pxr::SdfPath& primPath, ChangedPrimType primType) {
     // In C++ 20 this can be emplace_back without the {}
     _changedPrims.push_back({primPath, {}, primType, ChangedType::PRIM_ADDED});
+    _addedPrimPaths.insert(primPath) = primType;
 }
 
 void UsdNotificationHandler::insertRemovedPrim(const pxr::SdfPath& primPath, ChangedPrimType primType) {
@@ -1198,29 +1243,45 @@ void UsdNotificationHandler::insertPropertyChanged(
 }
 
 UsdNotificationHandler::ChangedPrimType UsdNotificationHandler::getTypeFromStage(const pxr::SdfPath& path) const {
-    if (UsdUtil::isCesiumData(_pContext->getUsdStage(), path)) {
+    return getTypeFromPrim(_pContext->getUsdStage()->GetPrimAtPath(path));
+}
+
+UsdNotificationHandler::ChangedPrimType UsdNotificationHandler::getTypeFromPrim(const pxr::UsdPrim& prim) const {
+    if (!prim.IsValid()) {
+        return ChangedPrimType::OTHER;
+    }
+
+    // Compare the prim's schema type directly instead of fetching the prim and calling IsA for each candidate type
+    const auto& schemaTypes = getSchemaTypes();
+    const auto& schemaType = prim.GetPrimTypeInfo().GetSchemaType();
+
+    if (schemaType == schemaTypes.data) {
         return ChangedPrimType::CESIUM_DATA;
-    } else if (UsdUtil::isCesiumTileset(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.tileset) {
         return ChangedPrimType::CESIUM_TILESET;
-    } else if (UsdUtil::isCesiumIonRasterOverlay(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.ionRasterOverlay) {
         return ChangedPrimType::CESIUM_ION_RASTER_OVERLAY;
-    } else if (UsdUtil::isCesiumPolygonRasterOverlay(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.polygonRasterOverlay) {
         return ChangedPrimType::CESIUM_POLYGON_RASTER_OVERLAY;
-    } else if (UsdUtil::isCesiumWebMapServiceRasterOverlay(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.webMapServiceRasterOverlay) {
         return ChangedPrimType::CESIUM_WEB_MAP_SERVICE_RASTER_OVERLAY;
-    } else if (UsdUtil::isCesiumTileMapServiceRasterOverlay(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.tileMapServiceRasterOverlay) {
         return ChangedPrimType::CESIUM_TILE_MAP_SERVICE_RASTER_OVERLAY;
-    } else if (UsdUtil::isCesiumWebMapTileServiceRasterOverlay(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.webMapTileServiceRasterOverlay) {
         return ChangedPrimType::CESIUM_WEB_MAP_TILE_SERVICE_RASTER_OVERLAY;
-    } else if (UsdUtil::isCesiumGeoreference(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.georeference) {
         return ChangedPrimType::CESIUM_GEOREFERENCE;
-    } else if (UsdUtil::isCesiumIonServer(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.ionServer) {
         return ChangedPrimType::CESIUM_ION_SERVER;
-    } else if (UsdUtil::isCesiumCartographicPolygon(_pContext->getUsdStage(), path)) {
+    }
+
+    const auto hasGlobeAnchor = prim.HasAPI<pxr::CesiumGlobeAnchorAPI>();
+
+    if (hasGlobeAnchor && schemaType == schemaTypes.basisCurves) {
         return ChangedPrimType::CESIUM_CARTOGRAPHIC_POLYGON;
-    } else if (UsdUtil::isUsdShader(_pContext->getUsdStage(), path)) {
+    } else if (schemaType == schemaTypes.shader) {
         return ChangedPrimType::USD_SHADER;
-    } else if (UsdUtil::hasCesiumGlobeAnchor(_pContext->getUsdStage(), path)) {
+    } else if (hasGlobeAnchor && prim.IsA<pxr::UsdGeomXformable>()) {
         // Globe anchor needs to be checked last since prim types take precedence over API schemas
         return ChangedPrimType::CESIUM_GLOBE_ANCHOR;
     }
@@ -40,6 +40,7 @@ PXR_NAMESPACE_CLOSE_SCOPE
     std::vector<omni::fabric::Token> inputs_raster_overlay_tokens;
     std::vector<omni::fabric::Token> primvars_st_tokens;
     std::vector<omni::fabric::Token> property_tokens;
+    std::vector<omni::fabric::Token> _cesium_tileset_tokens;
 
     const omni::fabric::TokenC
     getToken(std::vector<omni::fabric::Token>& tokens, uint64_t index, const std::string_view& prefix) {
@@ -81,4 +82,8 @@ PXR_NAMESPACE_CLOSE_SCOPE
         return getToken(property_tokens, index, "property");
     }
 
+    const omni::fabric::TokenC _cesium_tileset_n(uint64_t index) {
+        return getToken(_cesium_tileset_tokens, index, "_cesium_tileset");
+    }
+
 } // namespace cesium::omniverse::FabricTokens
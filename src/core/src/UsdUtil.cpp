@@ -228,17 +228,13 @@ glm::dmat4 computePrimLocalToEcefTransform(
     return glm::affineInverse(computeEcefToPrimLocalTransform(context, georeferencePath, primPath));
 }
 
-Cesium3DTilesSelection::ViewState computeViewState(
-    const Context& context,
-    const pxr::SdfPath& georeferencePath,
-    const pxr::SdfPath& primPath,
-    const Viewport& viewport) {
+Cesium3DTilesSelection::ViewState
+computeViewState(const glm::dmat4& primWorldToEcefTransform, const Viewport& viewport) {
     const auto& viewMatrix = viewport.viewMatrix;
     const auto& projMatrix = viewport.projMatrix;
     const auto width = viewport.width;
     const auto height = viewport.height;
 
-    const auto primWorldToEcefTransform = computePrimWorldToEcefTransform(context, georeferencePath, primPath);
     const auto inverseView = glm::affineInverse(viewMatrix);
     const auto usdCameraUp = glm::dvec3(inverseView[1]);
     const auto usdCameraFwd = glm::dvec3(-inverseView[2]);
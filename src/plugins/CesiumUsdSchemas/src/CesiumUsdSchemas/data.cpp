@@ -216,6 +216,57 @@ CesiumData::CreateDebugTexturePoolInitialCapacityAttr(VtValue const &defaultValu
                        writeSparsely);
 }
 
+UsdAttribute
+CesiumData::GetDebugPoolGrowthFactorAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumDebugPoolGrowthFactor);
+}
+
+UsdAttribute
+CesiumData::CreateDebugPoolGrowthFactorAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumDebugPoolGrowthFactor,
+                       SdfValueTypeNames->Double,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumData::GetDebugPoolLowWaterMarkAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumDebugPoolLowWaterMark);
+}
+
+UsdAttribute
+CesiumData::CreateDebugPoolLowWaterMarkAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumDebugPoolLowWaterMark,
+                       SdfValueTypeNames->UInt64,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumData::GetDebugPoolMaximumIdleTimeAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumDebugPoolMaximumIdleTime);
+}
+
+UsdAttribute
+CesiumData::CreateDebugPoolMaximumIdleTimeAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumDebugPoolMaximumIdleTime,
+                       SdfValueTypeNames->Double,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
 UsdAttribute
 CesiumData::GetDebugRandomColorsAttr() const
 {
@@ -250,6 +301,40 @@ CesiumData::CreateDebugDisableGeoreferencingAttr(VtValue const &defaultValue, bo
                        writeSparsely);
 }
 
+UsdAttribute
+CesiumData::GetDebugVerifyRenderStatisticsAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumDebugVerifyRenderStatistics);
+}
+
+UsdAttribute
+CesiumData::CreateDebugVerifyRenderStatisticsAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumDebugVerifyRenderStatistics,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumData::GetDebugPipelinedTileSelectionAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumDebugPipelinedTileSelection);
+}
+
+UsdAttribute
+CesiumData::CreateDebugPipelinedTileSelectionAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumDebugPipelinedTileSelection,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
 UsdRelationship
 CesiumData::GetSelectedIonServerRel() const
 {
@@ -288,8 +373,13 @@ CesiumData::GetSchemaAttributeNames(bool includeInherited)
         CesiumTokens->cesiumDebugGeometryPoolInitialCapacity,
         CesiumTokens->cesiumDebugMaterialPoolInitialCapacity,
         CesiumTokens->cesiumDebugTexturePoolInitialCapacity,
+        CesiumTokens->cesiumDebugPoolGrowthFactor,
+        CesiumTokens->cesiumDebugPoolLowWaterMark,
+        CesiumTokens->cesiumDebugPoolMaximumIdleTime,
         CesiumTokens->cesiumDebugRandomColors,
         CesiumTokens->cesiumDebugDisableGeoreferencing,
+        CesiumTokens->cesiumDebugVerifyRenderStatistics,
+        CesiumTokens->cesiumDebugPipelinedTileSelection,
     };
     static TfTokenVector allNames =
         _ConcatenateAttributeNames(
@@ -283,7 +283,7 @@ public:
     // --------------------------------------------------------------------- //
     // DEBUGTEXTUREPOOLINITIALCAPACITY 
     // --------------------------------------------------------------------- //
-    /// Debug option that controls the initial capacity of the texture pool.
+    /// Debug option that controls the initial capacity of the texture pool for 256x256 raster overlay tiles. Pools for other texture sizes start empty.
     ///
     /// | ||
     /// | -- | -- |
@@ -301,6 +301,72 @@ public:
     CESIUMUSDSCHEMAS_API
     UsdAttribute CreateDebugTexturePoolInitialCapacityAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
 
+public:
+    // --------------------------------------------------------------------- //
+    // DEBUGPOOLGROWTHFACTOR 
+    // --------------------------------------------------------------------- //
+    /// Debug option that controls how much the geometry, material, and texture pools grow when they run low on inactive objects.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `double cesium:debug:poolGrowthFactor = 2` |
+    /// | C++ Type | double |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Double |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetDebugPoolGrowthFactorAttr() const;
+
+    /// See GetDebugPoolGrowthFactorAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateDebugPoolGrowthFactorAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // DEBUGPOOLLOWWATERMARK 
+    // --------------------------------------------------------------------- //
+    /// Debug option that controls the minimum capacity that the geometry and texture pools keep when trimming idle objects.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `uint64 cesium:debug:poolLowWaterMark = 0` |
+    /// | C++ Type | uint64_t |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->UInt64 |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetDebugPoolLowWaterMarkAttr() const;
+
+    /// See GetDebugPoolLowWaterMarkAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateDebugPoolLowWaterMarkAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // DEBUGPOOLMAXIMUMIDLETIME 
+    // --------------------------------------------------------------------- //
+    /// Debug option that controls how long, in seconds, an inactive object may sit idle in the geometry or texture pool before it is destroyed. A value of 0 disables trimming.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `double cesium:debug:poolMaximumIdleTime = 0` |
+    /// | C++ Type | double |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Double |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetDebugPoolMaximumIdleTimeAttr() const;
+
+    /// See GetDebugPoolMaximumIdleTimeAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateDebugPoolMaximumIdleTimeAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
 public:
     // --------------------------------------------------------------------- //
     // DEBUGRANDOMCOLORS 
@@ -345,6 +411,50 @@ public:
     CESIUMUSDSCHEMAS_API
     UsdAttribute CreateDebugDisableGeoreferencingAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
 
+public:
+    // --------------------------------------------------------------------- //
+    // DEBUGVERIFYRENDERSTATISTICS 
+    // --------------------------------------------------------------------- //
+    /// Debug option that recomputes the render statistics by scanning Fabric and logs a warning if they differ from the incrementally maintained statistics.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:debug:verifyRenderStatistics = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetDebugVerifyRenderStatisticsAttr() const;
+
+    /// See GetDebugVerifyRenderStatisticsAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateDebugVerifyRenderStatisticsAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // DEBUGPIPELINEDTILESELECTION 
+    // --------------------------------------------------------------------- //
+    /// Debug option that selects tiles on a worker thread using the current frame's camera and applies the selection on the next frame. Reduces main thread time at the cost of one frame of latency.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:debug:pipelinedTileSelection = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetDebugPipelinedTileSelectionAttr() const;
+
+    /// See GetDebugPipelinedTileSelectionAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateDebugPipelinedTileSelectionAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
 public:
     // --------------------------------------------------------------------- //
     // SELECTEDIONSERVER 
@@ -180,6 +180,23 @@ CesiumRasterOverlay::CreateSubTileCacheBytesAttr(VtValue const &defaultValue, bo
                        writeSparsely);
 }
 
+UsdAttribute
+CesiumRasterOverlay::GetTextureCompressionAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumTextureCompression);
+}
+
+UsdAttribute
+CesiumRasterOverlay::CreateTextureCompressionAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumTextureCompression,
+                       SdfValueTypeNames->Token,
+                       /* custom = */ false,
+                       SdfVariabilityUniform,
+                       defaultValue,
+                       writeSparsely);
+}
+
 namespace {
 static inline TfTokenVector
 _ConcatenateAttributeNames(const TfTokenVector& left,const TfTokenVector& right)
@@ -204,6 +221,7 @@ CesiumRasterOverlay::GetSchemaAttributeNames(bool includeInherited)
         CesiumTokens->cesiumMaximumTextureSize,
         CesiumTokens->cesiumMaximumSimultaneousTileLoads,
         CesiumTokens->cesiumSubTileCacheBytes,
+        CesiumTokens->cesiumTextureCompression,
     };
     static TfTokenVector allNames =
         _ConcatenateAttributeNames(
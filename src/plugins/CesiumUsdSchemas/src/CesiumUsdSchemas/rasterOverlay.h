@@ -267,6 +267,30 @@ public:
     CESIUMUSDSCHEMAS_API
     UsdAttribute CreateSubTileCacheBytesAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
 
+public:
+    // --------------------------------------------------------------------- //
+    // TEXTURECOMPRESSION 
+    // --------------------------------------------------------------------- //
+    /// Compresses raster overlay images to BC1 or BC3 on worker threads before they are uploaded. The fast preset favors encoding speed and the quality preset favors image quality. Reduces texture memory by 4x to 8x.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `uniform token cesium:textureCompression = "none"` |
+    /// | C++ Type | TfToken |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Token |
+    /// | \ref SdfVariability "Variability" | SdfVariabilityUniform |
+    /// | \ref CesiumTokens "Allowed Values" | none, fast, quality |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetTextureCompressionAttr() const;
+
+    /// See GetTextureCompressionAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateTextureCompressionAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
 public:
     // ===================================================================== //
     // Feel free to add custom code below this line, it will be preserved by 
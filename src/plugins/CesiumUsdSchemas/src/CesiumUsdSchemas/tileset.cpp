@@ -369,6 +369,57 @@ CesiumTileset::CreateSmoothNormalsAttr(VtValue const &defaultValue, bool writeSp
                        writeSparsely);
 }
 
+UsdAttribute
+CesiumTileset::GetRenderPointsAsVoxelsAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumRenderPointsAsVoxels);
+}
+
+UsdAttribute
+CesiumTileset::CreateRenderPointsAsVoxelsAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumRenderPointsAsVoxels,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumTileset::GetMergePrimitivesAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumMergePrimitives);
+}
+
+UsdAttribute
+CesiumTileset::CreateMergePrimitivesAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumMergePrimitives,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumTileset::GetTextureCompressionAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumTextureCompression);
+}
+
+UsdAttribute
+CesiumTileset::CreateTextureCompressionAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumTextureCompression,
+                       SdfValueTypeNames->Token,
+                       /* custom = */ false,
+                       SdfVariabilityUniform,
+                       defaultValue,
+                       writeSparsely);
+}
+
 UsdAttribute
 CesiumTileset::GetShowCreditsOnScreenAttr() const
 {
@@ -476,6 +527,9 @@ CesiumTileset::GetSchemaAttributeNames(bool includeInherited)
         CesiumTokens->cesiumCulledScreenSpaceError,
         CesiumTokens->cesiumSuspendUpdate,
         CesiumTokens->cesiumSmoothNormals,
+        CesiumTokens->cesiumRenderPointsAsVoxels,
+        CesiumTokens->cesiumMergePrimitives,
+        CesiumTokens->cesiumTextureCompression,
         CesiumTokens->cesiumShowCreditsOnScreen,
         CesiumTokens->cesiumMainThreadLoadingTimeLimit,
     };
@@ -506,6 +506,74 @@ public:
     CESIUMUSDSCHEMAS_API
     UsdAttribute CreateSmoothNormalsAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
 
+public:
+    // --------------------------------------------------------------------- //
+    // RENDERPOINTSASVOXELS 
+    // --------------------------------------------------------------------- //
+    /// Render point clouds as voxel cubes instead of native points. Voxels use 8 vertices and 12 triangles per point.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:renderPointsAsVoxels = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetRenderPointsAsVoxelsAttr() const;
+
+    /// See GetRenderPointsAsVoxelsAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateRenderPointsAsVoxelsAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // MERGEPRIMITIVES 
+    // --------------------------------------------------------------------- //
+    /// Merge primitives within a tile that share the same material into a single mesh. Reduces the number of prims and draw calls for tiles with many small primitives.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:mergePrimitives = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetMergePrimitivesAttr() const;
+
+    /// See GetMergePrimitivesAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateMergePrimitivesAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // TEXTURECOMPRESSION 
+    // --------------------------------------------------------------------- //
+    /// Compresses uncompressed glTF base color textures to BC1 or BC3 on worker threads before they are uploaded. The fast preset favors encoding speed and the quality preset favors image quality. Reduces texture memory by 4x to 8x.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `uniform token cesium:textureCompression = "none"` |
+    /// | C++ Type | TfToken |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Token |
+    /// | \ref SdfVariability "Variability" | SdfVariabilityUniform |
+    /// | \ref CesiumTokens "Allowed Values" | none, fast, quality |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetTextureCompressionAttr() const;
+
+    /// See GetTextureCompressionAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateTextureCompressionAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
 public:
     // --------------------------------------------------------------------- //
     // SHOWCREDITSONSCREEN 
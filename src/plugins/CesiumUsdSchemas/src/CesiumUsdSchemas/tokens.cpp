@@ -22,8 +22,13 @@ CesiumTokensType::CesiumTokensType() :
     cesiumDebugDisableTextures("cesium:debug:disableTextures", TfToken::Immortal),
     cesiumDebugGeometryPoolInitialCapacity("cesium:debug:geometryPoolInitialCapacity", TfToken::Immortal),
     cesiumDebugMaterialPoolInitialCapacity("cesium:debug:materialPoolInitialCapacity", TfToken::Immortal),
+    cesiumDebugPipelinedTileSelection("cesium:debug:pipelinedTileSelection", TfToken::Immortal),
+    cesiumDebugPoolGrowthFactor("cesium:debug:poolGrowthFactor", TfToken::Immortal),
+    cesiumDebugPoolLowWaterMark("cesium:debug:poolLowWaterMark", TfToken::Immortal),
+    cesiumDebugPoolMaximumIdleTime("cesium:debug:poolMaximumIdleTime", TfToken::Immortal),
     cesiumDebugRandomColors("cesium:debug:randomColors", TfToken::Immortal),
     cesiumDebugTexturePoolInitialCapacity("cesium:debug:texturePoolInitialCapacity", TfToken::Immortal),
+    cesiumDebugVerifyRenderStatistics("cesium:debug:verifyRenderStatistics", TfToken::Immortal),
     cesiumDisplayName("cesium:displayName", TfToken::Immortal),
     cesiumEast("cesium:east", TfToken::Immortal),
     cesiumEcefToUsdTransform("cesium:ecefToUsdTransform", TfToken::Immortal),
@@ -54,6 +59,7 @@ CesiumTokensType::CesiumTokensType() :
     cesiumMaximumSimultaneousTileLoads("cesium:maximumSimultaneousTileLoads", TfToken::Immortal),
     cesiumMaximumTextureSize("cesium:maximumTextureSize", TfToken::Immortal),
     cesiumMaximumZoomLevel("cesium:maximumZoomLevel", TfToken::Immortal),
+    cesiumMergePrimitives("cesium:mergePrimitives", TfToken::Immortal),
     cesiumMinimumLevel("cesium:minimumLevel", TfToken::Immortal),
     cesiumMinimumZoomLevel("cesium:minimumZoomLevel", TfToken::Immortal),
     cesiumNorth("cesium:north", TfToken::Immortal),
@@ -63,6 +69,7 @@ CesiumTokensType::CesiumTokensType() :
     cesiumProjectDefaultIonAccessToken("cesium:projectDefaultIonAccessToken", TfToken::Immortal),
     cesiumProjectDefaultIonAccessTokenId("cesium:projectDefaultIonAccessTokenId", TfToken::Immortal),
     cesiumRasterOverlayBinding("cesium:rasterOverlayBinding", TfToken::Immortal),
+    cesiumRenderPointsAsVoxels("cesium:renderPointsAsVoxels", TfToken::Immortal),
     cesiumRootTilesX("cesium:rootTilesX", TfToken::Immortal),
     cesiumRootTilesY("cesium:rootTilesY", TfToken::Immortal),
     cesiumSelectedIonServer("cesium:selectedIonServer", TfToken::Immortal),
@@ -76,6 +83,7 @@ CesiumTokensType::CesiumTokensType() :
     cesiumStyle("cesium:style", TfToken::Immortal),
     cesiumSubTileCacheBytes("cesium:subTileCacheBytes", TfToken::Immortal),
     cesiumSuspendUpdate("cesium:suspendUpdate", TfToken::Immortal),
+    cesiumTextureCompression("cesium:textureCompression", TfToken::Immortal),
     cesiumTileHeight("cesium:tileHeight", TfToken::Immortal),
     cesiumTileMatrixSetId("cesium:tileMatrixSetId", TfToken::Immortal),
     cesiumTileMatrixSetLabelPrefix("cesium:tileMatrixSetLabelPrefix", TfToken::Immortal),
@@ -85,8 +93,11 @@ CesiumTokensType::CesiumTokensType() :
     cesiumUseWebMercatorProjection("cesium:useWebMercatorProjection", TfToken::Immortal),
     cesiumWest("cesium:west", TfToken::Immortal),
     clip("clip", TfToken::Immortal),
+    fast("fast", TfToken::Immortal),
     ion("ion", TfToken::Immortal),
+    none("none", TfToken::Immortal),
     overlay("overlay", TfToken::Immortal),
+    quality("quality", TfToken::Immortal),
     url("url", TfToken::Immortal),
     allTokens({
         cesiumAlpha,
@@ -108,8 +119,13 @@ CesiumTokensType::CesiumTokensType() :
         cesiumDebugDisableTextures,
         cesiumDebugGeometryPoolInitialCapacity,
         cesiumDebugMaterialPoolInitialCapacity,
+        cesiumDebugPipelinedTileSelection,
+        cesiumDebugPoolGrowthFactor,
+        cesiumDebugPoolLowWaterMark,
+        cesiumDebugPoolMaximumIdleTime,
         cesiumDebugRandomColors,
         cesiumDebugTexturePoolInitialCapacity,
+        cesiumDebugVerifyRenderStatistics,
         cesiumDisplayName,
         cesiumEast,
         cesiumEcefToUsdTransform,
@@ -140,6 +156,7 @@ CesiumTokensType::CesiumTokensType() :
         cesiumMaximumSimultaneousTileLoads,
         cesiumMaximumTextureSize,
         cesiumMaximumZoomLevel,
+        cesiumMergePrimitives,
         cesiumMinimumLevel,
         cesiumMinimumZoomLevel,
         cesiumNorth,
@@ -149,6 +166,7 @@ CesiumTokensType::CesiumTokensType() :
         cesiumProjectDefaultIonAccessToken,
         cesiumProjectDefaultIonAccessTokenId,
         cesiumRasterOverlayBinding,
+        cesiumRenderPointsAsVoxels,
         cesiumRootTilesX,
         cesiumRootTilesY,
         cesiumSelectedIonServer,
@@ -162,6 +180,7 @@ CesiumTokensType::CesiumTokensType() :
         cesiumStyle,
         cesiumSubTileCacheBytes,
         cesiumSuspendUpdate,
+        cesiumTextureCompression,
         cesiumTileHeight,
         cesiumTileMatrixSetId,
         cesiumTileMatrixSetLabelPrefix,
@@ -171,8 +190,11 @@ CesiumTokensType::CesiumTokensType() :
         cesiumUseWebMercatorProjection,
         cesiumWest,
         clip,
+        fast,
         ion,
+        none,
         overlay,
+        quality,
         url
     })
 {
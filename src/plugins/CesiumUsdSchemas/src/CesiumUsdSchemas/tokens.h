@@ -115,6 +115,22 @@ struct CesiumTokensType {
     /// 
     /// CesiumData
     const TfToken cesiumDebugMaterialPoolInitialCapacity;
+    /// \brief "cesium:debug:pipelinedTileSelection"
+    /// 
+    /// CesiumData
+    const TfToken cesiumDebugPipelinedTileSelection;
+    /// \brief "cesium:debug:poolGrowthFactor"
+    /// 
+    /// CesiumData
+    const TfToken cesiumDebugPoolGrowthFactor;
+    /// \brief "cesium:debug:poolLowWaterMark"
+    /// 
+    /// CesiumData
+    const TfToken cesiumDebugPoolLowWaterMark;
+    /// \brief "cesium:debug:poolMaximumIdleTime"
+    /// 
+    /// CesiumData
+    const TfToken cesiumDebugPoolMaximumIdleTime;
     /// \brief "cesium:debug:randomColors"
     /// 
     /// CesiumData
@@ -123,6 +139,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumData
     const TfToken cesiumDebugTexturePoolInitialCapacity;
+    /// \brief "cesium:debug:verifyRenderStatistics"
+    /// 
+    /// CesiumData
+    const TfToken cesiumDebugVerifyRenderStatistics;
     /// \brief "cesium:displayName"
     /// 
     /// CesiumIonServer
@@ -243,6 +263,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumWebMapTileServiceRasterOverlay, CesiumTileMapServiceRasterOverlay
     const TfToken cesiumMaximumZoomLevel;
+    /// \brief "cesium:mergePrimitives"
+    /// 
+    /// CesiumTileset
+    const TfToken cesiumMergePrimitives;
     /// \brief "cesium:minimumLevel"
     /// 
     /// CesiumWebMapServiceRasterOverlay
@@ -279,6 +303,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumTileset
     const TfToken cesiumRasterOverlayBinding;
+    /// \brief "cesium:renderPointsAsVoxels"
+    /// 
+    /// CesiumTileset
+    const TfToken cesiumRenderPointsAsVoxels;
     /// \brief "cesium:rootTilesX"
     /// 
     /// CesiumWebMapTileServiceRasterOverlay
@@ -331,6 +359,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumTileset
     const TfToken cesiumSuspendUpdate;
+    /// \brief "cesium:textureCompression"
+    /// 
+    /// CesiumRasterOverlay, CesiumTileset
+    const TfToken cesiumTextureCompression;
     /// \brief "cesium:tileHeight"
     /// 
     /// CesiumWebMapServiceRasterOverlay
@@ -367,14 +399,26 @@ struct CesiumTokensType {
     /// 
     /// Default value for CesiumPolygonRasterOverlay::GetCesiumOverlayRenderMethodAttr(), Possible value for CesiumRasterOverlay::GetOverlayRenderMethodAttr()
     const TfToken clip;
+    /// \brief "fast"
+    /// 
+    /// Possible value for CesiumTileset::GetTextureCompressionAttr(), Possible value for CesiumRasterOverlay::GetTextureCompressionAttr()
+    const TfToken fast;
     /// \brief "ion"
     /// 
     /// Possible value for CesiumTileset::GetSourceTypeAttr(), Default value for CesiumTileset::GetSourceTypeAttr()
     const TfToken ion;
+    /// \brief "none"
+    /// 
+    /// Possible value for CesiumTileset::GetTextureCompressionAttr(), Default value for CesiumTileset::GetTextureCompressionAttr(), Possible value for CesiumRasterOverlay::GetTextureCompressionAttr(), Default value for CesiumRasterOverlay::GetTextureCompressionAttr()
+    const TfToken none;
     /// \brief "overlay"
     /// 
     /// Possible value for CesiumRasterOverlay::GetOverlayRenderMethodAttr(), Default value for CesiumRasterOverlay::GetOverlayRenderMethodAttr()
     const TfToken overlay;
+    /// \brief "quality"
+    /// 
+    /// Possible value for CesiumTileset::GetTextureCompressionAttr(), Possible value for CesiumRasterOverlay::GetTextureCompressionAttr()
+    const TfToken quality;
     /// \brief "url"
     /// 
     /// Possible value for CesiumTileset::GetSourceTypeAttr()
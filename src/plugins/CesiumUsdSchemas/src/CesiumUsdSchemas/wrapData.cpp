@@ -82,6 +82,27 @@ _CreateDebugTexturePoolInitialCapacityAttr(CesiumData &self,
         UsdPythonToSdfType(defaultVal, SdfValueTypeNames->UInt64), writeSparsely);
 }
         
+static UsdAttribute
+_CreateDebugPoolGrowthFactorAttr(CesiumData &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateDebugPoolGrowthFactorAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Double), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateDebugPoolLowWaterMarkAttr(CesiumData &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateDebugPoolLowWaterMarkAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->UInt64), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateDebugPoolMaximumIdleTimeAttr(CesiumData &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateDebugPoolMaximumIdleTimeAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Double), writeSparsely);
+}
+        
 static UsdAttribute
 _CreateDebugRandomColorsAttr(CesiumData &self,
                                       object defaultVal, bool writeSparsely) {
@@ -95,6 +116,20 @@ _CreateDebugDisableGeoreferencingAttr(CesiumData &self,
     return self.CreateDebugDisableGeoreferencingAttr(
         UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
 }
+        
+static UsdAttribute
+_CreateDebugVerifyRenderStatisticsAttr(CesiumData &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateDebugVerifyRenderStatisticsAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateDebugPipelinedTileSelectionAttr(CesiumData &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateDebugPipelinedTileSelectionAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
 
 static std::string
 _Repr(const CesiumData &self)
@@ -194,6 +229,27 @@ void wrapCesiumData()
              (arg("defaultValue")=object(),
               arg("writeSparsely")=false))
         
+        .def("GetDebugPoolGrowthFactorAttr",
+             &This::GetDebugPoolGrowthFactorAttr)
+        .def("CreateDebugPoolGrowthFactorAttr",
+             &_CreateDebugPoolGrowthFactorAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetDebugPoolLowWaterMarkAttr",
+             &This::GetDebugPoolLowWaterMarkAttr)
+        .def("CreateDebugPoolLowWaterMarkAttr",
+             &_CreateDebugPoolLowWaterMarkAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetDebugPoolMaximumIdleTimeAttr",
+             &This::GetDebugPoolMaximumIdleTimeAttr)
+        .def("CreateDebugPoolMaximumIdleTimeAttr",
+             &_CreateDebugPoolMaximumIdleTimeAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
         .def("GetDebugRandomColorsAttr",
              &This::GetDebugRandomColorsAttr)
         .def("CreateDebugRandomColorsAttr",
@@ -207,6 +263,20 @@ void wrapCesiumData()
              &_CreateDebugDisableGeoreferencingAttr,
              (arg("defaultValue")=object(),
               arg("writeSparsely")=false))
+        
+        .def("GetDebugVerifyRenderStatisticsAttr",
+             &This::GetDebugVerifyRenderStatisticsAttr)
+        .def("CreateDebugVerifyRenderStatisticsAttr",
+             &_CreateDebugVerifyRenderStatisticsAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetDebugPipelinedTileSelectionAttr",
+             &This::GetDebugPipelinedTileSelectionAttr)
+        .def("CreateDebugPipelinedTileSelectionAttr",
+             &_CreateDebugPipelinedTileSelectionAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
 
         
         .def("GetSelectedIonServerRel",
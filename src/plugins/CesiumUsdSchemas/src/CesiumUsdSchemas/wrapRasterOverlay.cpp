@@ -74,6 +74,13 @@ _CreateSubTileCacheBytesAttr(CesiumRasterOverlay &self,
     return self.CreateSubTileCacheBytesAttr(
         UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Int), writeSparsely);
 }
+        
+static UsdAttribute
+_CreateTextureCompressionAttr(CesiumRasterOverlay &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateTextureCompressionAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Token), writeSparsely);
+}
 
 static std::string
 _Repr(const CesiumRasterOverlay &self)
@@ -162,6 +169,13 @@ void wrapCesiumRasterOverlay()
              &_CreateSubTileCacheBytesAttr,
              (arg("defaultValue")=object(),
               arg("writeSparsely")=false))
+        
+        .def("GetTextureCompressionAttr",
+             &This::GetTextureCompressionAttr)
+        .def("CreateTextureCompressionAttr",
+             &_CreateTextureCompressionAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
 
         .def("__repr__", ::_Repr)
     ;
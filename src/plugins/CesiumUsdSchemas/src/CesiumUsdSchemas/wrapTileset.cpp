@@ -145,6 +145,27 @@ _CreateSmoothNormalsAttr(CesiumTileset &self,
         UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
 }
         
+static UsdAttribute
+_CreateRenderPointsAsVoxelsAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateRenderPointsAsVoxelsAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateMergePrimitivesAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateMergePrimitivesAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateTextureCompressionAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateTextureCompressionAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Token), writeSparsely);
+}
+        
 static UsdAttribute
 _CreateShowCreditsOnScreenAttr(CesiumTileset &self,
                                       object defaultVal, bool writeSparsely) {
@@ -320,6 +341,27 @@ void wrapCesiumTileset()
              (arg("defaultValue")=object(),
               arg("writeSparsely")=false))
         
+        .def("GetRenderPointsAsVoxelsAttr",
+             &This::GetRenderPointsAsVoxelsAttr)
+        .def("CreateRenderPointsAsVoxelsAttr",
+             &_CreateRenderPointsAsVoxelsAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetMergePrimitivesAttr",
+             &This::GetMergePrimitivesAttr)
+        .def("CreateMergePrimitivesAttr",
+             &_CreateMergePrimitivesAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetTextureCompressionAttr",
+             &This::GetTextureCompressionAttr)
+        .def("CreateTextureCompressionAttr",
+             &_CreateTextureCompressionAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
         .def("GetShowCreditsOnScreenAttr",
              &This::GetShowCreditsOnScreenAttr)
         .def("CreateShowCreditsOnScreenAttr",
@@ -60,8 +60,13 @@ void wrapCesiumTokens()
     _AddToken(cls, "cesiumDebugDisableTextures", CesiumTokens->cesiumDebugDisableTextures);
     _AddToken(cls, "cesiumDebugGeometryPoolInitialCapacity", CesiumTokens->cesiumDebugGeometryPoolInitialCapacity);
     _AddToken(cls, "cesiumDebugMaterialPoolInitialCapacity", CesiumTokens->cesiumDebugMaterialPoolInitialCapacity);
+    _AddToken(cls, "cesiumDebugPipelinedTileSelection", CesiumTokens->cesiumDebugPipelinedTileSelection);
+    _AddToken(cls, "cesiumDebugPoolGrowthFactor", CesiumTokens->cesiumDebugPoolGrowthFactor);
+    _AddToken(cls, "cesiumDebugPoolLowWaterMark", CesiumTokens->cesiumDebugPoolLowWaterMark);
+    _AddToken(cls, "cesiumDebugPoolMaximumIdleTime", CesiumTokens->cesiumDebugPoolMaximumIdleTime);
     _AddToken(cls, "cesiumDebugRandomColors", CesiumTokens->cesiumDebugRandomColors);
     _AddToken(cls, "cesiumDebugTexturePoolInitialCapacity", CesiumTokens->cesiumDebugTexturePoolInitialCapacity);
+    _AddToken(cls, "cesiumDebugVerifyRenderStatistics", CesiumTokens->cesiumDebugVerifyRenderStatistics);
     _AddToken(cls, "cesiumDisplayName", CesiumTokens->cesiumDisplayName);
     _AddToken(cls, "cesiumEast", CesiumTokens->cesiumEast);
     _AddToken(cls, "cesiumEcefToUsdTransform", CesiumTokens->cesiumEcefToUsdTransform);
@@ -92,6 +97,7 @@ void wrapCesiumTokens()
     _AddToken(cls, "cesiumMaximumSimultaneousTileLoads", CesiumTokens->cesiumMaximumSimultaneousTileLoads);
     _AddToken(cls, "cesiumMaximumTextureSize", CesiumTokens->cesiumMaximumTextureSize);
     _AddToken(cls, "cesiumMaximumZoomLevel", CesiumTokens->cesiumMaximumZoomLevel);
+    _AddToken(cls, "cesiumMergePrimitives", CesiumTokens->cesiumMergePrimitives);
     _AddToken(cls, "cesiumMinimumLevel", CesiumTokens->cesiumMinimumLevel);
     _AddToken(cls, "cesiumMinimumZoomLevel", CesiumTokens->cesiumMinimumZoomLevel);
     _AddToken(cls, "cesiumNorth", CesiumTokens->cesiumNorth);
@@ -101,6 +107,7 @@ void wrapCesiumTokens()
     _AddToken(cls, "cesiumProjectDefaultIonAccessToken", CesiumTokens->cesiumProjectDefaultIonAccessToken);
     _AddToken(cls, "cesiumProjectDefaultIonAccessTokenId", CesiumTokens->cesiumProjectDefaultIonAccessTokenId);
     _AddToken(cls, "cesiumRasterOverlayBinding", CesiumTokens->cesiumRasterOverlayBinding);
+    _AddToken(cls, "cesiumRenderPointsAsVoxels", CesiumTokens->cesiumRenderPointsAsVoxels);
     _AddToken(cls, "cesiumRootTilesX", CesiumTokens->cesiumRootTilesX);
     _AddToken(cls, "cesiumRootTilesY", CesiumTokens->cesiumRootTilesY);
     _AddToken(cls, "cesiumSelectedIonServer", CesiumTokens->cesiumSelectedIonServer);
@@ -114,6 +121,7 @@ void wrapCesiumTokens()
     _AddToken(cls, "cesiumStyle", CesiumTokens->cesiumStyle);
     _AddToken(cls, "cesiumSubTileCacheBytes", CesiumTokens->cesiumSubTileCacheBytes);
     _AddToken(cls, "cesiumSuspendUpdate", CesiumTokens->cesiumSuspendUpdate);
+    _AddToken(cls, "cesiumTextureCompression", CesiumTokens->cesiumTextureCompression);
     _AddToken(cls, "cesiumTileHeight", CesiumTokens->cesiumTileHeight);
     _AddToken(cls, "cesiumTileMatrixSetId", CesiumTokens->cesiumTileMatrixSetId);
     _AddToken(cls, "cesiumTileMatrixSetLabelPrefix", CesiumTokens->cesiumTileMatrixSetLabelPrefix);
@@ -123,7 +131,10 @@ void wrapCesiumTokens()
     _AddToken(cls, "cesiumUseWebMercatorProjection", CesiumTokens->cesiumUseWebMercatorProjection);
     _AddToken(cls, "cesiumWest", CesiumTokens->cesiumWest);
     _AddToken(cls, "clip", CesiumTokens->clip);
+    _AddToken(cls, "fast", CesiumTokens->fast);
     _AddToken(cls, "ion", CesiumTokens->ion);
+    _AddToken(cls, "none", CesiumTokens->none);
     _AddToken(cls, "overlay", CesiumTokens->overlay);
+    _AddToken(cls, "quality", CesiumTokens->quality);
     _AddToken(cls, "url", CesiumTokens->url);
 }
@@ -14,7 +14,6 @@
 #include "cesium/omniverse/Viewport.h"
 
 #include <CesiumGeospatial/Cartographic.h>
-#include <CesiumUtility/CreditSystem.h>
 #include <carb/PluginUtils.h>
 #include <omni/fabric/IFabric.h>
 #include <omni/kit/IApp.h>
@@ -34,6 +33,8 @@ class CesiumOmniversePlugin final : public ICesiumOmniverseInterface {
     }
 
     void reloadTileset(const char* tilesetPath) noexcept override {
+        _pContext->getAssetRegistry().waitForTileSelection();
+
         const auto pTileset = _pContext->getAssetRegistry().getTileset(pxr::SdfPath(tilesetPath));
 
         if (pTileset) {
@@ -155,26 +156,11 @@ class CesiumOmniversePlugin final : public ICesiumOmniverseInterface {
     }
 
     bool creditsAvailable() noexcept override {
-        return _pContext->getCreditSystem()->getCreditsToShowThisFrame().size() > 0;
+        return !_pContext->getCredits().empty();
     }
 
     std::vector<std::pair<std::string, bool>> getCredits() noexcept override {
-        const auto& pCreditSystem = _pContext->getCreditSystem();
-        const auto& credits = pCreditSystem->getCreditsToShowThisFrame();
-
-        std::vector<std::pair<std::string, bool>> result;
-        result.reserve(credits.size());
-
-        for (const auto& item : credits) {
-            const auto showOnScreen = pCreditSystem->shouldBeShownOnScreen(item);
-            result.emplace_back(pCreditSystem->getHtml(item), showOnScreen);
-        }
-
-        return result;
-    }
-
-    void creditsStartNextFrame() noexcept override {
-        return _pContext->getCreditSystem()->startNextFrame();
+        return _pContext->getCredits();
     }
 
     bool isTracingEnabled() noexcept override {
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace cesium::omniverse {
+class Context;
+}
+
+void setUpFabricStatisticsTests(cesium::omniverse::Context* pContext);
@@ -0,0 +1,293 @@
+#include <cesium/omniverse/AssetRegistry.h>
+#include <cesium/omniverse/OmniCartographicPolygon.h>
+#include <cesium/omniverse/OmniData.h>
+#include <cesium/omniverse/OmniGeoreference.h>
+#include <cesium/omniverse/OmniPolygonRasterOverlay.h>
+#include <doctest/doctest.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+constexpr uint64_t PATH_COUNT = 64;
+constexpr uint64_t CHURN_ITERATIONS = 10000;
+constexpr uint64_t ANCHORED_PRIM_COUNTS[] = {1000, 5000};
+
+enum class TestAssetType { DATA, GEOREFERENCE, CARTOGRAPHIC_POLYGON, POLYGON_RASTER_OVERLAY };
+
+struct TestAsset {
+    pxr::SdfPath path;
+    TestAssetType type;
+};
+
+std::vector<TestAsset> createTestAssets() {
+    const auto types = std::vector<TestAssetType>{
+        TestAssetType::DATA,
+        TestAssetType::GEOREFERENCE,
+        TestAssetType::CARTOGRAPHIC_POLYGON,
+        TestAssetType::POLYGON_RASTER_OVERLAY,
+    };
+
+    std::vector<TestAsset> assets;
+    assets.reserve(PATH_COUNT);
+
+    for (uint64_t i = 0; i < PATH_COUNT; ++i) {
+        const auto path = pxr::SdfPath("/asset_" + std::to_string(i));
+        assets.push_back({path, types[i % types.size()]});
+    }
+
+    return assets;
+}
+
+void addTestAsset(AssetRegistry& assetRegistry, const TestAsset& asset) {
+    switch (asset.type) {
+        case TestAssetType::DATA:
+            assetRegistry.addData(asset.path);
+            break;
+        case TestAssetType::GEOREFERENCE:
+            assetRegistry.addGeoreference(asset.path);
+            break;
+        case TestAssetType::CARTOGRAPHIC_POLYGON:
+            assetRegistry.addCartographicPolygon(asset.path);
+            break;
+        case TestAssetType::POLYGON_RASTER_OVERLAY:
+            assetRegistry.addPolygonRasterOverlay(asset.path);
+            break;
+    }
+}
+
+void removeTestAsset(AssetRegistry& assetRegistry, const TestAsset& asset) {
+    switch (asset.type) {
+        case TestAssetType::DATA:
+            assetRegistry.removeData(asset.path);
+            break;
+        case TestAssetType::GEOREFERENCE:
+            assetRegistry.removeGeoreference(asset.path);
+            break;
+        case TestAssetType::CARTOGRAPHIC_POLYGON:
+            assetRegistry.removeCartographicPolygon(asset.path);
+            break;
+        case TestAssetType::POLYGON_RASTER_OVERLAY:
+            assetRegistry.removePolygonRasterOverlay(asset.path);
+            break;
+    }
+}
+
+AssetType getExpectedAssetType(TestAssetType type) {
+    switch (type) {
+        case TestAssetType::DATA:
+            return AssetType::DATA;
+        case TestAssetType::GEOREFERENCE:
+            return AssetType::GEOREFERENCE;
+        case TestAssetType::CARTOGRAPHIC_POLYGON:
+            return AssetType::CARTOGRAPHIC_POLYGON;
+        case TestAssetType::POLYGON_RASTER_OVERLAY:
+            return AssetType::POLYGON_RASTER_OVERLAY;
+    }
+
+    return AssetType::OTHER;
+}
+
+void checkConsistency(
+    const AssetRegistry& assetRegistry,
+    const std::vector<TestAsset>& assets,
+    const std::vector<bool>& added) {
+    uint64_t georeferenceCount = 0;
+    uint64_t cartographicPolygonCount = 0;
+    uint64_t polygonRasterOverlayCount = 0;
+
+    for (uint64_t i = 0; i < assets.size(); ++i) {
+        const auto& asset = assets[i];
+        const auto expectedAssetType = added[i] ? getExpectedAssetType(asset.type) : AssetType::OTHER;
+
+        CHECK(assetRegistry.getAssetType(asset.path) == expectedAssetType);
+        CHECK(assetRegistry.hasAsset(asset.path) == added[i]);
+
+        const auto pData = assetRegistry.getData(asset.path);
+        const auto pGeoreference = assetRegistry.getGeoreference(asset.path);
+        const auto pCartographicPolygon = assetRegistry.getCartographicPolygon(asset.path);
+        const auto pPolygonRasterOverlay = assetRegistry.getPolygonRasterOverlay(asset.path);
+        const auto pRasterOverlay = assetRegistry.getRasterOverlay(asset.path);
+
+        CHECK((pData != nullptr) == (expectedAssetType == AssetType::DATA));
+        CHECK((pGeoreference != nullptr) == (expectedAssetType == AssetType::GEOREFERENCE));
+        CHECK((pCartographicPolygon != nullptr) == (expectedAssetType == AssetType::CARTOGRAPHIC_POLYGON));
+        CHECK((pPolygonRasterOverlay != nullptr) == (expectedAssetType == AssetType::POLYGON_RASTER_OVERLAY));
+        CHECK(pRasterOverlay == pPolygonRasterOverlay);
+
+        if (pData) {
+            CHECK(pData->getPath() == asset.path);
+        }
+
+        if (pGeoreference) {
+            CHECK(pGeoreference->getPath() == asset.path);
+            ++georeferenceCount;
+        }
+
+        if (pCartographicPolygon) {
+            CHECK(pCartographicPolygon->getPath() == asset.path);
+            ++cartographicPolygonCount;
+        }
+
+        if (pPolygonRasterOverlay) {
+            CHECK(pPolygonRasterOverlay->getPath() == asset.path);
+            ++polygonRasterOverlayCount;
+        }
+    }
+
+    CHECK(assetRegistry.getGeoreferences().size() == georeferenceCount);
+    CHECK(assetRegistry.getCartographicPolygons().size() == cartographicPolygonCount);
+    CHECK(assetRegistry.getPolygonRasterOverlays().size() == polygonRasterOverlayCount);
+}
+
+// The linear scan that UsdNotificationHandler::onPrimRemoved used to do for each removed path
+std::vector<pxr::SdfPath>
+getPrimOrDescendantPathsReference(const AssetRegistry& assetRegistry, const pxr::SdfPath& path) {
+    std::vector<pxr::SdfPath> paths;
+    for (const auto& pCartographicPolygon : assetRegistry.getCartographicPolygons()) {
+        if (pCartographicPolygon->getPath().HasPrefix(path)) {
+            paths.push_back(pCartographicPolygon->getPath());
+        }
+    }
+    return paths;
+}
+
+} // namespace
+
+TEST_SUITE("Test AssetRegistry") {
+    TEST_CASE("Path index stays consistent under add/remove churn") {
+        // These assets don't read from the context until they're used so the registry can be tested without a stage
+        AssetRegistry assetRegistry(nullptr);
+
+        const auto assets = createTestAssets();
+        std::vector<bool> added(assets.size(), false);
+
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<uint64_t> distribution(0, assets.size() - 1);
+
+        for (uint64_t i = 0; i < CHURN_ITERATIONS; ++i) {
+            const auto index = distribution(generator);
+
+            if (added[index]) {
+                removeTestAsset(assetRegistry, assets[index]);
+            } else {
+                addTestAsset(assetRegistry, assets[index]);
+            }
+
+            added[index] = !added[index];
+
+            if (i % 100 == 0) {
+                checkConsistency(assetRegistry, assets, added);
+            }
+        }
+
+        checkConsistency(assetRegistry, assets, added);
+
+        assetRegistry.clear();
+        checkConsistency(assetRegistry, assets, std::vector<bool>(assets.size(), false));
+    }
+
+    TEST_CASE("First assets follow insertion order") {
+        AssetRegistry assetRegistry(nullptr);
+
+        const auto path0 = pxr::SdfPath("/georeference_0");
+        const auto path1 = pxr::SdfPath("/georeference_1");
+        const auto path2 = pxr::SdfPath("/georeference_2");
+
+        assetRegistry.addGeoreference(path0);
+        assetRegistry.addGeoreference(path1);
+        assetRegistry.addGeoreference(path2);
+        CHECK(assetRegistry.getFirstGeoreference()->getPath() == path0);
+
+        assetRegistry.removeGeoreference(path0);
+        CHECK(assetRegistry.getFirstGeoreference()->getPath() == path1);
+        CHECK(assetRegistry.getGeoreference(path0) == nullptr);
+
+        assetRegistry.addGeoreference(path0);
+        CHECK(assetRegistry.getFirstGeoreference()->getPath() == path1);
+        CHECK(assetRegistry.getGeoreference(path0) == assetRegistry.getGeoreferences().back().get());
+    }
+
+    TEST_CASE("Removing an unknown path is a no-op") {
+        AssetRegistry assetRegistry(nullptr);
+
+        const auto path = pxr::SdfPath("/data");
+        assetRegistry.addData(path);
+        assetRegistry.removeGeoreference(path);
+        assetRegistry.removePolygonRasterOverlay(path);
+
+        CHECK(assetRegistry.getData(path) != nullptr);
+        CHECK(assetRegistry.getAssetType(path) == AssetType::DATA);
+    }
+
+    TEST_CASE("Benchmark removing anchored prims") {
+        // Cartographic polygons are anchored prims that can be created without a stage
+        for (const auto count : ANCHORED_PRIM_COUNTS) {
+            const auto scopePath = pxr::SdfPath("/World/Anchors");
+
+            std::vector<pxr::SdfPath> paths;
+            paths.reserve(count);
+            for (uint64_t i = 0; i < count; ++i) {
+                paths.push_back(scopePath.AppendChild(pxr::TfToken("anchor_" + std::to_string(i))));
+            }
+
+            AssetRegistry assetRegistry(nullptr);
+
+            const auto addStart = std::chrono::steady_clock::now();
+            for (const auto& path : paths) {
+                assetRegistry.addCartographicPolygon(path);
+            }
+            const auto addEnd = std::chrono::steady_clock::now();
+
+            // Deleting the scope
+            const auto scopeReferenceStart = std::chrono::steady_clock::now();
+            const auto scopeExpected = getPrimOrDescendantPathsReference(assetRegistry, scopePath);
+            const auto scopeReferenceEnd = std::chrono::steady_clock::now();
+            const auto scopeActual = assetRegistry.getPrimOrDescendantAssetPaths(scopePath);
+            const auto scopeEnd = std::chrono::steady_clock::now();
+
+            CHECK(scopeActual.size() == scopeExpected.size());
+
+            // Deleting the anchored prims one at a time
+            uint64_t referenceMatchCount = 0;
+            const auto referenceStart = std::chrono::steady_clock::now();
+            for (const auto& path : paths) {
+                referenceMatchCount += getPrimOrDescendantPathsReference(assetRegistry, path).size();
+            }
+            const auto referenceEnd = std::chrono::steady_clock::now();
+
+            uint64_t matchCount = 0;
+            for (const auto& path : paths) {
+                const auto removedPaths = assetRegistry.getPrimOrDescendantAssetPaths(path);
+                matchCount += removedPaths.size();
+                for (const auto& removedPath : removedPaths) {
+                    assetRegistry.removeCartographicPolygon(removedPath);
+                }
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            CHECK(referenceMatchCount == count);
+            CHECK(matchCount == count);
+            CHECK(assetRegistry.getCartographicPolygons().empty());
+            CHECK(assetRegistry.getPrimOrDescendantAssetPaths(pxr::SdfPath::AbsoluteRootPath()).empty());
+
+            const auto toMilliseconds = [](const auto& duration) {
+                return std::chrono::duration<double, std::milli>(duration).count();
+            };
+
+            MESSAGE(count, " anchored prims");
+            MESSAGE("Add: ", toMilliseconds(addEnd - addStart), " ms");
+            MESSAGE("Remove scope, reference: ", toMilliseconds(scopeReferenceEnd - scopeReferenceStart), " ms");
+            MESSAGE("Remove scope, path index: ", toMilliseconds(scopeEnd - scopeReferenceEnd), " ms");
+            MESSAGE("Remove each prim, reference: ", toMilliseconds(referenceEnd - referenceStart), " ms");
+            MESSAGE("Remove each prim, path index: ", toMilliseconds(end - referenceEnd), " ms");
+        }
+    }
+}
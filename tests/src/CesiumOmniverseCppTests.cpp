@@ -5,6 +5,7 @@
 
 #include "CesiumOmniverseCppTests.h"
 
+#include "FabricStatisticsTests.h"
 #include "UsdUtilTests.h"
 #include "testUtils.h"
 #include "tilesetTests.h"
@@ -47,6 +48,7 @@ class CesiumOmniverseCppTestsPlugin final : public ICesiumOmniverseCppTestsInter
 
         setUpUsdUtilTests(_pContext.get(), rootPath);
         setUpTilesetTests(_pContext.get(), rootPath);
+        setUpFabricStatisticsTests(_pContext.get());
     }
 
     void runAllTests() noexcept override {
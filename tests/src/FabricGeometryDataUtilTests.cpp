@@ -0,0 +1,128 @@
+#include <cesium/omniverse/FabricGeometryData.h>
+#include <cesium/omniverse/FabricGeometryDataUtil.h>
+#include <doctest/doctest.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+// A unit right triangle in the xy plane facing +z
+FabricGeometryData createTriangle() {
+    FabricGeometryData geometryData;
+    geometryData.points = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    geometryData.faceVertexCounts = {3};
+    geometryData.faceVertexIndices = {0, 1, 2};
+    geometryData.normals = {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}};
+    geometryData.vertexIds = {0.0f, 1.0f, 2.0f};
+    geometryData.extent = std::array<glm::dvec3, 2>{{glm::dvec3(0.0, 0.0, 0.0), glm::dvec3(1.0, 1.0, 0.0)}};
+    return geometryData;
+}
+
+void checkVec3(const glm::fvec3& actual, const glm::fvec3& expected) {
+    CHECK(actual.x == doctest::Approx(expected.x));
+    CHECK(actual.y == doctest::Approx(expected.y));
+    CHECK(actual.z == doctest::Approx(expected.z));
+}
+
+} // namespace
+
+TEST_SUITE("Test FabricGeometryDataUtil") {
+    TEST_CASE("Appended points are transformed and indices are offset") {
+        auto geometryData = createTriangle();
+        const auto otherGeometryData = createTriangle();
+
+        const auto transform = glm::translate(glm::dmat4(1.0), glm::dvec3(10.0, 0.0, 0.0));
+        FabricGeometryDataUtil::appendGeometryData(geometryData, otherGeometryData, transform);
+
+        REQUIRE(geometryData.points.size() == 6);
+        checkVec3(geometryData.points[0], {0.0f, 0.0f, 0.0f});
+        checkVec3(geometryData.points[3], {10.0f, 0.0f, 0.0f});
+        checkVec3(geometryData.points[5], {10.0f, 1.0f, 0.0f});
+
+        CHECK(geometryData.faceVertexCounts == std::vector<int>{3, 3});
+        CHECK(geometryData.faceVertexIndices == std::vector<int>{0, 1, 2, 3, 4, 5});
+
+        REQUIRE(geometryData.extent.has_value());
+        CHECK(geometryData.extent.value()[0] == glm::dvec3(0.0, 0.0, 0.0));
+        CHECK(geometryData.extent.value()[1] == glm::dvec3(11.0, 1.0, 0.0));
+    }
+
+    TEST_CASE("Vertex IDs are not offset") {
+        auto geometryData = createTriangle();
+        FabricGeometryDataUtil::appendGeometryData(geometryData, createTriangle(), glm::dmat4(1.0));
+
+        // Feature IDs of type INDEX look up the vertex ID, which must still refer to the original primitive's vertex
+        CHECK(geometryData.vertexIds == std::vector<float>{0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f});
+    }
+
+    TEST_CASE("Appended normals are rotated") {
+        auto geometryData = createTriangle();
+
+        // Non-uniform scale shouldn't affect the normal of a triangle in the xy plane
+        auto transform = glm::rotate(glm::dmat4(1.0), glm::radians(90.0), glm::dvec3(1.0, 0.0, 0.0));
+        transform = glm::scale(transform, glm::dvec3(2.0, 3.0, 4.0));
+        FabricGeometryDataUtil::appendGeometryData(geometryData, createTriangle(), transform);
+
+        REQUIRE(geometryData.normals.size() == 6);
+        checkVec3(geometryData.normals[0], {0.0f, 0.0f, 1.0f});
+        checkVec3(geometryData.normals[3], {0.0f, -1.0f, 0.0f});
+    }
+
+    TEST_CASE("Appending to empty geometry data") {
+        FabricGeometryData geometryData;
+        const auto transform = glm::translate(glm::dmat4(1.0), glm::dvec3(0.0, 0.0, 5.0));
+        FabricGeometryDataUtil::appendGeometryData(geometryData, createTriangle(), transform);
+
+        REQUIRE(geometryData.points.size() == 3);
+        checkVec3(geometryData.points[1], {1.0f, 0.0f, 5.0f});
+        CHECK(geometryData.faceVertexIndices == std::vector<int>{0, 1, 2});
+
+        REQUIRE(geometryData.extent.has_value());
+        CHECK(geometryData.extent.value()[0] == glm::dvec3(0.0, 0.0, 5.0));
+        CHECK(geometryData.extent.value()[1] == glm::dvec3(1.0, 1.0, 5.0));
+    }
+
+    TEST_CASE("Extent covers existing points when the geometry data has no extent") {
+        auto geometryData = createTriangle();
+        geometryData.extent = std::nullopt;
+
+        const auto transform = glm::translate(glm::dmat4(1.0), glm::dvec3(0.0, 0.0, 5.0));
+        FabricGeometryDataUtil::appendGeometryData(geometryData, createTriangle(), transform);
+
+        REQUIRE(geometryData.extent.has_value());
+        CHECK(geometryData.extent.value()[0] == glm::dvec3(0.0, 0.0, 0.0));
+        CHECK(geometryData.extent.value()[1] == glm::dvec3(1.0, 1.0, 5.0));
+    }
+
+    TEST_CASE("Attributes that only one side has are padded") {
+        auto geometryData = createTriangle();
+        geometryData.texcoords = {{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}};
+
+        auto otherGeometryData = createTriangle();
+        otherGeometryData.vertexColors = {{1.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f}};
+        otherGeometryData.customVertexAttributes = {std::vector<std::byte>(3 * sizeof(float), std::byte(1))};
+
+        FabricGeometryDataUtil::appendGeometryData(geometryData, otherGeometryData, glm::dmat4(1.0));
+
+        REQUIRE(geometryData.texcoords.size() == 1);
+        REQUIRE(geometryData.texcoords[0].size() == 6);
+        CHECK(geometryData.texcoords[0][2] == glm::fvec2(0.0f, 1.0f));
+        CHECK(geometryData.texcoords[0][4] == glm::fvec2(0.0f, 0.0f));
+
+        REQUIRE(geometryData.vertexColors.size() == 6);
+        CHECK(geometryData.vertexColors[0] == glm::fvec4(0.0f));
+        CHECK(geometryData.vertexColors[3] == glm::fvec4(1.0f, 0.0f, 0.0f, 1.0f));
+
+        REQUIRE(geometryData.customVertexAttributes.size() == 1);
+        REQUIRE(geometryData.customVertexAttributes[0].size() == 6 * sizeof(float));
+        CHECK(geometryData.customVertexAttributes[0][0] == std::byte(0));
+        CHECK(geometryData.customVertexAttributes[0][3 * sizeof(float)] == std::byte(1));
+    }
+}
@@ -0,0 +1,144 @@
+#include "cesium/omniverse/DataType.h"
+#include "cesium/omniverse/FabricGeometryDescriptor.h"
+#include "cesium/omniverse/FabricMaterialInfo.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
+#include "cesium/omniverse/FabricVertexAttributeDescriptor.h"
+
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <doctest/doctest.h>
+#include <glm/glm.hpp>
+#include <omni/fabric/IToken.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+constexpr uint64_t POOL_COUNTS[] = {100, 500, 2000};
+constexpr uint64_t SHARED_MATERIAL_COUNTS[] = {100, 1000, 5000};
+
+// Metadata-heavy tilesets get a geometry pool for every distinct set of feature id and custom vertex attributes
+std::vector<FabricGeometryDescriptor> createGeometryDescriptors(uint64_t count) {
+    const CesiumGltf::Model model;
+    const CesiumGltf::MeshPrimitive primitive;
+
+    std::vector<FabricGeometryDescriptor> geometryDescriptors;
+    geometryDescriptors.reserve(count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        FabricPrimitiveInfo primitiveInfo;
+
+        for (uint64_t j = 0; j < 4; ++j) {
+            const auto attributeName = "_FEATURE_ID_" + std::to_string(i + j);
+            const auto fabricAttributeNameStr = "primvars:" + attributeName;
+
+            // In C++ 20 this can be emplace without the {}
+            primitiveInfo.customVertexAttributes.insert(FabricVertexAttributeDescriptor{
+                DataType::UINT32,
+                omni::fabric::Token(fabricAttributeNameStr.c_str()),
+                attributeName,
+            });
+        }
+
+        geometryDescriptors.emplace_back(model, primitive, primitiveInfo, false, false);
+    }
+
+    return geometryDescriptors;
+}
+
+// Materials that only differ in their base color can't share a material
+std::vector<FabricMaterialInfo> createMaterialInfos(uint64_t count) {
+    std::vector<FabricMaterialInfo> materialInfos;
+    materialInfos.reserve(count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        const auto value = static_cast<double>(i) / static_cast<double>(count);
+
+        // In C++ 20 this can be emplace_back without the {}
+        materialInfos.push_back({
+            0.5,
+            FabricAlphaMode::MASK,
+            1.0,
+            glm::dvec3(value, 1.0 - value, 0.5),
+            glm::dvec3(0.0),
+            0.0,
+            1.0,
+            false,
+            false,
+            std::nullopt,
+        });
+    }
+
+    return materialInfos;
+}
+
+// This is how pools and shared materials were found before they were indexed by hash
+template <typename T> uint64_t findReference(const std::vector<T>& values, const T& value) {
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        if (values[i] == value) {
+            return i;
+        }
+    }
+
+    return values.size();
+}
+
+template <typename T> void benchmarkLookup(const std::vector<T>& keys, const std::string& name) {
+    std::unordered_map<T, uint64_t> index;
+    index.reserve(keys.size());
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        index.emplace(keys[i], i);
+    }
+
+    CHECK(index.size() == keys.size());
+
+    // Every acquire looks up the pool or shared material and every release looks it up again
+    uint64_t referenceSum = 0;
+    const auto referenceStart = std::chrono::steady_clock::now();
+    for (const auto& key : keys) {
+        referenceSum += findReference(keys, key);
+        referenceSum += findReference(keys, key);
+    }
+    const auto referenceEnd = std::chrono::steady_clock::now();
+
+    uint64_t sum = 0;
+    for (const auto& key : keys) {
+        sum += index.find(key)->second;
+        sum += index.find(key)->second;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    CHECK(sum == referenceSum);
+    CHECK(sum == keys.size() * (keys.size() - 1));
+
+    const auto toMilliseconds = [](const auto& duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    MESSAGE(keys.size(), " ", name);
+    MESSAGE("Acquire and release, linear scan: ", toMilliseconds(referenceEnd - referenceStart), " ms");
+    MESSAGE("Acquire and release, hash index: ", toMilliseconds(end - referenceEnd), " ms");
+}
+
+} // namespace
+
+TEST_SUITE("Test FabricResourceManager") {
+    TEST_CASE("Benchmark finding geometry pools") {
+        for (const auto count : POOL_COUNTS) {
+            benchmarkLookup(createGeometryDescriptors(count), "geometry pools");
+        }
+    }
+
+    TEST_CASE("Benchmark finding shared materials") {
+        for (const auto count : SHARED_MATERIAL_COUNTS) {
+            benchmarkLookup(createMaterialInfos(count), "shared materials");
+        }
+    }
+}
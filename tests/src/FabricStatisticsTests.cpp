@@ -0,0 +1,139 @@
+#include "FabricStatisticsTests.h"
+
+#include "cesium/omniverse/Context.h"
+#include "cesium/omniverse/FabricGeometry.h"
+#include "cesium/omniverse/FabricGeometryDescriptor.h"
+#include "cesium/omniverse/FabricPrimitiveInfo.h"
+#include "cesium/omniverse/FabricResourceManager.h"
+#include "cesium/omniverse/FabricStatistics.h"
+#include "cesium/omniverse/FabricUtil.h"
+
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <doctest/doctest.h>
+#include <glm/glm.hpp>
+#include <omni/fabric/IPath.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+Context* pFabricStatisticsContext;
+
+// Arbitrary tileset id that no tileset on the stage uses
+const int64_t TEST_TILESET_ID = 1000000;
+
+// A unit right triangle in the xy plane without indices
+CesiumGltf::Model createTriangleModel() {
+    const std::vector<glm::fvec3> positions{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+
+    CesiumGltf::Model model;
+
+    auto& buffer = model.buffers.emplace_back();
+    buffer.cesium.data.resize(positions.size() * sizeof(glm::fvec3));
+    std::memcpy(buffer.cesium.data.data(), positions.data(), buffer.cesium.data.size());
+    buffer.byteLength = static_cast<int64_t>(buffer.cesium.data.size());
+
+    auto& bufferView = model.bufferViews.emplace_back();
+    bufferView.buffer = 0;
+    bufferView.byteLength = buffer.byteLength;
+
+    auto& accessor = model.accessors.emplace_back();
+    accessor.bufferView = 0;
+    accessor.count = static_cast<int64_t>(positions.size());
+    accessor.type = CesiumGltf::Accessor::Type::VEC3;
+    accessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+    accessor.min = {0.0, 0.0, 0.0};
+    accessor.max = {1.0, 1.0, 0.0};
+
+    auto& primitive = model.meshes.emplace_back().primitives.emplace_back();
+    primitive.attributes["POSITION"] = 0;
+
+    return model;
+}
+
+// Geometries are counted separately from materials, which are intentionally leaked when their pool is destroyed
+void checkGeometryStatistics(
+    const FabricStatistics& counted,
+    const FabricStatistics& countedBefore,
+    const FabricStatistics& scanned,
+    const FabricStatistics& scannedBefore) {
+    CHECK(counted.geometriesCapacity - countedBefore.geometriesCapacity ==
+          scanned.geometriesCapacity - scannedBefore.geometriesCapacity);
+    CHECK(counted.geometriesLoaded - countedBefore.geometriesLoaded ==
+          scanned.geometriesLoaded - scannedBefore.geometriesLoaded);
+    CHECK(counted.geometriesRendered - countedBefore.geometriesRendered ==
+          scanned.geometriesRendered - scannedBefore.geometriesRendered);
+    CHECK(counted.trianglesLoaded - countedBefore.trianglesLoaded ==
+          scanned.trianglesLoaded - scannedBefore.trianglesLoaded);
+    CHECK(counted.trianglesRendered - countedBefore.trianglesRendered ==
+          scanned.trianglesRendered - scannedBefore.trianglesRendered);
+    CHECK(counted.geometryBytesLoaded - countedBefore.geometryBytesLoaded ==
+          scanned.geometryBytesLoaded - scannedBefore.geometryBytesLoaded);
+}
+
+} // namespace
+
+void setUpFabricStatisticsTests(Context* pContext) {
+    pFabricStatisticsContext = pContext;
+}
+
+TEST_SUITE("Test FabricStatistics") {
+    TEST_CASE("Geometry statistics match a scan of Fabric") {
+        auto& fabricStage = pFabricStatisticsContext->getFabricStage();
+        const auto& fabricResourceManager = pFabricStatisticsContext->getFabricResourceManager();
+
+        // Other contexts may have prims on the same Fabric stage so only the changes are compared
+        const auto countedBefore = fabricResourceManager.getStatistics();
+        const auto scannedBefore = FabricUtil::getStatistics(fabricStage);
+
+        const auto check = [&]() {
+            checkGeometryStatistics(
+                fabricResourceManager.getStatistics(),
+                countedBefore,
+                FabricUtil::getStatistics(fabricStage),
+                scannedBefore);
+        };
+
+        const auto model = createTriangleModel();
+        const auto& primitive = model.meshes[0].primitives[0];
+        const FabricPrimitiveInfo primitiveInfo;
+        const FabricGeometryDescriptor geometryDescriptor(model, primitive, primitiveInfo, false, false);
+        const auto geometryData = FabricGeometry::computeGeometryData(
+            geometryDescriptor, model, primitive, primitiveInfo.materialInfo, false, {}, {});
+        REQUIRE(!geometryData.points.empty());
+
+        const omni::fabric::Path path("/cesium_statistics_test_geometry");
+        auto pGeometry = std::make_unique<FabricGeometry>(pFabricStatisticsContext, path, geometryDescriptor, 0);
+
+        pGeometry->initialize();
+        check();
+
+        pGeometry->setGeometry(TEST_TILESET_ID, glm::dmat4(1.0), glm::dmat4(1.0), geometryData);
+        check();
+
+        FabricUtil::setVisibility(fabricStage, TEST_TILESET_ID, {path}, true);
+        pGeometry->setRendered(true);
+        check();
+
+        FabricUtil::setVisibility(fabricStage, TEST_TILESET_ID, {path}, false);
+        pGeometry->setRendered(false);
+        check();
+
+        FabricUtil::setVisibility(fabricStage, TEST_TILESET_ID, {path}, true);
+        pGeometry->setRendered(true);
+        pGeometry->setActive(false);
+        check();
+
+        pGeometry = nullptr;
+        check();
+
+        CHECK(fabricResourceManager.getStatistics() == countedBefore);
+    }
+}
@@ -0,0 +1,230 @@
+#include "testUtils.h"
+
+#include <cesium/omniverse/MathUtil.h>
+#include <doctest/doctest.h>
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+// A 708 x 707 quad grid has just over 1 million triangles
+constexpr uint64_t GRID_WIDTH = 708;
+constexpr uint64_t GRID_HEIGHT = 707;
+
+struct SyntheticMesh {
+    std::vector<glm::fvec3> positions;
+    std::vector<int> indices;
+};
+
+SyntheticMesh createWavyGrid() {
+    SyntheticMesh mesh;
+
+    for (uint64_t y = 0; y <= GRID_HEIGHT; ++y) {
+        for (uint64_t x = 0; x <= GRID_WIDTH; ++x) {
+            const auto fx = static_cast<float>(x);
+            const auto fy = static_cast<float>(y);
+            mesh.positions.emplace_back(fx, fy, std::sin(fx * 0.1f) * std::cos(fy * 0.1f) * 5.0f);
+        }
+    }
+
+    const auto rowSize = static_cast<int>(GRID_WIDTH + 1);
+
+    for (uint64_t y = 0; y < GRID_HEIGHT; ++y) {
+        for (uint64_t x = 0; x < GRID_WIDTH; ++x) {
+            const auto i = static_cast<int>(y) * rowSize + static_cast<int>(x);
+            mesh.indices.insert(mesh.indices.end(), {i, i + 1, i + rowSize});
+            mesh.indices.insert(mesh.indices.end(), {i + 1, i + rowSize + 1, i + rowSize});
+        }
+    }
+
+    return mesh;
+}
+
+// The serial implementation that NormalsAccessor::GenerateSmooth used before MathUtil::computeSmoothNormals
+void computeSmoothNormalsReference(const SyntheticMesh& mesh, std::vector<glm::fvec3>& normals) {
+    normals.assign(mesh.positions.size(), glm::fvec3(0.0f));
+
+    for (uint64_t i = 0; i < mesh.indices.size(); i += 3) {
+        const auto idx0 = static_cast<uint64_t>(mesh.indices[i]);
+        const auto idx1 = static_cast<uint64_t>(mesh.indices[i + 1]);
+        const auto idx2 = static_cast<uint64_t>(mesh.indices[i + 2]);
+
+        const auto& p0 = mesh.positions[idx0];
+        const auto& p1 = mesh.positions[idx1];
+        const auto& p2 = mesh.positions[idx2];
+        auto n = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+
+        normals[idx0] += n;
+        normals[idx1] += n;
+        normals[idx2] += n;
+    }
+
+    for (auto& n : normals) {
+        n = glm::normalize(n);
+    }
+}
+
+struct SyntheticPrims {
+    std::vector<glm::dmat4> gltfLocalToEcefTransforms;
+    std::vector<std::array<glm::dvec3, 2>> gltfLocalExtents;
+};
+
+// Tile-like prims: ECEF-sized translations, arbitrary rotations, and a mix of uniform, non-uniform, and mirrored scales
+SyntheticPrims createSyntheticPrims(uint64_t count) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_real_distribution<double> scale(0.5, 2.0);
+
+    SyntheticPrims prims;
+    prims.gltfLocalToEcefTransforms.reserve(count);
+    prims.gltfLocalExtents.reserve(count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        const auto translation = glm::dvec3(unit(generator), unit(generator), unit(generator)) * 6378137.0;
+        const auto rotation =
+            glm::normalize(glm::dquat(unit(generator), unit(generator), unit(generator), unit(generator)));
+        auto primScale = glm::dvec3(scale(generator), scale(generator), scale(generator));
+
+        if (i % 7 == 0) {
+            primScale.y = -primScale.y;
+        }
+
+        const auto center = glm::dvec3(unit(generator), unit(generator), unit(generator)) * 100.0;
+        const auto halfSize = glm::abs(glm::dvec3(unit(generator), unit(generator), unit(generator))) * 50.0;
+
+        prims.gltfLocalToEcefTransforms.push_back(MathUtil::compose(translation, rotation, primScale));
+        prims.gltfLocalExtents.push_back({{center - halfSize, center + halfSize}});
+    }
+
+    return prims;
+}
+
+const glm::dmat4 ECEF_TO_PRIM_WORLD_TRANSFORM = MathUtil::compose(
+    glm::dvec3(-1215000.0, 4736000.0, -4081000.0),
+    glm::normalize(glm::dquat(0.3, -0.5, 0.7, 0.1)),
+    glm::dvec3(0.01));
+
+TEST_SUITE("Test MathUtil") {
+    TEST_CASE("Smooth normals match the reference implementation") {
+        const auto mesh = createWavyGrid();
+
+        REQUIRE(mesh.indices.size() / 3 > 1000000);
+
+        std::vector<glm::fvec3> expected;
+        std::vector<glm::fvec3> actual(mesh.positions.size());
+
+        const auto referenceStart = std::chrono::steady_clock::now();
+        computeSmoothNormalsReference(mesh, expected);
+        const auto referenceEnd = std::chrono::steady_clock::now();
+        MathUtil::computeSmoothNormals(mesh.positions, mesh.indices, actual);
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto referenceTime = std::chrono::duration<double, std::milli>(referenceEnd - referenceStart).count();
+        const auto time = std::chrono::duration<double, std::milli>(end - referenceEnd).count();
+
+        MESSAGE("Reference: ", referenceTime, " ms");
+        MESSAGE("MathUtil::computeSmoothNormals: ", time, " ms");
+
+        uint64_t mismatchCount = 0;
+
+        for (uint64_t i = 0; i < expected.size(); ++i) {
+            if (glm::any(glm::greaterThan(glm::abs(expected[i] - actual[i]), glm::fvec3(1e-5f)))) {
+                ++mismatchCount;
+            }
+        }
+
+        CHECK(mismatchCount == 0);
+    }
+
+    TEST_CASE("Smooth normals ignore degenerate triangles") {
+        const std::vector<glm::fvec3> positions{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+        const std::vector<int> indices{0, 1, 2, 0, 0, 1};
+        std::vector<glm::fvec3> normals(positions.size());
+
+        MathUtil::computeSmoothNormals(positions, indices, normals);
+
+        for (const auto& n : normals) {
+            CHECK(n == glm::fvec3(0.0f, 0.0f, 1.0f));
+        }
+    }
+
+    TEST_CASE("Batched world transforms match decompose and transformExtent") {
+        const auto prims = createSyntheticPrims(1000);
+        const auto count = prims.gltfLocalToEcefTransforms.size();
+
+        std::vector<glm::dvec3> worldPositions(count);
+        std::vector<glm::fquat> worldOrientations(count);
+        std::vector<glm::fvec3> worldScales(count);
+        std::vector<std::array<glm::dvec3, 2>> worldExtents(count);
+
+        MathUtil::computeWorldTransforms(
+            ECEF_TO_PRIM_WORLD_TRANSFORM,
+            prims.gltfLocalToEcefTransforms,
+            prims.gltfLocalExtents,
+            worldPositions,
+            worldOrientations,
+            worldScales,
+            worldExtents);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            const auto transform = ECEF_TO_PRIM_WORLD_TRANSFORM * prims.gltfLocalToEcefTransforms[i];
+            const auto expected = MathUtil::decompose(transform);
+            const auto expectedExtent = MathUtil::transformExtent(prims.gltfLocalExtents[i], transform);
+
+            CHECK(MathUtil::epsilonEqual(worldPositions[i], expected.translation, 1e-6));
+            CHECK(MathUtil::epsilonEqual(glm::dvec3(worldScales[i]), glm::dvec3(glm::fvec3(expected.scale)), 1e-6));
+            CHECK(std::abs(glm::dot(worldOrientations[i], glm::fquat(expected.rotation))) == doctest::Approx(1.0f));
+            CHECK(MathUtil::epsilonEqual(worldExtents[i][0], expectedExtent[0], 1e-6));
+            CHECK(MathUtil::epsilonEqual(worldExtents[i][1], expectedExtent[1], 1e-6));
+        }
+    }
+
+    TEST_CASE("Batched world transforms benchmark") {
+        const std::array<uint64_t, 3> primCounts{{10000, 50000, 100000}};
+
+        for (const auto count : primCounts) {
+            const auto prims = createSyntheticPrims(count);
+
+            std::vector<glm::dvec3> worldPositions(count);
+            std::vector<glm::fquat> worldOrientations(count);
+            std::vector<glm::fvec3> worldScales(count);
+            std::vector<std::array<glm::dvec3, 2>> worldExtents(count);
+
+            // The per-prim loop that FabricUtil::setTilesetTransform used before MathUtil::computeWorldTransforms
+            const auto referenceStart = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < count; ++i) {
+                const auto transform = ECEF_TO_PRIM_WORLD_TRANSFORM * prims.gltfLocalToEcefTransforms[i];
+                const auto [position, orientation, scale] = MathUtil::decompose(transform);
+                worldPositions[i] = position;
+                worldOrientations[i] = glm::fquat(orientation);
+                worldScales[i] = glm::fvec3(scale);
+                worldExtents[i] = MathUtil::transformExtent(prims.gltfLocalExtents[i], transform);
+            }
+            const auto referenceEnd = std::chrono::steady_clock::now();
+            MathUtil::computeWorldTransforms(
+                ECEF_TO_PRIM_WORLD_TRANSFORM,
+                prims.gltfLocalToEcefTransforms,
+                prims.gltfLocalExtents,
+                worldPositions,
+                worldOrientations,
+                worldScales,
+                worldExtents);
+            const auto end = std::chrono::steady_clock::now();
+
+            const auto referenceTime = std::chrono::duration<double, std::milli>(referenceEnd - referenceStart).count();
+            const auto time = std::chrono::duration<double, std::milli>(end - referenceEnd).count();
+
+            MESSAGE(count, " prims");
+            MESSAGE("Reference: ", referenceTime, " ms");
+            MESSAGE("MathUtil::computeWorldTransforms: ", time, " ms");
+
+            CHECK(worldPositions.size() == count);
+        }
+    }
+}
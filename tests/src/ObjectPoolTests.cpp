@@ -4,10 +4,12 @@
 #include <doctest/doctest.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <queue>
+#include <vector>
 
 constexpr int MAX_TESTED_POOL_SIZE = 1024; // The max size pool to randomly generate
 
@@ -137,4 +139,135 @@ TEST_SUITE("Test ObjectPool") {
             testRandomSequenceOfCmds(opl, numEvents, true);
         }
     }
+
+    TEST_CASE("Test growing") {
+        MockObjectPool opl = MockObjectPool();
+
+        SUBCASE("Default growth factor doubles capacity") {
+            opl.setCapacity(4);
+            std::vector<std::shared_ptr<MockObject>> objects;
+            for (int i = 0; i < 4; ++i) {
+                objects.push_back(opl.acquire());
+            }
+            CHECK(opl.getCapacity() == 4);
+
+            objects.push_back(opl.acquire());
+            CHECK(opl.getCapacity() == 8);
+        }
+
+        SUBCASE("Custom growth factor") {
+            opl.setGrowthFactor(1.5);
+            opl.setCapacity(4);
+            std::vector<std::shared_ptr<MockObject>> objects;
+            for (int i = 0; i < 5; ++i) {
+                objects.push_back(opl.acquire());
+            }
+            CHECK(opl.getCapacity() == 6);
+        }
+
+        SUBCASE("Growth factor of 1 still grows") {
+            opl.setGrowthFactor(1.0);
+            std::vector<std::shared_ptr<MockObject>> objects;
+            for (int i = 0; i < 10; ++i) {
+                objects.push_back(opl.acquire());
+            }
+            CHECK(opl.getNumberActive() == 10);
+            CHECK(opl.getCapacity() >= 10);
+        }
+    }
+
+    TEST_CASE("Test shrinking") {
+        MockObjectPool opl = MockObjectPool();
+        opl.setCapacity(16);
+
+        std::vector<std::shared_ptr<MockObject>> objects;
+        for (int i = 0; i < 4; ++i) {
+            objects.push_back(opl.acquire());
+        }
+
+        SUBCASE("Shrink only destroys inactive objects") {
+            opl.setCapacity(0);
+            CHECK(opl.getCapacity() == 4);
+            CHECK(opl.getNumberActive() == 4);
+            CHECK(opl.getNumberInactive() == 0);
+        }
+
+        SUBCASE("Shrink to a smaller capacity") {
+            opl.setCapacity(10);
+            CHECK(opl.getCapacity() == 10);
+            CHECK(opl.getNumberActive() == 4);
+            CHECK(opl.getNumberInactive() == 6);
+        }
+
+        SUBCASE("Released objects can be reacquired after shrinking") {
+            opl.setCapacity(4);
+            for (auto& pObject : objects) {
+                opl.release(pObject);
+            }
+            objects.clear();
+            CHECK(opl.getCapacity() == 4);
+            CHECK(opl.isEmpty());
+
+            const auto pObject = opl.acquire();
+            CHECK(pObject->active);
+        }
+    }
+
+    TEST_CASE("Test trimming") {
+        using namespace std::chrono_literals;
+
+        MockObjectPool opl = MockObjectPool();
+        opl.setCapacity(8);
+
+        std::vector<std::shared_ptr<MockObject>> objects;
+        for (int i = 0; i < 4; ++i) {
+            objects.push_back(opl.acquire());
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+
+        SUBCASE("Trimming is disabled by default") {
+            CHECK(opl.trim(now + 1000s) == 0);
+            CHECK(opl.getCapacity() == 8);
+        }
+
+        SUBCASE("Objects that haven't been idle long enough are kept") {
+            opl.setMaximumIdleTime(10.0);
+            CHECK(opl.trim(now) == 0);
+            CHECK(opl.getCapacity() == 8);
+        }
+
+        SUBCASE("Idle objects are destroyed") {
+            opl.setMaximumIdleTime(10.0);
+            CHECK(opl.trim(now + 20s) == 4);
+            CHECK(opl.getCapacity() == 4);
+            CHECK(opl.getNumberActive() == 4);
+            CHECK(opl.getNumberInactive() == 0);
+        }
+
+        SUBCASE("Trimming respects the low-water mark") {
+            opl.setMaximumIdleTime(10.0);
+            opl.setLowWaterMark(6);
+            CHECK(opl.trim(now + 20s) == 2);
+            CHECK(opl.getCapacity() == 6);
+        }
+
+        SUBCASE("Recently released objects are trimmed last") {
+            opl.setMaximumIdleTime(10.0);
+            CHECK(opl.trim(now + 20s) == 4);
+
+            for (auto& pObject : objects) {
+                opl.release(pObject);
+            }
+            objects.clear();
+
+            // The objects were just released so they haven't been idle long enough
+            CHECK(opl.trim(std::chrono::steady_clock::now()) == 0);
+            CHECK(opl.getCapacity() == 4);
+
+            CHECK(opl.trim(std::chrono::steady_clock::now() + 20s) == 4);
+            CHECK(opl.getCapacity() == 0);
+            CHECK(opl.isEmpty());
+        }
+    }
 }
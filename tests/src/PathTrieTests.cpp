@@ -0,0 +1,88 @@
+#include <cesium/omniverse/PathTrie.h>
+#include <doctest/doctest.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+std::vector<pxr::SdfPath> getPrimOrDescendantPaths(const PathTrie<int>& trie, const pxr::SdfPath& path) {
+    std::vector<pxr::SdfPath> paths;
+    trie.forEachPrimOrDescendant(
+        path, [&paths](const pxr::SdfPath& descendantPath, [[maybe_unused]] int value) {
+            paths.push_back(descendantPath);
+        });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+} // namespace
+
+TEST_SUITE("Test PathTrie") {
+    TEST_CASE("Insert, find, and erase") {
+        PathTrie<int> trie;
+
+        const auto a = pxr::SdfPath("/World/A");
+        const auto b = pxr::SdfPath("/World/A/B");
+        const auto c = pxr::SdfPath("/World/C");
+
+        trie.insert(a) = 1;
+        trie.insert(b) = 2;
+        trie.insert(c) = 3;
+
+        CHECK(trie.size() == 3);
+        CHECK(*trie.find(a) == 1);
+        CHECK(*trie.find(b) == 2);
+        CHECK(*trie.find(c) == 3);
+
+        // Intermediate nodes don't have values
+        CHECK(trie.find(pxr::SdfPath("/World")) == nullptr);
+        CHECK(trie.find(pxr::SdfPath("/World/A/B/D")) == nullptr);
+
+        // Inserting an existing path returns the existing value
+        CHECK(trie.insert(a) == 1);
+        CHECK(trie.size() == 3);
+
+        CHECK(trie.erase(a));
+        CHECK_FALSE(trie.erase(a));
+        CHECK(trie.find(a) == nullptr);
+        CHECK(*trie.find(b) == 2);
+        CHECK(trie.size() == 2);
+
+        CHECK(trie.erase(b));
+        CHECK(trie.erase(c));
+        CHECK(trie.empty());
+    }
+
+    TEST_CASE("Visit a subtree") {
+        PathTrie<int> trie;
+
+        trie.insert(pxr::SdfPath("/World/Scope/A")) = 0;
+        trie.insert(pxr::SdfPath("/World/Scope/A/B")) = 0;
+        trie.insert(pxr::SdfPath("/World/Scope/C")) = 0;
+        trie.insert(pxr::SdfPath("/World/ScopeSibling")) = 0;
+        trie.insert(pxr::SdfPath("/Other")) = 0;
+
+        const auto scopePaths = getPrimOrDescendantPaths(trie, pxr::SdfPath("/World/Scope"));
+        CHECK(
+            scopePaths == std::vector<pxr::SdfPath>{
+                              pxr::SdfPath("/World/Scope/A"),
+                              pxr::SdfPath("/World/Scope/A/B"),
+                              pxr::SdfPath("/World/Scope/C"),
+                          });
+
+        const auto primPaths = getPrimOrDescendantPaths(trie, pxr::SdfPath("/World/Scope/A/B"));
+        CHECK(primPaths == std::vector<pxr::SdfPath>{pxr::SdfPath("/World/Scope/A/B")});
+
+        CHECK(getPrimOrDescendantPaths(trie, pxr::SdfPath("/Missing")).empty());
+        CHECK(getPrimOrDescendantPaths(trie, pxr::SdfPath::AbsoluteRootPath()).size() == 5);
+
+        trie.clear();
+        CHECK(trie.empty());
+        CHECK(getPrimOrDescendantPaths(trie, pxr::SdfPath::AbsoluteRootPath()).empty());
+    }
+}
@@ -0,0 +1,208 @@
+#include <CesiumGltf/ImageCesium.h>
+#include <cesium/omniverse/TextureCompressionUtil.h>
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+constexpr int32_t IMAGE_WIDTH = 256;
+constexpr int32_t IMAGE_HEIGHT = 256;
+
+// A smooth gradient with some noise, similar to aerial imagery
+CesiumGltf::ImageCesium createImage(bool withAlpha) {
+    CesiumGltf::ImageCesium image;
+    image.width = IMAGE_WIDTH;
+    image.height = IMAGE_HEIGHT;
+    image.channels = 4;
+    image.bytesPerChannel = 1;
+    image.pixelData.resize(static_cast<uint64_t>(IMAGE_WIDTH * IMAGE_HEIGHT * 4));
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> noise(-8, 8);
+
+    const auto clampToByte = [](int value) { return std::byte(static_cast<uint8_t>(std::clamp(value, 0, 255))); };
+
+    for (int32_t y = 0; y < IMAGE_HEIGHT; ++y) {
+        for (int32_t x = 0; x < IMAGE_WIDTH; ++x) {
+            const auto i = static_cast<uint64_t>((y * IMAGE_WIDTH + x) * 4);
+            image.pixelData[i + 0] = clampToByte(x + noise(generator));
+            image.pixelData[i + 1] = clampToByte(y + noise(generator));
+            image.pixelData[i + 2] = clampToByte((x + y) / 2 + noise(generator));
+            image.pixelData[i + 3] = withAlpha ? clampToByte(255 - x) : std::byte(255);
+        }
+    }
+
+    return image;
+}
+
+std::array<int, 3> decodeColor565(uint16_t color) {
+    const auto r = (color >> 11) & 31;
+    const auto g = (color >> 5) & 63;
+    const auto b = color & 31;
+    return {{(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)}};
+}
+
+uint64_t readBytes(const std::byte* pBytes, uint64_t count) {
+    uint64_t value = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        value |= static_cast<uint64_t>(pBytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+// A straightforward BCn decoder that follows the specification
+std::vector<uint8_t> decodeImage(const CesiumGltf::ImageCesium& compressedImage) {
+    const auto width = static_cast<uint64_t>(compressedImage.width);
+    const auto height = static_cast<uint64_t>(compressedImage.height);
+    const auto hasAlpha = compressedImage.compressedPixelFormat == CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA;
+    const auto blockByteLength = hasAlpha ? 16ULL : 8ULL;
+
+    std::vector<uint8_t> pixels(width * height * 4, 255);
+
+    for (uint64_t blockY = 0; blockY < height / 4; ++blockY) {
+        for (uint64_t blockX = 0; blockX < width / 4; ++blockX) {
+            auto pBlock = compressedImage.pixelData.data() + (blockY * (width / 4) + blockX) * blockByteLength;
+
+            std::array<int, 8> alphaPalette{};
+            uint64_t alphaIndices = 0;
+
+            if (hasAlpha) {
+                const auto alpha0 = static_cast<int>(pBlock[0]);
+                const auto alpha1 = static_cast<int>(pBlock[1]);
+                alphaPalette[0] = alpha0;
+                alphaPalette[1] = alpha1;
+                for (int i = 1; i < 7; ++i) {
+                    alphaPalette[static_cast<uint64_t>(i + 1)] =
+                        alpha0 > alpha1 ? ((7 - i) * alpha0 + i * alpha1 + 3) / 7 : alpha0;
+                }
+                alphaIndices = readBytes(pBlock + 2, 6);
+                pBlock += 8;
+            }
+
+            const auto color0 = static_cast<uint16_t>(readBytes(pBlock, 2));
+            const auto color1 = static_cast<uint16_t>(readBytes(pBlock + 2, 2));
+            const auto colorIndices = readBytes(pBlock + 4, 4);
+
+            const auto endpoint0 = decodeColor565(color0);
+            const auto endpoint1 = decodeColor565(color1);
+
+            for (uint64_t i = 0; i < 16; ++i) {
+                const auto colorIndex = (colorIndices >> (2 * i)) & 3;
+                const auto x = blockX * 4 + i % 4;
+                const auto y = blockY * 4 + i / 4;
+                const auto pPixel = pixels.data() + (y * width + x) * 4;
+
+                for (uint64_t c = 0; c < 3; ++c) {
+                    const std::array<int, 4> palette{{
+                        endpoint0[c],
+                        endpoint1[c],
+                        (2 * endpoint0[c] + endpoint1[c]) / 3,
+                        (endpoint0[c] + 2 * endpoint1[c]) / 3,
+                    }};
+                    pPixel[c] = static_cast<uint8_t>(palette[colorIndex]);
+                }
+
+                if (hasAlpha) {
+                    pPixel[3] = static_cast<uint8_t>(alphaPalette[(alphaIndices >> (3 * i)) & 7]);
+                }
+            }
+        }
+    }
+
+    return pixels;
+}
+
+double getRootMeanSquareError(const CesiumGltf::ImageCesium& image, const std::vector<uint8_t>& decodedPixels) {
+    auto sum = 0.0;
+    for (uint64_t i = 0; i < decodedPixels.size(); ++i) {
+        const auto difference =
+            static_cast<double>(static_cast<uint8_t>(image.pixelData[i])) - static_cast<double>(decodedPixels[i]);
+        sum += difference * difference;
+    }
+    return std::sqrt(sum / static_cast<double>(decodedPixels.size()));
+}
+
+} // namespace
+
+TEST_SUITE("Test TextureCompressionUtil") {
+    TEST_CASE("Only uncompressed RGBA8 images with block aligned dimensions can be compressed") {
+        const auto image = createImage(false);
+        CHECK(TextureCompressionUtil::canCompressImage(image));
+
+        auto unaligned = createImage(false);
+        unaligned.width = IMAGE_WIDTH - 2;
+        CHECK_FALSE(TextureCompressionUtil::canCompressImage(unaligned));
+
+        auto twoChannels = createImage(false);
+        twoChannels.channels = 2;
+        CHECK_FALSE(TextureCompressionUtil::canCompressImage(twoChannels));
+
+        const auto compressed = TextureCompressionUtil::compressImage(image, TextureCompression::FAST);
+        CHECK_FALSE(TextureCompressionUtil::canCompressImage(compressed));
+    }
+
+    TEST_CASE("Opaque images are compressed to BC1 and transparent images to BC3") {
+        const auto opaqueImage = createImage(false);
+        const auto transparentImage = createImage(true);
+        const auto uncompressedByteLength = opaqueImage.pixelData.size();
+
+        for (const auto textureCompression : {TextureCompression::FAST, TextureCompression::QUALITY}) {
+            const auto opaque = TextureCompressionUtil::compressImage(opaqueImage, textureCompression);
+            CHECK(opaque.compressedPixelFormat == CesiumGltf::GpuCompressedPixelFormat::BC1_RGB);
+            CHECK(opaque.pixelData.size() == uncompressedByteLength / 8);
+            CHECK(getRootMeanSquareError(opaqueImage, decodeImage(opaque)) < 8.0);
+
+            const auto transparent = TextureCompressionUtil::compressImage(transparentImage, textureCompression);
+            CHECK(transparent.compressedPixelFormat == CesiumGltf::GpuCompressedPixelFormat::BC3_RGBA);
+            CHECK(transparent.pixelData.size() == uncompressedByteLength / 4);
+            CHECK(getRootMeanSquareError(transparentImage, decodeImage(transparent)) < 8.0);
+        }
+    }
+
+    TEST_CASE("Solid blocks are encoded exactly") {
+        auto image = createImage(false);
+        for (uint64_t i = 0; i < image.pixelData.size(); i += 4) {
+            // Representable in 565 without loss
+            image.pixelData[i + 0] = std::byte(255);
+            image.pixelData[i + 1] = std::byte(0);
+            image.pixelData[i + 2] = std::byte(255);
+        }
+
+        for (const auto textureCompression : {TextureCompression::FAST, TextureCompression::QUALITY}) {
+            const auto compressed = TextureCompressionUtil::compressImage(image, textureCompression);
+            CHECK(getRootMeanSquareError(image, decodeImage(compressed)) == 0.0);
+        }
+    }
+
+    TEST_CASE("Quality preset has less error than the fast preset") {
+        const auto image = createImage(false);
+
+        const auto fastStart = std::chrono::steady_clock::now();
+        const auto fast = TextureCompressionUtil::compressImage(image, TextureCompression::FAST);
+        const auto fastEnd = std::chrono::steady_clock::now();
+        const auto quality = TextureCompressionUtil::compressImage(image, TextureCompression::QUALITY);
+        const auto qualityEnd = std::chrono::steady_clock::now();
+
+        const auto fastError = getRootMeanSquareError(image, decodeImage(fast));
+        const auto qualityError = getRootMeanSquareError(image, decodeImage(quality));
+
+        CHECK(qualityError <= fastError);
+
+        const auto toMegapixelsPerSecond = [](const auto& duration) {
+            const auto seconds = std::chrono::duration<double>(duration).count();
+            return static_cast<double>(IMAGE_WIDTH * IMAGE_HEIGHT) / 1e6 / seconds;
+        };
+
+        MESSAGE("Fast: ", toMegapixelsPerSecond(fastEnd - fastStart), " MP/s, RMSE ", fastError);
+        MESSAGE("Quality: ", toMegapixelsPerSecond(qualityEnd - fastEnd), " MP/s, RMSE ", qualityError);
+    }
+}
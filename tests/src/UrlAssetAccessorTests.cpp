@@ -0,0 +1,291 @@
+#include "testUtils.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <cesium/omniverse/TaskProcessor.h>
+#include <cesium/omniverse/UrlAssetAccessor.h>
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace cesium::omniverse;
+
+constexpr uint64_t CONCURRENT_REQUEST_COUNT = 200;
+constexpr uint64_t RESPONSE_SIZE = 64 * 1024;
+constexpr uint64_t LARGE_REQUEST_COUNT = 16;
+constexpr uint64_t LARGE_RESPONSE_SIZE = 8 * 1024 * 1024;
+
+// A minimal HTTP/1.1 server on localhost that answers every request with the same body. It stands in for a
+// tile server so that the accessor can be exercised without network access. When Content-Length is omitted
+// the end of the body is signaled by closing the connection, otherwise connections are kept alive.
+class LocalHttpServer {
+  public:
+#ifdef _WIN32
+    using Socket = SOCKET;
+    using SocketLength = int;
+#else
+    using Socket = int;
+    using SocketLength = socklen_t;
+#endif
+
+    LocalHttpServer(uint64_t responseSize, bool sendContentLength)
+        : _body(responseSize, 'x')
+        , _sendContentLength(sendContentLength) {
+#ifdef _WIN32
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+        _listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(_listenSocket, SOMAXCONN);
+
+        SocketLength addressLength = sizeof(address);
+        getsockname(_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength);
+        _port = ntohs(address.sin_port);
+
+        _acceptThread = std::thread([this]() { acceptConnections(); });
+    }
+
+    ~LocalHttpServer() {
+        _stopped = true;
+
+        // Wake up the accept thread with a dummy connection
+        const auto wakeSocket = connectToServer();
+        _acceptThread.join();
+        closeSocket(wakeSocket);
+        closeSocket(_listenSocket);
+
+        {
+            std::lock_guard<std::mutex> lock(_connectionsMutex);
+            for (const auto connection : _connections) {
+#ifdef _WIN32
+                shutdown(connection, SD_BOTH);
+#else
+                shutdown(connection, SHUT_RDWR);
+#endif
+            }
+        }
+
+        for (auto& thread : _connectionThreads) {
+            thread.join();
+        }
+
+        for (const auto connection : _connections) {
+            closeSocket(connection);
+        }
+
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    LocalHttpServer(const LocalHttpServer&) = delete;
+    LocalHttpServer& operator=(const LocalHttpServer&) = delete;
+    LocalHttpServer(LocalHttpServer&&) noexcept = delete;
+    LocalHttpServer& operator=(LocalHttpServer&&) noexcept = delete;
+
+    [[nodiscard]] std::string getUrl() const {
+        return "http://127.0.0.1:" + std::to_string(_port) + "/tile";
+    }
+
+    [[nodiscard]] uint64_t getRequestCount() const {
+        return _requestCount;
+    }
+
+  private:
+    [[nodiscard]] Socket connectToServer() const {
+        const auto wakeSocket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(_port);
+        connect(wakeSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        return wakeSocket;
+    }
+
+    static void closeSocket(Socket socket) {
+#ifdef _WIN32
+        closesocket(socket);
+#else
+        close(socket);
+#endif
+    }
+
+    void acceptConnections() {
+        while (true) {
+            const auto connection = accept(_listenSocket, nullptr, nullptr);
+
+            if (_stopped) {
+                closeSocket(connection);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_connectionsMutex);
+            _connections.push_back(connection);
+            _connectionThreads.emplace_back([this, connection]() { serveConnection(connection); });
+        }
+    }
+
+    void serveConnection(Socket connection) {
+        const auto contentLength =
+            _sendContentLength ? "Content-Length: " + std::to_string(_body.size()) + "\r\n" : "Connection: close\r\n";
+        const auto response =
+            "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\n" + contentLength + "\r\n" + _body;
+
+        std::string buffer;
+        std::vector<char> chunk(4096);
+
+        while (true) {
+            const auto received = recv(connection, chunk.data(), static_cast<int>(chunk.size()), 0);
+            if (received <= 0) {
+                break;
+            }
+
+            buffer.append(chunk.data(), static_cast<size_t>(received));
+
+            // Requests don't have a body so each blank line ends a request
+            auto end = buffer.find("\r\n\r\n");
+            while (end != std::string::npos) {
+                buffer.erase(0, end + 4);
+                ++_requestCount;
+                sendAll(connection, response);
+
+                if (!_sendContentLength) {
+                    // The client reads until the connection is closed. The socket itself is closed by the destructor.
+#ifdef _WIN32
+                    shutdown(connection, SD_SEND);
+#else
+                    shutdown(connection, SHUT_WR);
+#endif
+                    return;
+                }
+
+                end = buffer.find("\r\n\r\n");
+            }
+        }
+    }
+
+    static void sendAll(Socket connection, const std::string& data) {
+        size_t offset = 0;
+        while (offset < data.size()) {
+            const auto sent = send(connection, data.data() + offset, static_cast<int>(data.size() - offset), 0);
+            if (sent <= 0) {
+                return;
+            }
+            offset += static_cast<size_t>(sent);
+        }
+    }
+
+    std::string _body;
+    bool _sendContentLength;
+    Socket _listenSocket;
+    uint16_t _port{0};
+    std::atomic<bool> _stopped{false};
+    std::atomic<uint64_t> _requestCount{0};
+    std::mutex _connectionsMutex;
+    std::vector<Socket> _connections;
+    std::vector<std::thread> _connectionThreads;
+};
+
+struct RequestTiming {
+    double seconds;
+    uint64_t bytes;
+};
+
+RequestTiming
+requestConcurrently(bool useMultiHandle, const LocalHttpServer& server, uint64_t requestCount, uint64_t responseSize) {
+    const auto pTaskProcessor = std::make_shared<TaskProcessor>();
+    const CesiumAsync::AsyncSystem asyncSystem(pTaskProcessor);
+    const auto pAssetAccessor = std::make_shared<UrlAssetAccessor>(std::filesystem::path(), useMultiHandle);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>> futures;
+    futures.reserve(requestCount);
+
+    for (uint64_t i = 0; i < requestCount; ++i) {
+        futures.push_back(pAssetAccessor->get(asyncSystem, server.getUrl(), {}));
+    }
+
+    const auto requests = asyncSystem.all(std::move(futures)).wait();
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    CHECK(requests.size() == requestCount);
+
+    uint64_t bytes = 0;
+
+    for (const auto& pRequest : requests) {
+        const auto pResponse = pRequest->response();
+        REQUIRE(pResponse != nullptr);
+        CHECK(pResponse->statusCode() == 200);
+        CHECK(pResponse->data().size() == responseSize);
+        bytes += pResponse->data().size();
+    }
+
+    return {elapsed, bytes};
+}
+
+double computeMegabytesPerSecond(const RequestTiming& timing) {
+    return static_cast<double>(timing.bytes) / (1024.0 * 1024.0) / timing.seconds;
+}
+
+TEST_SUITE("Test UrlAssetAccessor") {
+    TEST_CASE("Concurrent requests to a local server") {
+        LocalHttpServer server(RESPONSE_SIZE, true);
+
+        SUBCASE("Multi handle") {
+            const auto timing = requestConcurrently(true, server, CONCURRENT_REQUEST_COUNT, RESPONSE_SIZE);
+            const auto requestsPerSecond = static_cast<double>(CONCURRENT_REQUEST_COUNT) / timing.seconds;
+            MESSAGE("Multi handle: ", requestsPerSecond, " requests per second");
+        }
+
+        SUBCASE("Easy handle") {
+            const auto timing = requestConcurrently(false, server, CONCURRENT_REQUEST_COUNT, RESPONSE_SIZE);
+            const auto requestsPerSecond = static_cast<double>(CONCURRENT_REQUEST_COUNT) / timing.seconds;
+            MESSAGE("Easy handle: ", requestsPerSecond, " requests per second");
+        }
+
+        CHECK(server.getRequestCount() == CONCURRENT_REQUEST_COUNT);
+    }
+
+    TEST_CASE("Streaming large responses from a local server") {
+        // Without Content-Length the response buffer can't be pre-sized and grows geometrically instead
+        SUBCASE("With Content-Length") {
+            LocalHttpServer server(LARGE_RESPONSE_SIZE, true);
+            const auto timing = requestConcurrently(true, server, LARGE_REQUEST_COUNT, LARGE_RESPONSE_SIZE);
+            MESSAGE("With Content-Length: ", computeMegabytesPerSecond(timing), " MB/s");
+        }
+
+        SUBCASE("Without Content-Length") {
+            LocalHttpServer server(LARGE_RESPONSE_SIZE, false);
+            const auto timing = requestConcurrently(true, server, LARGE_REQUEST_COUNT, LARGE_RESPONSE_SIZE);
+            MESSAGE("Without Content-Length: ", computeMegabytesPerSecond(timing), " MB/s");
+        }
+    }
+}